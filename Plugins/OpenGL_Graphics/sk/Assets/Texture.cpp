@@ -7,6 +7,7 @@
 #include "Texture.h"
 
 #include <sk/Graphics/Renderer_Impl.h>
+#include <sk/Graphics/Rendering/State_Cache.h>
 
 // TODO: Move stb to OpenGL library.
 // TODO: Look at https://github.com/nothings/stb/blob/master/stb_image.h for importing textures.
@@ -48,11 +49,13 @@ namespace sk::Assets
         
         Graphics::cGLRenderer::AddGLTask( [ & ]
         {
-            gl::glGenTextures( 1, &m_buffer_.m_buffer_ );
-            gl::glBindTexture( gl::GL_TEXTURE_2D, m_buffer_.m_buffer_ );
+            // Bound through unit 0, which is the active one as the state cache never changes it.
+            auto& cache = Graphics::Rendering::cState_Cache::get();
+            gl::glCreateTextures( gl::GL_TEXTURE_2D, 1, &m_buffer_.m_buffer_ );
+            cache.BindTextureUnit( 0, m_buffer_.m_buffer_ );
             gl::glTexImage2D ( gl::GL_TEXTURE_2D, 0, static_cast< gl::GLint >( format ), width, height, 0, format, gl::GL_UNSIGNED_BYTE, data );
             gl::glGenerateMipmap( gl::GL_TEXTURE_2D );
-            gl::glBindTexture( gl::GL_TEXTURE_2D, 0 );
+            cache.BindTextureUnit( 0, 0 );
         } );
 
         stbi_image_free( data );
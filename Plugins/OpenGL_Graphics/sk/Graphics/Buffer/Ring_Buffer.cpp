@@ -0,0 +1,106 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Ring_Buffer.h"
+
+#include <sk/Debugging/Debugging.h>
+#include <sk/Graphics/Rendering/State_Cache.h>
+
+#include <glbinding/gl/gl.h>
+
+#include <algorithm>
+
+namespace sk::Graphics::OpenGL
+{
+    namespace
+    {
+        auto to_fence( const gl::GLsync _sync ) -> cRing_Allocator::fence_t
+        {
+            return reinterpret_cast< uintptr_t >( _sync );
+        }
+
+        auto to_sync( const cRing_Allocator::fence_t _fence ) -> gl::GLsync
+        {
+            return reinterpret_cast< gl::GLsync >( static_cast< uintptr_t >( _fence ) );
+        }
+
+        auto get_alignment() -> size_t
+        {
+            gl::GLint uniform_alignment = 0;
+            gl::GLint storage_alignment = 0;
+            gl::glGetIntegerv( gl::GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT,        &uniform_alignment );
+            gl::glGetIntegerv( gl::GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &storage_alignment );
+
+            // Both are powers of two, so the larger one satisfies both.
+            return static_cast< size_t >( std::max( { uniform_alignment, storage_alignment, 1 } ) );
+        }
+    } // ::
+
+    cRing_Buffer::cRing_Buffer( std::string _name, const size_t _frame_size )
+    : m_name_( std::move( _name ) )
+    {
+        const auto capacity = _frame_size * kFramesInFlight;
+        constexpr auto storage_flags = gl::BufferStorageMask::GL_MAP_WRITE_BIT | gl::BufferStorageMask::GL_MAP_PERSISTENT_BIT | gl::BufferStorageMask::GL_MAP_COHERENT_BIT;
+        constexpr auto map_flags     = gl::MapBufferAccessMask::GL_MAP_WRITE_BIT | gl::MapBufferAccessMask::GL_MAP_PERSISTENT_BIT | gl::MapBufferAccessMask::GL_MAP_COHERENT_BIT;
+
+        gl::glCreateBuffers( 1, &m_buffer_ );
+        gl::glNamedBufferStorage( m_buffer_, static_cast< gl::GLsizeiptr >( capacity ), nullptr, storage_flags );
+        m_data_ = static_cast< std::byte* >( gl::glMapNamedBufferRange( m_buffer_, 0, static_cast< gl::GLsizeiptr >( capacity ), map_flags ) );
+
+        SK_ERR_IF( m_data_ == nullptr, TEXT( "Error: Unable to map the ring buffer {}.", m_name_ ) )
+
+        m_allocator_ = std::make_unique< cRing_Allocator >( capacity, get_alignment(), cRing_Allocator::sFences{
+            .insert = []
+            {
+                return to_fence( gl::glFenceSync( gl::GL_SYNC_GPU_COMMANDS_COMPLETE, gl::UnusedMask::GL_NONE_BIT ) );
+            },
+            .wait = []( const cRing_Allocator::fence_t _fence )
+            {
+                const auto sync = to_sync( _fence );
+
+                // Flushing on the first wait makes sure the fence is actually submitted, the rest only have to wait.
+                auto wait_flags = gl::SyncObjectMask::GL_SYNC_FLUSH_COMMANDS_BIT;
+                for( ;; )
+                {
+                    const auto result = gl::glClientWaitSync( sync, wait_flags, 1'000'000 );
+                    if( result == gl::GL_ALREADY_SIGNALED || result == gl::GL_CONDITION_SATISFIED )
+                        break;
+
+                    SK_BREAK_IF( sk::Severity::kGraphics, result == gl::GL_WAIT_FAILED, "Error: Waiting on a ring buffer fence failed." )
+                    if( result == gl::GL_WAIT_FAILED )
+                        break;
+
+                    wait_flags = gl::SyncObjectMask::GL_NONE_BIT;
+                }
+
+                gl::glDeleteSync( sync );
+            }
+        } );
+    } // cRing_Buffer
+
+    cRing_Buffer::~cRing_Buffer()
+    {
+        m_allocator_.reset();
+
+        Rendering::cState_Cache::get().ForgetBuffer( m_buffer_ );
+        gl::glUnmapNamedBuffer( m_buffer_ );
+        gl::glDeleteBuffers( 1, &m_buffer_ );
+    } // ~cRing_Buffer
+
+    auto cRing_Buffer::Allocate( const size_t _size ) -> sAllocation
+    {
+        const auto offset = m_allocator_->Allocate( _size );
+        if( offset == cRing_Allocator::kInvalid )
+            return {};
+
+        return { .data = m_data_ + offset, .buffer = m_buffer_, .offset = offset, .size = _size };
+    } // Allocate
+
+    void cRing_Buffer::EndFrame()
+    {
+        m_allocator_->EndFrame();
+    } // EndFrame
+} // sk::Graphics::OpenGL
@@ -0,0 +1,59 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include <sk/Graphics/Buffer/Ring_Allocator.h>
+
+#include <glbinding/gl/types.h>
+
+#include <memory>
+#include <string>
+
+namespace sk::Graphics::OpenGL
+{
+    // A persistently mapped buffer which per draw data is written straight into, and bound by range.
+    // Holds enough memory for kFramesInFlight frames, a frame only waits on the gpu if it would catch up to one still being drawn.
+    class cRing_Buffer
+    {
+    public:
+        static constexpr size_t kFramesInFlight = 3;
+
+        struct sAllocation
+        {
+            // Written to directly, the mapping is coherent so nothing has to be flushed.
+            void*      data   = nullptr;
+            gl::GLuint buffer = 0;
+            size_t     offset = 0;
+            size_t     size   = 0;
+
+            [[ nodiscard ]] bool IsValid() const { return data != nullptr; }
+        };
+
+        cRing_Buffer( std::string _name, size_t _frame_size );
+        ~cRing_Buffer();
+
+        cRing_Buffer( const cRing_Buffer& ) = delete;
+        cRing_Buffer& operator=( const cRing_Buffer& ) = delete;
+
+        // Aligned for GL_UNIFORM_BUFFER, as well as GL_SHADER_STORAGE_BUFFER.
+        auto Allocate( size_t _size ) -> sAllocation;
+        void EndFrame();
+
+        [[ nodiscard ]] auto  GetBuffer   () const { return m_buffer_; }
+        [[ nodiscard ]] auto& GetAllocator() const { return *m_allocator_; }
+        [[ nodiscard ]] auto& GetName     () const { return m_name_; }
+
+    private:
+        gl::GLuint m_buffer_ = 0;
+        std::byte* m_data_   = nullptr;
+
+        // Created after the buffer as it needs the alignment, and destroyed before it as it waits on the fences.
+        std::unique_ptr< cRing_Allocator > m_allocator_;
+
+        std::string m_name_;
+    };
+} // sk::Graphics::OpenGL
@@ -8,6 +8,7 @@
 
 #include <sk/Debugging/Debugging.h>
 #include <sk/Graphics/Renderer_Impl.h>
+#include <sk/Graphics/Rendering/State_Cache.h>
 #include <sk/Memory/Tracker/Tracker.h>
 
 #include <glbinding/gl/gl.h>
@@ -100,8 +101,8 @@ namespace sk::Graphics
     {
         cGLRenderer::AddGLTask( [ & ]
         {
-            gl::glGenBuffers( 1, &m_buffer_.buffer );
-            gl::glBindBuffer( m_buffer_.type, m_buffer_.buffer );
+            // Created directly, as binding it could change the element buffer of whatever vertex array is bound.
+            gl::glCreateBuffers( 1, &m_buffer_.buffer );
 
             m_flags_ |= kInitialized;
 
@@ -138,6 +139,7 @@ namespace sk::Graphics
         {
             cGLRenderer::AddGLTask( [ buffer = m_buffer_.buffer ]
             {
+                Rendering::cState_Cache::get().ForgetBuffer( buffer );
                 gl::glDeleteBuffers( 1, &buffer );
             }, false );
             m_buffer_.buffer = 0;
@@ -299,6 +301,19 @@ namespace sk::Graphics
         }
     } // Lock
 
+    void cUnsafe_Buffer::UploadSegment( const size_t _offset, const size_t _size )
+    {
+        SK_BREAK_RET_IF( sk::Severity::kGraphics | 100, m_byte_size_ < ( _size + _offset ),
+            TEXT( "ERROR: The segment reaches outside of the buffer." ) )
+        
+        // The gpu side has to be reallocated first, which uploads everything.
+        if( m_byte_size_ != m_buffer_.size )
+            return Upload( true );
+        
+        gl::glNamedBufferSubData( m_buffer_.buffer, static_cast< gl::GLintptr >( _offset ),
+            static_cast< gl::GLsizeiptr >( _size ), static_cast< std::byte* >( m_data_ ) + _offset );
+    } // UploadSegment
+
     void cUnsafe_Buffer::Copy( const iUnsafe_Buffer& _other )
     {
         Resize( _other.GetSize() );
@@ -85,6 +85,7 @@ namespace sk::Graphics
             
             void SetChanged() override;
             void Upload( bool _force ) override;
+            void UploadSegment( size_t _offset, size_t _size ) override;
 
             void Copy ( const iUnsafe_Buffer& _other ) override;
             void Steal( iUnsafe_Buffer&& _other ) noexcept override;
@@ -9,9 +9,13 @@
 #include <sk/Assets/Shader.h>
 #include <sk/Assets/Management/Asset_Job_Manager.h>
 #include <sk/Assets/Management/Asset_Manager.h>
+#include <sk/Misc/Future.h>
 #include <sk/Platform/Platform_Base.h>
 
 #include <glbinding/Binding.h>
+#if defined( SK_OPENGL_COUNT_CALLS )
+#include <glbinding/FunctionCall.h>
+#endif // SK_OPENGL_COUNT_CALLS
 #include <glbinding/glbinding.h>
 #include <glbinding/gl/functions.h>
 
@@ -105,6 +109,16 @@ namespace
     }
     
     std::thread::id main_thread_id;
+    
+#if defined( SK_OPENGL_COUNT_CALLS )
+    // Only the GL thread makes calls, so it doesn't have to be atomic.
+    size_t gl_calls = 0;
+    // Frames between every report of the counters.
+    constexpr uint64_t kReportInterval = 300;
+#endif // SK_OPENGL_COUNT_CALLS
+    
+    // Enough for a few thousand draws worth of blocks, a frame going past it waits on older frames.
+    constexpr size_t kUniformRingFrameSize = 2 * 1024 * 1024;
 } // ::
 
 cGLRenderer::cGLRenderer()
@@ -112,19 +126,12 @@ cGLRenderer::cGLRenderer()
     main_thread_id = std::this_thread::get_id();
     
     glbinding::initialize( 0, &Platform::get_proc_address, true );
+#if defined( SK_OPENGL_COUNT_CALLS )
+    // Every call goes through the callback, so it's only there when profiling.
     for( auto& function : glbinding::Binding::functions() )
-    {
-        if( std::string_view{ "glGetError" } != function->name() )
-            function->addCallbackMask( glbinding::CallbackMask::After );
-    }
-    /*
-    glbinding::setAfterCallback([]( const glbinding::FunctionCall& ){
-        if( const auto error = gl::glGetError(); error != gl::GL_NO_ERROR ){
-            SK_BREAK;
-            SK_WARNING( sk::Severity::kGraphics, "OpenGL Error: {}", static_cast< size_t >( error ) )
-        }
-    } );
-    //*/
+        function->addCallbackMask( glbinding::CallbackMask::After );
+    glbinding::setAfterCallback( []( const glbinding::FunctionCall& ){ ++gl_calls; } );
+#endif // SK_OPENGL_COUNT_CALLS
     gl::glDebugMessageCallback( &message_callback, nullptr );
     
     cAsset_Manager::get().AddFileLoaderForExtensions(
@@ -133,11 +140,18 @@ cGLRenderer::cGLRenderer()
     m_fallback_vertex_buffer_ = std::make_unique< cUnsafe_Buffer >( "Fallback Vertex Buffer", 128, 0, Buffer::eType::kVertex, false, false );
     m_fallback_vertex_buffer_->Clear();
     m_fallback_vertex_buffer_->Upload( true );
+    
+    m_uniform_ring_ = std::make_unique< OpenGL::cRing_Buffer >( "Uniform Ring", kUniformRingFrameSize );
+
+    Async::AddHelper( &help );
 } // cRenderer
 
 cGLRenderer::~cGLRenderer()
 {
+    Async::RemoveHelper( &help );
+
     m_fallback_vertex_buffer_.reset();
+    m_uniform_ring_.reset();
     
     // No need to remove loaders as the asset manager is already shut down.
     // cAsset_Manager::get().RemoveFileLoaders( { "frag", "vert", "comp" } );
@@ -154,6 +168,16 @@ void cGLRenderer::AddGLTask( const std::function< void() >& _function, const boo
     get().addGLTask( _function, _wait );
 }
 
+bool cGLRenderer::sGL_Awaiter::await_ready() const
+{
+    return std::this_thread::get_id() == main_thread_id;
+}
+
+void cGLRenderer::sGL_Awaiter::await_suspend( const std::coroutine_handle<> _handle ) const
+{
+    get().addGLTask( [ _handle ]{ _handle.resume(); }, false );
+}
+
 void cGLRenderer::addGLTask( const std::function< void() >& _function, const bool _wait )
 {
     std::atomic_bool completed = false;
@@ -161,12 +185,42 @@ void cGLRenderer::addGLTask( const std::function< void() >& _function, const boo
     m_task_mtx_.lock();
     m_tasks_.emplace_back( sTask{ .stopper = _wait ? &completed : nullptr, .function = _function } );
     m_task_mtx_.unlock();
+
+    // The main thread might be waiting on something else, this lets it pick the task up.
+    Async::Notify();
     
     if( _wait )
         completed.wait( false );
 }
 
 void cGLRenderer::Update()
+{
+    // Called once at the start of every frame, so whatever was counted since the last one belongs to the previous frame.
+    auto& state_cache = Rendering::cState_Cache::get();
+#if defined( SK_OPENGL_COUNT_CALLS )
+    m_frame_calls_       = std::exchange( gl_calls, 0 );
+#endif // SK_OPENGL_COUNT_CALLS
+    m_frame_state_stats_ = state_cache.GetStats();
+    state_cache.ResetStats();
+    m_frame_uniform_bytes_ = std::exchange( m_uniform_bytes_, 0 );
+    m_frame_ring_bytes_    = std::exchange( m_ring_bytes_, 0 );
+    
+#if defined( SK_OPENGL_COUNT_CALLS )
+    // A static scene only writes the per draw blocks, anything animating the materials shows up as block bytes.
+    if( m_uniform_ring_->GetAllocator().GetFrameIndex() % kReportInterval == 0 )
+    {
+        std::cout << "Frame: " << m_frame_calls_ << " GL calls, " << m_frame_uniform_bytes_ << " bytes uploaded to material blocks, "
+            << m_frame_ring_bytes_ << " bytes of per draw blocks written to the uniform ring\n";
+    }
+#endif // SK_OPENGL_COUNT_CALLS
+    
+    // Fences the uniforms written during the previous frame.
+    m_uniform_ring_->EndFrame();
+    
+    run_tasks();
+}
+
+bool cGLRenderer::run_tasks()
 {
     std::vector< sTask > tasks;
     m_task_mtx_.lock();
@@ -182,6 +236,20 @@ void cGLRenderer::Update()
             stopper->notify_one();
         }
     }
+
+    return !tasks.empty();
+}
+
+bool cGLRenderer::help()
+{
+    if( std::this_thread::get_id() != main_thread_id )
+        return false;
+
+    const auto renderer = getPtr();
+    if( renderer == nullptr )
+        return false;
+
+    return renderer->run_tasks();
 }
 
 void sk::Graphics::InitRenderer()
@@ -8,9 +8,13 @@
 
 #include <sk/Assets/Management/Asset_Manager.h>
 #include <sk/Graphics/Renderer.h>
+#include <sk/Graphics/Buffer/Ring_Buffer.h>
 #include <sk/Graphics/Buffer/Unsafe_Buffer.h>
+#include <sk/Graphics/Rendering/State_Cache.h>
 #include <sk/Graphics/Utils/Shader_Link.h>
 
+#include <coroutine>
+
 namespace sk::Assets
 {
     class cMesh;
@@ -32,20 +36,54 @@ namespace sk::Graphics
             std::function< void() > function;
         };
         
+        struct sGL_Awaiter
+        {
+            [[ nodiscard ]] bool await_ready() const;
+            void await_suspend( std::coroutine_handle<> _handle ) const;
+            void await_resume () const noexcept {}
+        };
+        
         cGLRenderer();
         ~cGLRenderer() override;
         
         static void AddGLTask( const std::function< void() >& _function, bool _wait = true );
+        // co_await to continue the current coroutine on the GL thread. Won't suspend if it's already on the GL thread.
+        static auto ResumeOnGLThread() -> sGL_Awaiter { return {}; }
 
         auto& GetFallbackVertexBuffer() const { return *m_fallback_vertex_buffer_; }
+        // Per draw uniforms are written here instead of to the material blocks own buffers.
+        auto& GetUniformRing() const { return *m_uniform_ring_; }
+        
+        // Every GL call made during the last frame, counted through the glbinding callbacks. Always 0 unless SK_OPENGL_COUNT_CALLS is defined.
+        [[ nodiscard ]] auto  GetFrameCallCount () const { return m_frame_calls_; }
+        // Calls made and skipped by the state cache during the last frame.
+        [[ nodiscard ]] auto& GetFrameStateStats() const { return m_frame_state_stats_; }
+        // Bytes uploaded to the material blocks own buffers during the last frame. Stays at 0 while nothing but the per draw blocks changes.
+        [[ nodiscard ]] auto  GetFrameUniformBytes() const { return m_frame_uniform_bytes_; }
+        // Bytes of per draw blocks written to the uniform ring during the last frame.
+        [[ nodiscard ]] auto  GetFrameRingBytes   () const { return m_frame_ring_bytes_; }
+        void AddUniformBytes( const size_t _bytes, const size_t _ring_bytes ){ m_uniform_bytes_ += _bytes; m_ring_bytes_ += _ring_bytes; }
         
         void Update() override;
     private:
         void addGLTask( const std::function< void() >& _function, bool _wait );
+        // Returns true if any task was run.
+        bool run_tasks();
+
+        // Lets the main thread run GL tasks while it's waiting on something.
+        static bool help();
 
-        std::unique_ptr< cUnsafe_Buffer > m_fallback_vertex_buffer_;
+        std::unique_ptr< cUnsafe_Buffer >       m_fallback_vertex_buffer_;
+        std::unique_ptr< OpenGL::cRing_Buffer > m_uniform_ring_;
         
         std::mutex           m_task_mtx_;
         std::vector< sTask > m_tasks_;
+        
+        size_t                          m_frame_calls_ = 0;
+        Rendering::cState_Cache::sStats m_frame_state_stats_;
+        size_t                          m_uniform_bytes_       = 0;
+        size_t                          m_frame_uniform_bytes_ = 0;
+        size_t                          m_ring_bytes_          = 0;
+        size_t                          m_frame_ring_bytes_    = 0;
     };
 } // sk::Graphics
@@ -11,12 +11,15 @@
 #include <sk/Graphics/Rendering/Depth_Target.h>
 #include <sk/Graphics/Rendering/Render_Target.h>
 #include <sk/Graphics/Rendering/Scissor.h>
+#include <sk/Graphics/Rendering/State_Cache.h>
 #include <sk/Graphics/Rendering/Viewport.h>
 #include <sk/Graphics/Utils/Shader_Reflection.h>
 
 #include <glbinding/gl/enum.h>
 #include <glbinding/gl/functions.h>
 
+#include <cstring>
+
 using namespace sk::Graphics::Rendering;
 
 cFrame_Buffer::cFrame_Buffer( const size_t _render_targets )
@@ -85,11 +88,12 @@ void cFrame_Buffer::create( const bool _is_window_frame )
     else
         m_frame_buffer_ = 0;
     
-    gl::glGenVertexArrays( 1, &m_vertex_array_ );
+    gl::glCreateVertexArrays( 1, &m_vertex_array_ );
 } // create
 
 void cFrame_Buffer::destroy() const
 {
+    cState_Cache::get().ForgetVertexArray( m_vertex_array_ );
     gl::glDeleteVertexArrays( 1, &m_vertex_array_ );
     if( m_frame_buffer_ != 0 )
         gl::glDeleteFramebuffers( 1, &m_frame_buffer_ );
@@ -193,13 +197,7 @@ void cFrame_Buffer::BindVertexBuffer( const size_t _binding, const cDynamic_Buff
         buffer_object = cGLRenderer::get().GetFallbackVertexBuffer().get_buffer().buffer;
     }
     
-    if( m_bound_vertex_buffers_.size() < _binding )
-        m_bound_vertex_buffers_.resize( _binding );
-    
-    gl::glVertexArrayVertexBuffer( m_vertex_array_,
-        static_cast< gl::GLuint >( _binding ), buffer_object,
-        0, stride
-    );
+    cState_Cache::get().BindVertexBuffer( m_vertex_array_, static_cast< gl::GLuint >( _binding ), buffer_object, stride );
     
     if( m_bound_vertex_buffers_.size() <= _binding )
         m_bound_vertex_buffers_.resize( _binding + 1 );
@@ -209,10 +207,9 @@ void cFrame_Buffer::BindVertexBuffer( const size_t _binding, const cDynamic_Buff
 
 void cFrame_Buffer::UnbindVertexBuffers()
 {
-    gl::glBindVertexArray( m_vertex_array_ );
+    auto& cache = cState_Cache::get();
     for( size_t i = 0; i < m_bound_vertex_buffers_.size(); i++ )
-        gl::glBindVertexBuffer( static_cast< gl::GLuint >( i ), 0, 0, 0 );
-    gl::glBindVertexArray( 0 );
+        cache.BindVertexBuffer( m_vertex_array_, static_cast< gl::GLuint >( i ), 0, 0 );
     
     m_bound_vertex_buffers_.clear();
 }
@@ -223,18 +220,33 @@ void cFrame_Buffer::BindIndexBuffer( const cDynamic_Buffer& _buffer )
     buffer.Upload( false );
     // TODO: Validate the buffer.
     
-    gl::glBindVertexArray( m_vertex_array_ );
-    gl::glBindBuffer( gl::GL_ELEMENT_ARRAY_BUFFER, buffer.get_buffer().buffer );
-    gl::glBindVertexArray( 0 );
+    cState_Cache::get().BindElementBuffer( m_vertex_array_, buffer.get_buffer().buffer );
     
     m_bound_index_buffer_ = &_buffer;
 }
 
 void cFrame_Buffer::UnbindIndexBuffer() const
 {
-    gl::glBindVertexArray( m_vertex_array_ );
-    gl::glBindBuffer( gl::GL_ELEMENT_ARRAY_BUFFER, 0 );
-    gl::glBindVertexArray( 0 );
+    cState_Cache::get().BindElementBuffer( m_vertex_array_, 0 );
+}
+
+void cFrame_Buffer::BindStorageBuffer( const size_t _binding, iUnsafe_Buffer& _buffer )
+{
+    auto& buffer = static_cast< cUnsafe_Buffer& >( _buffer );
+    buffer.Upload( false );
+    
+    cState_Cache::get().BindBufferBase( gl::GL_SHADER_STORAGE_BUFFER, static_cast< gl::GLuint >( _binding ), buffer.get_buffer().buffer );
+    
+    m_bound_storage_buffers_.emplace_back( _binding );
+}
+
+void cFrame_Buffer::UnbindStorageBuffers()
+{
+    auto& cache = cState_Cache::get();
+    for( const auto binding : m_bound_storage_buffers_ )
+        cache.BindBufferBase( gl::GL_SHADER_STORAGE_BUFFER, static_cast< gl::GLuint >( binding ), 0 );
+    
+    m_bound_storage_buffers_.clear();
 }
 
 namespace 
@@ -249,35 +261,30 @@ bool cFrame_Buffer::UseMaterial( const Assets::cMaterial& _material )
     SK_BREAK_RET_IF( sk::Severity::kGraphics, !_material.IsReady(),
         "Error: Material isn't ready yet.", false )
     
-    auto& link = _material.GetShaderLink();
+    auto& cache = cState_Cache::get();
+    auto& link  = _material.GetShaderLink();
     
     link.Use();
     
     auto reflection = link.GetReflection();
     auto& attributes = reflection->GetAttributes();
 
-    gl::glBindVertexArray( m_vertex_array_ );
-    
     // TODO: Make into a int for loop
     gl::GLuint index = 0;
     for( auto& attribute : attributes )
     {
-        gl::glEnableVertexAttribArray( index );
-        // TODO: Support normalizing in the future.
-        gl::glVertexAttribFormat( index, attribute.components, attribute.gl_type, false, 0 );
-        gl::glVertexAttribBinding( index, index );
-        
+        cache.SetAttributeFormat( m_vertex_array_, index, attribute.components, attribute.gl_type );
         ++index;
     }
+    // Also disables whatever the previous material had enabled above this, so it doesn't have to be reset in between.
+    cache.SetAttributeCount( m_vertex_array_, index );
     m_attribute_count_ = index;
-    
-    gl::glBindVertexArray( 0 );
         
     for( auto& block : _material.GetBlocks() | std::views::values )
     {
+        const auto binding = static_cast< gl::GLuint >( block.m_binding_ );
         m_assigned_blocks_.emplace_back( block.m_binding_ );
-        gl::glUniformBlockBinding( link.get_program(), static_cast< gl::GLuint >( block.m_binding_ ), static_cast< gl::GLuint >( block.m_binding_ ) );
-        gl::glBindBufferBase( gl::GL_UNIFORM_BUFFER, static_cast< gl::GLuint >( block.m_binding_ ), block.m_buffer_.get_buffer().buffer );
+        cache.UniformBlockBinding( link.get_program(), binding, binding );
     }
 
     constexpr sVisitor visitor{
@@ -309,15 +316,15 @@ bool cFrame_Buffer::UseMaterial( const Assets::cMaterial& _material )
     {
         const auto& [ _, sampler, texture ] = textures[ i ];
 
-        gl::glActiveTexture( gl::GL_TEXTURE0 + i );
+        const auto unit = static_cast< gl::GLuint >( i );
         if( auto res = std::visit( visitor, texture ); res.has_value() )
-            gl::glBindTexture( res->first, res->second );
+            cache.BindTextureUnit( unit, res->second );
         else
-            gl::glBindTexture( gl::GL_TEXTURE_2D, 0 );
-        gl::glUniform1i( sampler->location, static_cast< gl::GLint >( i ) );
+            cache.BindTextureUnit( unit, 0 );
+        cache.SetSamplerUnit( link.get_program(), sampler->location, static_cast< gl::GLint >( i ) );
     }
 
-    gl::glEnable( gl::GL_DEPTH_TEST );
+    cache.SetDepthTest( true );
     gl::GLenum depth_method = gl::GL_NEVER;
     switch( _material.GetDepthTest() )
     {
@@ -330,31 +337,91 @@ bool cFrame_Buffer::UseMaterial( const Assets::cMaterial& _material )
     case Assets::cMaterial::eDepthTest::kEqual:        depth_method = gl::GL_EQUAL;    break;
     case Assets::cMaterial::eDepthTest::kNotEqual:     depth_method = gl::GL_NOTEQUAL; break;
     }
-    gl::glDepthFunc( depth_method );
+    cache.SetDepthFunc( depth_method );
     
 
     return true;
 }
 
+void cFrame_Buffer::UploadBlocks( Assets::cMaterial& _material )
+{
+    auto& cache    = cState_Cache::get();
+    auto& renderer = cGLRenderer::get();
+    auto& ring     = renderer.GetUniformRing();
+    
+    const auto frame = ring.GetAllocator().GetFrameIndex();
+    size_t uploaded      = 0;
+    size_t ring_uploaded = 0;
+    
+    for( auto& block : _material.m_block_map_ | std::views::values )
+    {
+        const auto binding = static_cast< gl::GLuint >( block.m_binding_ );
+        const auto size    = block.m_buffer_.GetSize();
+        
+        // Changing again after being uploaded this frame means the block is written for every draw.
+        if( !block.m_per_draw_ && block.IsDirty() && block.m_upload_frame_ == frame )
+            block.m_per_draw_ = true;
+        
+        // Everything else stays in the blocks own buffer, which only gets the range that changed.
+        if( !block.m_per_draw_ )
+        {
+            if( block.IsDirty() )
+            {
+                uploaded += block.upload();
+                block.m_upload_frame_ = frame;
+            }
+            
+            cache.BindBufferBase( gl::GL_UNIFORM_BUFFER, binding, block.m_buffer_.get_buffer().buffer );
+            continue;
+        }
+        
+        if( block.m_ring_frame_ == frame && block.m_ring_version_ == block.m_version_ )
+        {
+            cache.BindBufferRange( gl::GL_UNIFORM_BUFFER, binding, ring.GetBuffer(), block.m_ring_offset_, size );
+            continue;
+        }
+        
+        if( const auto allocation = ring.Allocate( size ); allocation.IsValid() )
+        {
+            std::memcpy( allocation.data, block.m_buffer_.Data(), size );
+            cache.BindBufferRange( gl::GL_UNIFORM_BUFFER, binding, allocation.buffer, allocation.offset, size );
+            
+            block.m_ring_frame_   = frame;
+            block.m_ring_version_ = block.m_version_;
+            block.m_ring_offset_  = allocation.offset;
+            ring_uploaded += size;
+            continue;
+        }
+        
+        // The ring is too small for the frame, fall back to the blocks own buffer.
+        uploaded += block.upload();
+        cache.BindBufferBase( gl::GL_UNIFORM_BUFFER, binding, block.m_buffer_.get_buffer().buffer );
+    }
+    
+    renderer.AddUniformBytes( uploaded, ring_uploaded );
+}
+
 void cFrame_Buffer::ResetMaterial()
 {
-    gl::glBindVertexArray( m_vertex_array_ );
+    auto& cache = cState_Cache::get();
     
-    for( uint32_t i = 0; i < m_attribute_count_; i++ )
-        gl::glDisableVertexAttribArray( i );
+    cache.SetAttributeCount( m_vertex_array_, 0 );
     m_attribute_count_ = 0;
     
-    gl::glBindVertexArray( 0 );
-    
     for( const auto& block : m_assigned_blocks_ )
-        gl::glBindBufferBase( gl::GL_UNIFORM_BUFFER, static_cast< gl::GLuint >( block ), 0 );
+        cache.BindBufferBase( gl::GL_UNIFORM_BUFFER, static_cast< gl::GLuint >( block ), 0 );
     
-    gl::glUseProgram( 0 );
+    cache.UseProgram( 0 );
     
     m_assigned_blocks_.clear();
 }
 
-bool cFrame_Buffer::DrawIndexed( const size_t _start, size_t _end ) const
+bool cFrame_Buffer::DrawIndexed( const size_t _start, const size_t _end ) const
+{
+    return DrawIndexedInstanced( 1, _start, _end );
+}
+
+bool cFrame_Buffer::DrawIndexedInstanced( const size_t _instances, const size_t _start, size_t _end ) const
 {
     SK_BREAK_RET_IF( sk::Severity::kGraphics, _start > m_bound_index_buffer_->GetSize(),
         "Error: Offset is greater than index buffer size!", false )
@@ -381,9 +448,9 @@ bool cFrame_Buffer::DrawIndexed( const size_t _start, size_t _end ) const
         TEXT( "Error: Invalid index buffer type Has to be one of uint16_t or uint32_t. But {} was provided instead!",
             m_bound_index_buffer_->GetItemType()->name ), false )
     
-    gl::glBindVertexArray( m_vertex_array_ );
-    gl::glDrawElements( gl::GL_TRIANGLES, static_cast< gl::GLsizei >( size ), type, nullptr );
-    gl::glBindVertexArray( 0 );
+    // The vertex array is left bound, as everything else changes it through direct state access.
+    cState_Cache::get().BindVertexArray( m_vertex_array_ );
+    gl::glDrawElementsInstanced( gl::GL_TRIANGLES, static_cast< gl::GLsizei >( size ), type, nullptr, static_cast< gl::GLsizei >( _instances ) );
     
     return true;
 }
@@ -396,9 +463,8 @@ bool cFrame_Buffer::DrawAuto() const
     if( m_bound_vertex_buffers_.empty() )
         return false;
     
-    gl::glBindVertexArray( m_vertex_array_ );
+    cState_Cache::get().BindVertexArray( m_vertex_array_ );
     gl::glDrawArrays( gl::GL_TRIANGLES, 0, static_cast< gl::GLsizei >( m_bound_vertex_buffers_[ 0 ]->GetSize() ) );
-    gl::glBindVertexArray( 0 );
     
     return true;
 }
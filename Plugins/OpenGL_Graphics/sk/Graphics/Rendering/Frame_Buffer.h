@@ -85,11 +85,19 @@ namespace sk::Graphics::Rendering
         // ApplyMaterial has to be called before this
         void BindIndexBuffer( const cDynamic_Buffer& _buffer );
         void UnbindIndexBuffer() const;
+        // Binds the whole buffer to a shader storage binding.
+        void BindStorageBuffer( size_t _binding, iUnsafe_Buffer& _buffer );
+        void UnbindStorageBuffers();
         
         bool UseMaterial( const Assets::cMaterial& _material );
+        // Copies the current values of every block into the renderers uniform ring, and binds them by range.
+        // Blocks unchanged since they were last copied this frame are bound to the same range again.
+        // Has to be called after UseMaterial, and again whenever a uniform changes between draws.
+        void UploadBlocks( Assets::cMaterial& _material );
         void ResetMaterial();
         
         bool DrawIndexed( size_t _start = 0, size_t _end = std::numeric_limits< size_t >::max() ) const;
+        bool DrawIndexedInstanced( size_t _instances, size_t _start = 0, size_t _end = std::numeric_limits< size_t >::max() ) const;
         bool DrawAuto() const;
 
     private:
@@ -108,6 +116,7 @@ namespace sk::Graphics::Rendering
         
         std::vector< const cDynamic_Buffer* > m_bound_vertex_buffers_;
         const cDynamic_Buffer* m_bound_index_buffer_ = nullptr;
+        std::vector< size_t >  m_bound_storage_buffers_;
     };
 } // sk::Graphics::Rendering
 
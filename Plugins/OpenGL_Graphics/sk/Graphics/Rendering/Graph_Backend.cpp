@@ -0,0 +1,107 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Graph_Backend.h"
+
+#include <sk/Debugging/Macros/Assert.h>
+
+namespace sk::Graphics::Rendering
+{
+    namespace
+    {
+        auto get_pixel_size( const cRender_Target::eFormat _format ) -> size_t
+        {
+            switch( _format )
+            {
+            case cRender_Target::eFormat::kR16F:    return 2;
+            case cRender_Target::eFormat::kR32F:    return 4;
+            case cRender_Target::eFormat::kRGB8:    return 3;
+            case cRender_Target::eFormat::kRGB16F:  return 6;
+            case cRender_Target::eFormat::kRGB32F:  return 12;
+            case cRender_Target::eFormat::kRGBA8:   return 4;
+            case cRender_Target::eFormat::kRGBA16F: return 8;
+            case cRender_Target::eFormat::kRGBA32F: return 16;
+            }
+            return 0;
+        }
+
+        auto get_pixel_size( const cDepth_Target::eFormat _format ) -> size_t
+        {
+            switch( _format )
+            {
+            case cDepth_Target::eFormat::kD16F:   return 2;
+            case cDepth_Target::eFormat::kD24FS8: return 4;
+            case cDepth_Target::eFormat::kD32F:   return 4;
+            }
+            return 0;
+        }
+    } // ::
+
+    auto cGraph_Backend::Describe( const cVector2u32& _resolution, const cRender_Target::eFormat _format ) -> sGraph_Texture
+    {
+        return { .resolution = _resolution, .type = sGraph_Texture::eType::kColor, .format = static_cast< uint32_t >( _format ) };
+    } // Describe
+
+    auto cGraph_Backend::Describe( const cVector2u32& _resolution, const cDepth_Target::eFormat _format ) -> sGraph_Texture
+    {
+        return { .resolution = _resolution, .type = sGraph_Texture::eType::kDepth, .format = static_cast< uint32_t >( _format ) };
+    } // Describe
+
+    auto cGraph_Backend::Create( const sGraph_Texture& _desc ) -> uint32_t
+    {
+        sTexture texture;
+        if( _desc.type == sGraph_Texture::eType::kColor )
+            texture.render_target = sk::make_shared< cRender_Target >( _desc.resolution, static_cast< cRender_Target::eFormat >( _desc.format ) );
+        else
+            texture.depth_target  = sk::make_shared< cDepth_Target >( _desc.resolution, static_cast< cDepth_Target::eFormat >( _desc.format ) );
+
+        if( m_free_.empty() )
+        {
+            m_textures_.push_back( std::move( texture ) );
+            return static_cast< uint32_t >( m_textures_.size() - 1 );
+        }
+
+        const auto index = m_free_.back();
+        m_free_.pop_back();
+        m_textures_[ index ] = std::move( texture );
+
+        return index;
+    } // Create
+
+    void cGraph_Backend::Destroy( const uint32_t _texture )
+    {
+        SK_BREAK_RET_IF( sk::Severity::kGraphics, _texture >= m_textures_.size(),
+            "Error: Trying to destroy a texture the graph backend didn't create." )
+
+        m_textures_[ _texture ] = {};
+        m_free_.push_back( _texture );
+    } // Destroy
+
+    auto cGraph_Backend::GetByteSize( const sGraph_Texture& _desc ) const -> size_t
+    {
+        const auto pixels = static_cast< size_t >( _desc.resolution.x ) * _desc.resolution.y;
+        if( _desc.type == sGraph_Texture::eType::kColor )
+            return pixels * get_pixel_size( static_cast< cRender_Target::eFormat >( _desc.format ) );
+
+        return pixels * get_pixel_size( static_cast< cDepth_Target::eFormat >( _desc.format ) );
+    } // GetByteSize
+
+    auto cGraph_Backend::GetRenderTarget( const uint32_t _texture ) const -> const cShared_ptr< cRender_Target >&
+    {
+        SK_ERR_IF( _texture >= m_textures_.size() || m_textures_[ _texture ].render_target == nullptr,
+            "Error: The graph texture isn't a render target." )
+
+        return m_textures_[ _texture ].render_target;
+    } // GetRenderTarget
+
+    auto cGraph_Backend::GetDepthTarget( const uint32_t _texture ) const -> const cShared_ptr< cDepth_Target >&
+    {
+        SK_ERR_IF( _texture >= m_textures_.size() || m_textures_[ _texture ].depth_target == nullptr,
+            "Error: The graph texture isn't a depth target." )
+
+        return m_textures_[ _texture ].depth_target;
+    } // GetDepthTarget
+} // sk::Graphics::Rendering
@@ -0,0 +1,48 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include <sk/Graphics/Pipelines/Render_Graph.h>
+#include <sk/Graphics/Rendering/Depth_Target.h>
+#include <sk/Graphics/Rendering/Render_Target.h>
+#include <sk/Misc/Smart_Ptrs.h>
+
+#include <vector>
+
+namespace sk::Graphics::Rendering
+{
+    // Creates the render and depth targets of a render graph, the format of a description is the eFormat of either.
+    class cGraph_Backend final : public iGraph_Backend
+    {
+    public:
+        // Imported as the window, which isn't a texture the backend knows about.
+        static constexpr uint32_t kWindow = cRender_Graph::kInvalid - 1;
+
+        static auto Describe( const cVector2u32& _resolution, cRender_Target::eFormat _format ) -> sGraph_Texture;
+        static auto Describe( const cVector2u32& _resolution, cDepth_Target::eFormat  _format ) -> sGraph_Texture;
+
+        auto Create ( const sGraph_Texture& _desc ) -> uint32_t override;
+        void Destroy( uint32_t _texture ) override;
+        [[ nodiscard ]] auto GetByteSize( const sGraph_Texture& _desc ) const -> size_t override;
+
+        // Writes to a framebuffer are always visible to the draws after it in OpenGL, so nothing has to wait.
+        void Barrier( uint32_t, eGraph_Access, eGraph_Access ) override {}
+
+        [[ nodiscard ]] auto GetRenderTarget( uint32_t _texture ) const -> const cShared_ptr< cRender_Target >&;
+        [[ nodiscard ]] auto GetDepthTarget ( uint32_t _texture ) const -> const cShared_ptr< cDepth_Target >&;
+
+    private:
+        struct sTexture
+        {
+            cShared_ptr< cRender_Target > render_target;
+            cShared_ptr< cDepth_Target >  depth_target;
+        };
+
+        std::vector< sTexture > m_textures_;
+        std::vector< uint32_t > m_free_;
+    };
+} // sk::Graphics::Rendering
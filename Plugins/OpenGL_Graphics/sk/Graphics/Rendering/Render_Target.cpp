@@ -7,6 +7,7 @@
 #include "Render_Target.h"
 
 #include <sk/Debugging/Macros/Assert.h>
+#include <sk/Graphics/Rendering/State_Cache.h>
 
 #include <glbinding/gl/functions.h>
 
@@ -88,17 +89,20 @@ namespace sk::Graphics::Rendering
 
         const Math::cVector2< gl::GLsizei > res = m_resolution_;
 
-        gl::glGenTextures( 1, &m_texture_ );
-        gl::glBindTexture( gl::GL_TEXTURE_2D, m_texture_ );
+        // Bound through unit 0, which is the active one as the state cache never changes it.
+        auto& cache = cState_Cache::get();
+        gl::glCreateTextures( gl::GL_TEXTURE_2D, 1, &m_texture_ );
+        cache.BindTextureUnit( 0, m_texture_ );
         gl::glTexImage2D ( gl::GL_TEXTURE_2D, 0, format, res.x, res.y, 0, format, type, nullptr );
         // TODO: Move these.
         gl::glTexParameteri(gl::GL_TEXTURE_2D, gl::GL_TEXTURE_MIN_FILTER, gl::GL_NEAREST);
         gl::glTexParameteri(gl::GL_TEXTURE_2D, gl::GL_TEXTURE_MAG_FILTER, gl::GL_NEAREST);
-        gl::glBindTexture( gl::GL_TEXTURE_2D, 0 );
+        cache.BindTextureUnit( 0, 0 );
     } // create
 
     void cRender_Target::destroy() const
     {
+        cState_Cache::get().ForgetTexture( m_texture_ );
         gl::glDeleteTextures( 1, &m_texture_ );
     } // destroy
 } // sk::Graphics::Rendering
\ No newline at end of file
@@ -0,0 +1,268 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "State_Cache.h"
+
+#include <glbinding/gl/enum.h>
+#include <glbinding/gl/functions.h>
+
+#include <bit>
+#include <ranges>
+
+using namespace sk::Graphics::Rendering;
+
+namespace
+{
+    template< class Ty >
+    auto& at( std::vector< Ty >& _values, const size_t _index, const Ty& _fill )
+    {
+        if( _values.size() <= _index )
+            _values.resize( _index + 1, _fill );
+
+        return _values[ _index ];
+    }
+} // ::
+
+auto cState_Cache::get() -> cState_Cache&
+{
+    // Static instead of owned by the renderer, as frame buffers can outlive it during shutdown.
+    static cState_Cache cache;
+    return cache;
+} // get
+
+template< class Ty >
+bool cState_Cache::set( Ty& _current, const Ty& _value )
+{
+    if( _current == _value )
+    {
+        m_stats_.skipped++;
+        return false;
+    }
+
+    _current = _value;
+    m_stats_.calls++;
+    return true;
+} // set
+
+auto cState_Cache::program_key( const gl::GLuint _program, const uint32_t _index ) -> uint64_t
+{
+    return ( static_cast< uint64_t >( _program ) << 32 ) | _index;
+} // program_key
+
+void cState_Cache::UseProgram( const gl::GLuint _program )
+{
+    if( set( m_program_, _program ) )
+        gl::glUseProgram( _program );
+} // UseProgram
+
+void cState_Cache::BindVertexArray( const gl::GLuint _vertex_array )
+{
+    if( set( m_vertex_array_, _vertex_array ) )
+        gl::glBindVertexArray( _vertex_array );
+} // BindVertexArray
+
+void cState_Cache::SetAttributeCount( const gl::GLuint _vertex_array, const uint32_t _count )
+{
+    auto& vertex_array = m_vertex_arrays_[ _vertex_array ];
+
+    const auto wanted  = _count >= 32 ? ~0u : ( 1u << _count ) - 1;
+    const auto changed = vertex_array.enabled ^ wanted;
+
+    if( changed == 0 )
+        m_stats_.skipped++;
+    m_stats_.calls += std::popcount( changed );
+
+    for( auto bits = changed; bits != 0; bits &= bits - 1 )
+    {
+        const auto index = static_cast< gl::GLuint >( std::countr_zero( bits ) );
+        if( wanted & ( 1u << index ) )
+            gl::glEnableVertexArrayAttrib( _vertex_array, index );
+        else
+            gl::glDisableVertexArrayAttrib( _vertex_array, index );
+    }
+
+    vertex_array.enabled = wanted;
+} // SetAttributeCount
+
+void cState_Cache::SetAttributeFormat( const gl::GLuint _vertex_array, const gl::GLuint _index, const gl::GLint _components, const gl::GLenum _type )
+{
+    auto& attribute = at( m_vertex_arrays_[ _vertex_array ].attributes, _index, sAttribute{} );
+
+    if( attribute.components == _components && attribute.type == _type )
+    {
+        m_stats_.skipped++;
+        return;
+    }
+
+    // The binding is set along with the first format, as it never changes.
+    if( attribute.type == gl::GLenum::GL_INVALID_ENUM )
+    {
+        gl::glVertexArrayAttribBinding( _vertex_array, _index, _index );
+        m_stats_.calls++;
+    }
+
+    // TODO: Support normalizing in the future.
+    gl::glVertexArrayAttribFormat( _vertex_array, _index, _components, _type, false, 0 );
+    m_stats_.calls++;
+
+    attribute = { .components = _components, .type = _type };
+} // SetAttributeFormat
+
+void cState_Cache::BindVertexBuffer( const gl::GLuint _vertex_array, const gl::GLuint _binding, const gl::GLuint _buffer, const gl::GLsizei _stride )
+{
+    auto& vertex_buffer = at( m_vertex_arrays_[ _vertex_array ].vertex_buffers, _binding, sVertex_Buffer{} );
+
+    if( vertex_buffer.buffer == _buffer && vertex_buffer.stride == _stride )
+    {
+        m_stats_.skipped++;
+        return;
+    }
+
+    gl::glVertexArrayVertexBuffer( _vertex_array, _binding, _buffer, 0, _stride );
+    m_stats_.calls++;
+
+    vertex_buffer = { .buffer = _buffer, .stride = _stride };
+} // BindVertexBuffer
+
+void cState_Cache::BindElementBuffer( const gl::GLuint _vertex_array, const gl::GLuint _buffer )
+{
+    if( set( m_vertex_arrays_[ _vertex_array ].element_buffer, _buffer ) )
+        gl::glVertexArrayElementBuffer( _vertex_array, _buffer );
+} // BindElementBuffer
+
+void cState_Cache::BindBufferBase( const gl::GLenum _target, const gl::GLuint _index, const gl::GLuint _buffer )
+{
+    auto& buffers = _target == gl::GL_SHADER_STORAGE_BUFFER ? m_storage_buffers_ : m_uniform_buffers_;
+
+    if( set( at( buffers, _index, sBuffer_Range{} ), sBuffer_Range{ .buffer = _buffer } ) )
+        gl::glBindBufferBase( _target, _index, _buffer );
+} // BindBufferBase
+
+void cState_Cache::BindBufferRange( const gl::GLenum _target, const gl::GLuint _index, const gl::GLuint _buffer, const size_t _offset, const size_t _size )
+{
+    auto& buffers = _target == gl::GL_SHADER_STORAGE_BUFFER ? m_storage_buffers_ : m_uniform_buffers_;
+
+    if( set( at( buffers, _index, sBuffer_Range{} ), sBuffer_Range{ .buffer = _buffer, .offset = _offset, .size = _size } ) )
+        gl::glBindBufferRange( _target, _index, _buffer, static_cast< gl::GLintptr >( _offset ), static_cast< gl::GLsizeiptr >( _size ) );
+} // BindBufferRange
+
+void cState_Cache::UniformBlockBinding( const gl::GLuint _program, const gl::GLuint _block, const gl::GLuint _binding )
+{
+    const auto [ itr, inserted ] = m_block_bindings_.try_emplace( program_key( _program, _block ), kUnknown );
+    if( set( itr->second, _binding ) )
+        gl::glUniformBlockBinding( _program, _block, _binding );
+} // UniformBlockBinding
+
+void cState_Cache::BindTextureUnit( const gl::GLuint _unit, const gl::GLuint _texture )
+{
+    if( set( at( m_texture_units_, _unit, kUnknown ), _texture ) )
+        gl::glBindTextureUnit( _unit, _texture );
+} // BindTextureUnit
+
+void cState_Cache::SetSamplerUnit( const gl::GLuint _program, const gl::GLint _location, const gl::GLint _unit )
+{
+    const auto [ itr, inserted ] = m_sampler_units_.try_emplace( program_key( _program, static_cast< uint32_t >( _location ) ), -1 );
+    if( set( itr->second, _unit ) )
+        gl::glProgramUniform1i( _program, _location, _unit );
+} // SetSamplerUnit
+
+void cState_Cache::SetDepthTest( const bool _enabled )
+{
+    if( set( m_depth_test_, std::optional( _enabled ) ) )
+        _enabled ? gl::glEnable( gl::GL_DEPTH_TEST ) : gl::glDisable( gl::GL_DEPTH_TEST );
+} // SetDepthTest
+
+void cState_Cache::SetDepthFunc( const gl::GLenum _func )
+{
+    if( set( m_depth_func_, std::optional( _func ) ) )
+        gl::glDepthFunc( _func );
+} // SetDepthFunc
+
+void cState_Cache::SetBlend( const bool _enabled )
+{
+    if( set( m_blend_, std::optional( _enabled ) ) )
+        _enabled ? gl::glEnable( gl::GL_BLEND ) : gl::glDisable( gl::GL_BLEND );
+} // SetBlend
+
+void cState_Cache::SetBlendFunc( const gl::GLenum _source, const gl::GLenum _destination )
+{
+    if( set( m_blend_func_, std::optional( std::array{ _source, _destination } ) ) )
+        gl::glBlendFunc( _source, _destination );
+} // SetBlendFunc
+
+void cState_Cache::SetCullFace( const bool _enabled, const gl::GLenum _face )
+{
+    if( set( m_cull_, std::optional( _enabled ) ) )
+        _enabled ? gl::glEnable( gl::GL_CULL_FACE ) : gl::glDisable( gl::GL_CULL_FACE );
+
+    if( _enabled && set( m_cull_face_, std::optional( _face ) ) )
+        gl::glCullFace( _face );
+} // SetCullFace
+
+void cState_Cache::ForgetBuffer( const gl::GLuint _buffer )
+{
+    const auto forget = [ _buffer ]( gl::GLuint& _current ){ if( _current == _buffer ) _current = kUnknown; };
+
+    for( auto& range : m_uniform_buffers_ )
+        forget( range.buffer );
+    for( auto& range : m_storage_buffers_ )
+        forget( range.buffer );
+
+    for( auto& vertex_array : m_vertex_arrays_ | std::views::values )
+    {
+        forget( vertex_array.element_buffer );
+        for( auto& vertex_buffer : vertex_array.vertex_buffers )
+            forget( vertex_buffer.buffer );
+    }
+} // ForgetBuffer
+
+void cState_Cache::ForgetTexture( const gl::GLuint _texture )
+{
+    for( auto& unit : m_texture_units_ )
+    {
+        if( unit == _texture )
+            unit = kUnknown;
+    }
+} // ForgetTexture
+
+void cState_Cache::ForgetVertexArray( const gl::GLuint _vertex_array )
+{
+    m_vertex_arrays_.erase( _vertex_array );
+
+    if( m_vertex_array_ == _vertex_array )
+        m_vertex_array_ = kUnknown;
+} // ForgetVertexArray
+
+void cState_Cache::ForgetProgram( const gl::GLuint _program )
+{
+    const auto is_program = [ _program ]( const auto& _pair ){ return _pair.first >> 32 == _program; };
+
+    std::erase_if( m_block_bindings_, is_program );
+    std::erase_if( m_sampler_units_,  is_program );
+
+    if( m_program_ == _program )
+        m_program_ = kUnknown;
+} // ForgetProgram
+
+void cState_Cache::Invalidate()
+{
+    // Vertex arrays are kept, as they're only ever changed through the cache.
+    m_program_      = kUnknown;
+    m_vertex_array_ = kUnknown;
+
+    m_uniform_buffers_.clear();
+    m_storage_buffers_.clear();
+    m_texture_units_  .clear();
+    m_block_bindings_ .clear();
+    m_sampler_units_  .clear();
+
+    m_depth_test_.reset();
+    m_depth_func_.reset();
+    m_blend_     .reset();
+    m_blend_func_.reset();
+    m_cull_      .reset();
+    m_cull_face_ .reset();
+} // Invalidate
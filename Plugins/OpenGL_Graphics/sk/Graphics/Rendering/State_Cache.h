@@ -0,0 +1,134 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include <glbinding/gl/types.h>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace sk::Graphics::Rendering
+{
+    // Shadows the GL state set while drawing, so setting something to what it already is doesn't reach the driver.
+    // Vertex arrays are only changed through the direct state access functions, and the active texture unit is always left at 0.
+    // Everything going through here has to stay on the GL thread.
+    class cState_Cache
+    {
+    public:
+        struct sStats
+        {
+            // Calls that reached GL.
+            size_t calls   = 0;
+            // Calls turned into nothing as the state was already set.
+            size_t skipped = 0;
+        };
+
+        static auto get() -> cState_Cache&;
+
+        void UseProgram     ( gl::GLuint _program );
+        void BindVertexArray( gl::GLuint _vertex_array );
+
+        // Enables the attributes below the count and disables the rest.
+        void SetAttributeCount  ( gl::GLuint _vertex_array, uint32_t _count );
+        // Also binds the attribute to the vertex buffer binding of the same index.
+        void SetAttributeFormat ( gl::GLuint _vertex_array, gl::GLuint _index, gl::GLint _components, gl::GLenum _type );
+        void BindVertexBuffer   ( gl::GLuint _vertex_array, gl::GLuint _binding, gl::GLuint _buffer, gl::GLsizei _stride );
+        void BindElementBuffer  ( gl::GLuint _vertex_array, gl::GLuint _buffer );
+
+        // For GL_UNIFORM_BUFFER and GL_SHADER_STORAGE_BUFFER.
+        void BindBufferBase     ( gl::GLenum _target, gl::GLuint _index, gl::GLuint _buffer );
+        void BindBufferRange    ( gl::GLenum _target, gl::GLuint _index, gl::GLuint _buffer, size_t _offset, size_t _size );
+        void UniformBlockBinding( gl::GLuint _program, gl::GLuint _block, gl::GLuint _binding );
+        void BindTextureUnit    ( gl::GLuint _unit, gl::GLuint _texture );
+        void SetSamplerUnit     ( gl::GLuint _program, gl::GLint _location, gl::GLint _unit );
+
+        void SetDepthTest( bool _enabled );
+        void SetDepthFunc( gl::GLenum _func );
+        void SetBlend    ( bool _enabled );
+        void SetBlendFunc( gl::GLenum _source, gl::GLenum _destination );
+        void SetCullFace ( bool _enabled, gl::GLenum _face = gl::GLenum::GL_BACK );
+
+        // Has to be called before the object is deleted, as GL is free to hand the name out again.
+        void ForgetBuffer     ( gl::GLuint _buffer );
+        void ForgetTexture    ( gl::GLuint _texture );
+        void ForgetVertexArray( gl::GLuint _vertex_array );
+        // Linking resets the block and sampler bindings kept by the program, so it has to be forgotten after relinking as well.
+        void ForgetProgram    ( gl::GLuint _program );
+
+        // For when something outside of the cache has changed the state.
+        void Invalidate();
+
+        [[ nodiscard ]] auto& GetStats() const { return m_stats_; }
+        void ResetStats(){ m_stats_ = {}; }
+
+    private:
+        static constexpr gl::GLuint kUnknown = std::numeric_limits< gl::GLuint >::max();
+
+        struct sAttribute
+        {
+            gl::GLint  components = 0;
+            gl::GLenum type       = gl::GLenum::GL_INVALID_ENUM;
+        };
+
+        struct sVertex_Buffer
+        {
+            gl::GLuint  buffer = kUnknown;
+            gl::GLsizei stride = 0;
+        };
+
+        struct sBuffer_Range
+        {
+            gl::GLuint buffer = kUnknown;
+            size_t     offset = 0;
+            // 0 when the whole buffer is bound.
+            size_t     size   = 0;
+
+            bool operator==( const sBuffer_Range& ) const = default;
+        };
+
+        struct sVertex_Array
+        {
+            // Attributes not in the mask are disabled, matching a freshly created vertex array.
+            uint32_t                      enabled         = 0;
+            gl::GLuint                    element_buffer  = kUnknown;
+            std::vector< sAttribute >     attributes;
+            std::vector< sVertex_Buffer > vertex_buffers;
+        };
+
+        // Returns true if the value changed, which means the call has to be made.
+        template< class Ty >
+        bool set( Ty& _current, const Ty& _value );
+
+        static auto program_key( gl::GLuint _program, uint32_t _index ) -> uint64_t;
+
+        gl::GLuint m_program_      = kUnknown;
+        gl::GLuint m_vertex_array_ = kUnknown;
+
+        std::unordered_map< gl::GLuint, sVertex_Array > m_vertex_arrays_;
+
+        std::vector< sBuffer_Range > m_uniform_buffers_;
+        std::vector< sBuffer_Range > m_storage_buffers_;
+        std::vector< gl::GLuint >    m_texture_units_;
+
+        // Block and sampler bindings are kept by the program, keyed by the program and the block or location.
+        std::unordered_map< uint64_t, gl::GLuint > m_block_bindings_;
+        std::unordered_map< uint64_t, gl::GLint >  m_sampler_units_;
+
+        std::optional< bool >       m_depth_test_;
+        std::optional< gl::GLenum > m_depth_func_;
+        std::optional< bool >       m_blend_;
+        std::optional< std::array< gl::GLenum, 2 > > m_blend_func_;
+        std::optional< bool >       m_cull_;
+        std::optional< gl::GLenum > m_cull_face_;
+
+        sStats m_stats_;
+    };
+} // sk::Graphics::Rendering
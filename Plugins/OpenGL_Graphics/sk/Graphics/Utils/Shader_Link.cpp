@@ -3,6 +3,7 @@
 #include "Shader_Link.h"
 
 #include <sk/Assets/Material.h>
+#include <sk/Graphics/Rendering/State_Cache.h>
 #include <sk/Graphics/Utils/Shader_Reflection.h>
 
 #include <glbinding/gl/functions.h>
@@ -80,7 +81,7 @@ auto sk::Graphics::Utils::cShader_Link::GetReflection() const -> cShared_ptr< cS
 
 void sk::Graphics::Utils::cShader_Link::Use() const
 {
-    gl::glUseProgram( m_program_ );
+    Rendering::cState_Cache::get().UseProgram( m_program_ );
 }
 
 void sk::Graphics::Utils::cShader_Link::on_shader_changed( const Assets::eEventType _event, cAsset_Ref< Assets::cShader >& )
@@ -100,6 +101,7 @@ void sk::Graphics::Utils::cShader_Link::link_shaders()
     gl::glAttachShader( m_program_, m_vertex_shader_->m_shader_ );
     gl::glAttachShader( m_program_, m_fragment_shader_->m_shader_ );
     gl::glLinkProgram( m_program_ );
+    Rendering::cState_Cache::get().ForgetProgram( m_program_ );
     
     m_has_updated_ = true;
     m_is_linked_   = true;
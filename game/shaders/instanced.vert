@@ -0,0 +1,43 @@
+#version 430 core
+
+layout ( location = 0 ) in vec3 aPosition;
+layout ( location = 1 ) in vec3 aNormal;
+layout ( location = 2 ) in vec2 aTexCoord;
+
+out vec4 WorldPos;
+out vec3 WorldNormal;
+out vec2 TexCoord;
+
+struct sInstance
+{
+    mat4 world;
+    mat4 inverse_world;
+};
+
+layout( std430, binding = 0 ) readonly buffer _Instances
+{
+    sInstance instances[];
+};
+
+layout( std140 ) uniform _Camera
+{
+    mat4 view_proj;
+};
+
+layout( std140 ) uniform _Instancing
+{
+    uint first_instance;
+};
+
+void main()
+{
+    sInstance instance = instances[ first_instance + gl_InstanceID ];
+
+    WorldPos = instance.world * vec4( aPosition, 1.0f );
+
+    WorldNormal = mat3( transpose( instance.inverse_world ) ) * aNormal;
+
+    TexCoord = aTexCoord;
+
+    gl_Position = view_proj * WorldPos;
+}
\ No newline at end of file
@@ -89,6 +89,7 @@ void cApp::create( void )
 	auto list_2 = asset_m.loadFile( "models/heheToiletwithtextures.glb" );
 	const auto shader_frag = *asset_m.loadFile( "shaders/gpass.frag" ).begin();
 	const auto shader_vert = *asset_m.loadFile( "shaders/default.vert" ).begin();
+	const auto instanced_vert = *asset_m.loadFile( "shaders/instanced.vert" ).begin();
 	asset_m.loadFile( "shaders/screen.vert" );
 	asset_m.loadFile( "shaders/deferred.frag" );
 	
@@ -105,8 +106,9 @@ void cApp::create( void )
 	m_scene = sk::make_shared< sk::cScene >();
 	m_scene->create_object< sk::Object::cCameraFlight >( "Camera Free Flight" )->setAsMain();
 	
+	// Shared by the clones, so it's instanced.
 	auto mat1 = asset_m.CreateAsset< sk::Assets::cMaterial >( "Material Test",
-		sk::Graphics::Utils::cShader_Link{ shader_vert, shader_frag } );
+		sk::Graphics::Utils::cShader_Link{ instanced_vert, shader_frag } );
 	mat1.second->SetTexture( "mainTexture", christopher_t );
 
 	auto mesh = m_scene->create_object< sk::Object::iObject >( "Mesh Test 2" );
@@ -139,7 +141,7 @@ void cApp::create( void )
 	{
 		for( int64_t y = -kGridWidth; y < kGridWidth; ++y )
 		{
-			auto mesh_object = m_scene->create_object< sk::Object::iObject >( "Clone" );
+			auto mesh_object = m_scene->Instantiate( "Clone" );
 			mesh_object->GetTransform().SetPosition( { x * 2, 0.0f, y * 2 } );
 			auto spin = mesh_object->AddComponent< sk::Object::Components::cSpinComponent >( sk::cVector3f{ 0.0f, dis( gen ), 0.0f } );
 			auto mesh_component = mesh_object->AddComponent< sk::Object::Components::cMeshComponent >( christopher_m, mat1.first );
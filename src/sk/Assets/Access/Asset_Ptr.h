@@ -7,6 +7,9 @@
 #pragma once
 
 #include <sk/Assets/Access/Asset_Ptr_Base.h>
+#include <sk/Misc/Future.h>
+
+#include <coroutine>
 
 namespace sk
 {
@@ -43,6 +46,10 @@ namespace sk
 
         [[ nodiscard ]] auto GetAsset() const -> Ty*;
 
+        // Suspends the coroutine until the asset is loaded, requesting it if needed.
+        // Won't suspend or allocate if the asset is already loaded.
+        auto operator co_await();
+
         // Dispatchers
         load_dispatcher_t   on_asset_loaded;
         update_dispatcher_t on_asset_updated;
@@ -119,6 +126,57 @@ namespace sk
         return static_cast< Ty* >( GetAssetRaw() );
     }
 
+    template< reflected Ty > requires std::is_base_of_v< cAsset, Ty >
+    auto cAsset_Ptr< Ty >::operator co_await()
+    {
+        struct sAwaiter
+        {
+            cAsset_Ptr& ptr;
+            // Set when suspending, the asset is read from the meta as the pointer might not have seen the event yet.
+            cShared_ptr< cAsset_Meta > meta = nullptr;
+
+            [[ nodiscard ]] bool await_ready() const { return ptr.IsLoaded(); }
+
+            bool await_suspend( const std::coroutine_handle<> _handle )
+            {
+                // Requesting an asset which is already loaded sets the pointer right away, so there's nothing to listen for.
+                if( !ptr.IsRequested() )
+                    ptr.LoadAsync();
+
+                if( ptr.IsLoaded() )
+                    return false;
+
+                meta = ptr.GetMeta();
+
+                // The listener might resume the coroutine before adding it returns, freeing the frame this awaiter lives in.
+                // Only locals can be touched once it has been added.
+                const auto state   = meta;
+                const auto resumed = sk::make_shared< std::atomic_bool >( false );
+                ptr.on_asset_loaded += typename load_dispatcher_t::weak_listener_t(
+                    [ _handle, resumed ]( Ty& )
+                    {
+                        if( !resumed->exchange( true ) )
+                            _handle.resume();
+                        return false;
+                    } );
+
+                // The asset might have finished loading before the listener was added, in which case it's never called.
+                // Returning false resumes right away.
+                return !state->IsLoaded() || resumed->exchange( true );
+            }
+
+            auto await_resume() const -> Ty&
+            {
+                if( meta != nullptr )
+                    return *static_cast< Ty* >( meta->GetAsset() );
+
+                return *ptr.GetAsset();
+            }
+        };
+
+        return sAwaiter{ *this };
+    }
+
     template< reflected Ty > requires std::is_base_of_v< cAsset, Ty >
     auto cAsset_Ptr< Ty >::validate_asset( const cShared_ptr< cAsset_Meta >& _meta ) const -> cShared_ptr< cAsset_Meta >
     {
@@ -161,6 +219,7 @@ namespace sk
             on_asset_loaded.push_event( *asset );
             
             m_asset_.notify_all();
+            Async::Notify();
             break;
         case Assets::eEventType::kUpdated:
             m_asset_.store( asset );
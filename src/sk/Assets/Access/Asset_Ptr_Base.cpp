@@ -7,7 +7,7 @@
 #include "Asset_Ptr_Base.h"
 
 #include <sk/Assets/Asset.h>
-#include <sk/Graphics/Renderer.h>
+#include <sk/Misc/Future.h>
 
 using namespace sk;
 
@@ -71,6 +71,11 @@ bool cAsset_Ptr_Base::IsLoaded() const
     return IsValid() && m_meta_->IsLoaded() && has_data();
 }
 
+bool cAsset_Ptr_Base::IsRequested() const
+{
+    return m_asset_.load() != nullptr;
+}
+
 bool cAsset_Ptr_Base::SetAsset( const cShared_ptr< cAsset_Meta >& _meta )
 {
     if( IsLoaded() )
@@ -99,7 +104,8 @@ auto cAsset_Ptr_Base::LoadSync() -> cAsset*
     
     LoadAsync();
     
-    m_asset_.wait( nullptr );
+    // Helps out with the GL tasks while waiting, and with the asset jobs on a worker, as they might be what we're waiting for.
+    Async::WaitUntil( [ this ]{ return m_asset_.load() != has_requested_ptr_; } );
 
     return m_asset_;
 }
@@ -119,12 +125,7 @@ void cAsset_Ptr_Base::WaitUntilLoaded() const
 {
     if( const auto asset = m_asset_.load(); asset == has_requested_ptr_ )
     {
-        // TODO: Make this prettier
-        while( !IsLoaded() )
-        {
-            Graphics::cRenderer::get().Update();
-            std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
-        }
+        Async::WaitUntil( [ this ]{ return IsLoaded() || m_asset_.load() != has_requested_ptr_; } );
     }
     else if( asset == nullptr )
         SK_WARNING( sk::Severity::kEngine, "Warning: Tried to wait for asset not requested to be loaded." )
@@ -34,6 +34,8 @@ namespace sk
         [[ nodiscard ]] auto GetAssetRaw() const -> cAsset*;
         [[ nodiscard ]] auto GetMeta() const -> cShared_ptr< cAsset_Meta >;
         [[ nodiscard ]] bool IsLoaded() const;
+        // True if the asset is loaded or has been requested to load through this pointer.
+        [[ nodiscard ]] bool IsRequested() const;
 
         bool SetAsset( const cShared_ptr< cAsset_Meta >& _meta );
 
@@ -3,9 +3,13 @@
 #include "Asset_Job_Manager.h"
 
 #include <sk/Assets/Workers/Asset_Loader.h>
-#include <sk/Graphics/Renderer.h>
+#include <sk/Misc/Future.h>
 
-#include <chrono>
+namespace
+{
+    // Set by the asset workers when they start.
+    thread_local bool is_worker_thread = false;
+} // ::
 
 sk::Assets::Jobs::cAsset_Job_Manager::cAsset_Job_Manager()
 {
@@ -13,6 +17,7 @@ sk::Assets::Jobs::cAsset_Job_Manager::cAsset_Job_Manager()
 
     m_head_.store( 0 );
     m_tail_.store( 0 );
+    m_in_flight_.store( 0 );
     
     // Magic numbers my beloved. But this should create a pretty balanced amount of asset loaders.
     m_worker_count_ = std::max( 1u, std::thread::hardware_concurrency() / 3 );
@@ -24,17 +29,22 @@ sk::Assets::Jobs::cAsset_Job_Manager::cAsset_Job_Manager()
         worker.m_active_.store( true );
         worker.m_thread_ = std::thread{ &cAsset_Worker::worker, &worker };
     }
+
+    Async::AddHelper( &help );
 }
 
 sk::Assets::Jobs::cAsset_Job_Manager::~cAsset_Job_Manager()
 {
     Sync();
+
+    Async::RemoveHelper( &help );
     
     for( size_t i = 0; i < m_worker_count_; ++i )
         m_workers_[ i ].m_active_.store( false );
 
-    m_head_.store( m_tasks_.size() + 1 );
-    m_head_.notify_all();
+    // Empty tasks to wake up every worker so they can see that they're no longer active.
+    for( size_t i = 0; i < m_worker_count_; ++i )
+        push_task( sTask{ .type = eJobType::kNone, .data = nullptr } );
     
     for( size_t i = 0; i < m_worker_count_; ++i )
         m_workers_[ i ].m_thread_.join();
@@ -42,53 +52,39 @@ sk::Assets::Jobs::cAsset_Job_Manager::~cAsset_Job_Manager()
 
 void sk::Assets::Jobs::cAsset_Job_Manager::Sync()
 {
-    while( IsDoingWork() )
-    {
-        Graphics::cRenderer::get().Update();
-        std::this_thread::sleep_for( std::chrono::milliseconds{ 10 } );
-    }
+    Async::WaitUntil( [ this ]{ return !IsDoingWork(); } );
 }
 
 bool sk::Assets::Jobs::cAsset_Job_Manager::IsDoingWork() const
 {
-    return std::any_of( m_workers_, m_workers_ + m_worker_count_,
-        []( auto& _worker ){ return _worker.m_working_.load(); } );
+    // The queue has to be checked first, as a task is counted as in flight before it leaves the queue.
+    if( m_head_.load() != m_tail_.load() )
+        return true;
+
+    return m_in_flight_.load() != 0;
 }
 
 auto sk::Assets::Jobs::cAsset_Job_Manager::WaitForTask( const std::atomic_bool& _working_ref ) -> sTask
 {
-    if( m_currently_resizing_.load() )
-        m_currently_resizing_.wait( true );
-    
-    if( const auto tail = m_tail_.load(); tail == m_head_.load() )
-        m_head_.wait( tail );
-
-    // The worker is no longer active.
-    if( !_working_ref.load() )
-        return {};
-
-    ++m_currently_getting_work_;
-    
-    if( m_available_.load() != 0 )
-        --m_available_;
-    
-    auto new_tail = ++m_tail_;
-    if( new_tail >= m_tasks_.size() )
+    auto task = sTask{};
+    while( _working_ref.load() )
     {
-        new_tail = 0;
-        m_tail_.store( new_tail );
+        if( try_claim_task( task ) )
+            return task;
+
+        // The head only ever changes when something gets pushed.
+        if( const auto head = m_head_.load(); head == m_tail_.load() )
+            m_head_.wait( head );
     }
-    m_tail_.notify_one();
-    
-    auto task = sTask{};
-    std::swap( task, m_tasks_[ new_tail ] );
-    
-    --m_currently_getting_work_;
-    m_currently_getting_work_.notify_one();
 
     return task;
 }
 
+void sk::Assets::Jobs::cAsset_Job_Manager::sWorker_Awaiter::await_suspend( const std::coroutine_handle<> _handle ) const
+{
+    get().push_task( sTask{ .type = eJobType::kResume, .data = _handle.address() } );
+}
+
 auto sk::Assets::Jobs::cAsset_Job_Manager::GetWorkerCount() const -> size_t
 {
     return m_worker_count_;
@@ -99,60 +95,110 @@ bool sk::Assets::Jobs::cAsset_Job_Manager::IsShuttingDown() const
     return m_shutting_down_.load();
 }
 
+bool sk::Assets::Jobs::cAsset_Job_Manager::IsWorkerThread()
+{
+    return is_worker_thread;
+}
+
+void sk::Assets::Jobs::cAsset_Job_Manager::mark_worker_thread()
+{
+    is_worker_thread = true;
+}
+
 void sk::Assets::Jobs::cAsset_Job_Manager::push_task( const sTask& _task )
 {
-    // TODO: Figure out a way to resize the task list.
-    const auto requested_head = m_head_.load() + 1;
-    
-    auto new_head = requested_head % m_tasks_.size();
-    
-    if( new_head == m_tail_.load() )
-        resize( m_tasks_.size() * 2 );
-    else if( const auto half_size = m_tasks_.size() / 2; m_available_.load() < half_size && half_size > 64 )
-        resize( std::max< size_t >( half_size, distance() ) );
-    
-    new_head = requested_head % m_tasks_.size();
+    {
+        std::scoped_lock lock( m_queue_mtx_ );
+
+        const auto size = m_tasks_.size();
+        if( ( m_head_.load() + 1 ) % size == m_tail_.load() )
+            resize( size * 2 );
+        else if( const auto half_size = size / 2; m_available_.load() < half_size / 2 && half_size > 64 )
+            resize( half_size );
+
+        const auto new_head = ( m_head_.load() + 1 ) % m_tasks_.size();
+        m_tasks_[ new_head ] = _task;
+
+        ++m_available_;
+
+        m_head_.store( new_head );
+    }
 
-    m_tasks_[ new_head ] = _task;
-    
-    ++m_available_;
-    
-    m_head_.store( new_head );
     m_head_.notify_one();
+    Async::Notify();
+}
+
+bool sk::Assets::Jobs::cAsset_Job_Manager::try_claim_task( sTask& _task )
+{
+    std::scoped_lock lock( m_queue_mtx_ );
+
+    const auto tail = m_tail_.load();
+    if( tail == m_head_.load() )
+        return false;
+
+    const auto new_tail = ( tail + 1 ) % m_tasks_.size();
+
+    _task = sTask{};
+    std::swap( _task, m_tasks_[ new_tail ] );
+
+    // Has to be counted before the task leaves the queue, otherwise IsDoingWork might miss it.
+    if( _task.type != eJobType::kNone )
+        ++m_in_flight_;
+
+    --m_available_;
+    m_tail_.store( new_tail );
+
+    return true;
+}
+
+void sk::Assets::Jobs::cAsset_Job_Manager::complete_task()
+{
+    --m_in_flight_;
+    Async::Notify();
 }
 
 void sk::Assets::Jobs::cAsset_Job_Manager::resize( const size_t _new_size )
 {
-    // We wait for the workers to complete their current tasks.
-    // TODO: Move the head and tail when resizing.
-    if( const auto working = m_currently_getting_work_.load(); working != 0 )
-        m_currently_getting_work_.wait( working );
-    
-    m_currently_resizing_.store( true );
-    
-    std::vector< sTask > new_vec( _new_size );
-    const auto head = m_head_.load();
-    auto tail = m_tail_.load();
-    
-    // TODO: Figure out why the distance between the head and the tail is so huge.
-    for( size_t i = 0; tail != head; ++tail, i++ )
-    {
-        tail = tail % m_tasks_.size();
-        new_vec[ i ] = m_tasks_[ tail ];
-    }
+    // Expects the queue mutex to be held.
+    const auto count = distance();
+    const auto old_size = m_tasks_.size();
+
+    std::vector< sTask > new_vec( std::max( _new_size, count + 1 ) );
+
+    // Slot 0 becomes the new tail, which is always the last consumed slot.
+    const auto tail = m_tail_.load();
+    for( size_t i = 0; i < count; i++ )
+        new_vec[ i + 1 ] = m_tasks_[ ( tail + 1 + i ) % old_size ];
+
     m_tasks_.swap( new_vec );
     m_tail_.store( 0 );
-    
-    m_currently_resizing_.store( false );
-    m_currently_resizing_.notify_all();
+    m_head_.store( count );
 }
 
 auto sk::Assets::Jobs::cAsset_Job_Manager::distance() const -> size_t
 {
-    const auto head = m_head_.load();
-    const auto tail = m_tail_.load();
-    if( head > tail )
-        return std::abs( static_cast< int64_t >( head ) - static_cast< int64_t >( tail ) );
-    
-    return m_tasks_.size() - tail + head;
+    const auto size = m_tasks_.size();
+    return ( m_head_.load() + size - m_tail_.load() ) % size;
+}
+
+bool sk::Assets::Jobs::cAsset_Job_Manager::help()
+{
+    if( !is_worker_thread )
+        return false;
+
+    const auto self = getPtr();
+    if( self == nullptr )
+        return false;
+
+    auto task = sTask{};
+    if( !self->try_claim_task( task ) )
+        return false;
+
+    if( task.type == eJobType::kNone )
+        return false;
+
+    cAsset_Worker::do_work( task );
+    self->complete_task();
+
+    return true;
 }
@@ -9,30 +9,57 @@
 #include <sk/Assets/Management/Asset_Manager.h>
 #include <sk/Assets/Workers/WorkerTask.h>
 
+#include <coroutine>
+#include <mutex>
+
 namespace sk::Assets::Jobs
 {
     class cAsset_Job_Manager : public cSingleton< cAsset_Job_Manager >
     {
         friend class sk::cAsset_Manager;
         friend class sk::cAsset_Meta;
+        friend class cAsset_Worker;
     public:
+        struct sWorker_Awaiter
+        {
+            [[ nodiscard ]] bool await_ready() const noexcept { return false; }
+            void await_suspend( std::coroutine_handle<> _handle ) const;
+            void await_resume () const noexcept {}
+        };
+
         cAsset_Job_Manager();
         ~cAsset_Job_Manager() override;
         
+        // Blocks until every queued task is done. Only the asset workers run queued tasks while waiting.
         void Sync();
 
         bool IsDoingWork() const;
 
+        // The task returned has to be completed with complete_task.
         auto WaitForTask( const std::atomic_bool& _working_ref ) -> sTask;
         
         auto GetWorkerCount() const -> size_t;
         
         bool IsShuttingDown() const;
 
+        // True on the asset worker threads, the only threads allowed to run asset tasks.
+        static bool IsWorkerThread();
+
+        // co_await to continue the current coroutine on one of the asset workers.
+        static auto ResumeOnWorker() -> sWorker_Awaiter { return {}; }
+
     private:
-        void push_task( const sTask& _task );
-        void resize   ( size_t _new_size );
-        auto distance () const -> size_t;
+        void push_task     ( const sTask& _task );
+        bool try_claim_task( sTask& _task );
+        void complete_task ();
+        void resize        ( size_t _new_size );
+        auto distance      () const -> size_t;
+
+        static void mark_worker_thread();
+
+        // Used by Async::WaitUntil to run tasks on waiting asset workers.
+        // Other threads never help, as tasks can do blocking file IO and expect to be off the main thread.
+        static bool help();
 
         using workers_t = cAsset_Worker*;
         
@@ -43,9 +70,12 @@ namespace sk::Assets::Jobs
         
         std::atomic_uint32_t m_available_;
         
-        std::atomic_uint16_t m_currently_getting_work_;
-        std::atomic_bool     m_currently_resizing_;
         std::atomic_bool     m_shutting_down_;
+        // Tasks that have been claimed but not yet completed.
+        std::atomic_size_t   m_in_flight_;
+
+        // Guards the task list, both ends of the queue are short enough for a plain mutex.
+        std::mutex m_queue_mtx_;
 
         size_t      m_worker_count_;
 		workers_t   m_workers_;
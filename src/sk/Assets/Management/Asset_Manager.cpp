@@ -11,15 +11,48 @@
 #include <sk/Assets/Texture.h>
 #include <sk/Assets/Management/Asset_Job_Manager.h>
 #include <sk/Assets/Utils/Asset_List.h>
+#include <sk/Assets/Utils/Mesh_Simplifier.h>
 #include <sk/Graphics/Buffer/Dynamic_Buffer.h>
+#include <sk/Misc/Future.h>
+#include <sk/Misc/Task.h>
 #include <sk/Scene/Managers/CameraManager.h>
 
 #include <fastgltf/tools.hpp>
 
 #include <any>
+#include <functional>
 
 namespace sk
 {
+	namespace
+	{
+		auto run_on_worker( const std::function< void() > _function ) -> cTask<>
+		{
+			co_await Assets::Jobs::cAsset_Job_Manager::ResumeOnWorker();
+
+			_function();
+		} // run_on_worker
+
+		// Hands every item but the last out to the asset workers, the calling thread takes the last one instead of idling.
+		// Waiting on a worker helps with the queued items, any other thread only helps with GL tasks, which the items might need.
+		template< class Ty, class Fn >
+		void for_each_on_workers( std::vector< Ty >& _items, const Fn& _function )
+		{
+			if( _items.empty() )
+				return;
+
+			std::vector< cFuture< void > > jobs;
+			jobs.reserve( _items.size() - 1 );
+			for( size_t i = 0; i + 1 < _items.size(); i++ )
+				jobs.emplace_back( run_on_worker( [ &_items, &_function, i ]{ _function( _items[ i ] ); } ).Start() );
+
+			_function( _items.back() );
+
+			for( const auto& job : jobs )
+				job.Wait();
+		} // for_each_on_workers
+	} // ::
+
 	cAsset_Manager::cAsset_Manager()
 	{
 		std::filesystem::current_path( SK_ROOT_DIR );
@@ -145,46 +178,121 @@ namespace sk
 
 	cUUID cAsset_Manager::registerAsset( const cShared_ptr< cAsset_Meta >& _asset, const bool _reload )
 	{
-		// TODO: Add check if asset already exists.
-		if( _asset->m_uuid_ == cUUID::kInvalid )
+		bool inserted;
 		{
-			// New asset, provide an uuid to it and register it.
-			const auto id = GenerateRandomUUID();
-			m_assets_[ id ] = _asset;
-			_asset->m_uuid_   = id;
-			m_asset_name_map_.insert( { _asset->GetName().hash(),  _asset } );
-			m_asset_path_map_.insert( { _asset->GetAbsolutePath(), _asset } );
+			std::scoped_lock lock( m_asset_mtx_ );
+			inserted = insertAsset( _asset );
 		}
-		else if( _reload )
+
+		if( !inserted && _reload )
 			_asset->Reload();
 
 		return _asset->m_uuid_;
 	} // registerAsset
 
-	auto cAsset_Manager::loadFolder( const std::filesystem::path& _path, const bool _recursive, const bool _reload ) -> Assets::cAsset_List
+	void cAsset_Manager::registerAssets( const Assets::cAsset_List& _assets, const bool _reload )
 	{
-		Assets::cAsset_List assets;
-
-		// TODO: Implament loading folders.
-		if( _recursive )
+		std::vector< cShared_ptr< cAsset_Meta > > to_reload;
 		{
-			std::filesystem::recursive_directory_iterator iter( _path );
-			for( const auto& file : iter )
+			std::scoped_lock lock( m_asset_mtx_ );
+
+			const auto count = _assets.m_assets_.size();
+			m_assets_        .reserve( m_assets_        .size() + count );
+			m_asset_name_map_.reserve( m_asset_name_map_.size() + count );
+			m_asset_path_map_.reserve( m_asset_path_map_.size() + count );
+
+			for( auto& asset : _assets )
 			{
-				// Look into making it safe. https://en.cppreference.com/w/cpp/filesystem/directory_entry.html
-				if( file.is_regular_file() )
-					assets += loadFile( file.path(), _reload );
+				if( !insertAsset( asset ) && _reload )
+					to_reload.emplace_back( asset );
 			}
 		}
-		else
+
+		// Reloading pushes tasks, no need to hold the lock for it.
+		for( auto& asset : to_reload )
+			asset->Reload();
+	} // registerAssets
+
+	bool cAsset_Manager::insertAsset( const cShared_ptr< cAsset_Meta >& _asset )
+	{
+		// TODO: Add check if asset already exists.
+		if( _asset->m_uuid_ != cUUID::kInvalid )
+			return false;
+
+		// New asset, provide an uuid to it and register it.
+		const auto id = GenerateRandomUUID();
+		m_assets_[ id ] = _asset;
+		_asset->m_uuid_   = id;
+		m_asset_name_map_.insert( { _asset->GetName().hash(),  _asset } );
+		m_asset_path_map_.insert( { _asset->GetAbsolutePath(), _asset } );
+
+		return true;
+	} // insertAsset
+
+	auto cAsset_Manager::loadFolder( const std::filesystem::path& _path, const bool _recursive, const bool _reload ) -> Assets::cAsset_List
+	{
+		using path_vec_t = std::vector< std::filesystem::path >;
+
+		path_vec_t files;
+		path_vec_t directories;
+		for( const auto& entry : std::filesystem::directory_iterator( _path, std::filesystem::directory_options::skip_permission_denied ) )
 		{
-			std::filesystem::directory_entry iter( _path );
+			if( entry.is_regular_file() )
+				files.emplace_back( entry.path() );
+			else if( _recursive && entry.is_directory() )
+				directories.emplace_back( entry.path() );
 		}
 
+		// Each sub directory is walked on its own worker.
+		if( !directories.empty() )
+		{
+			std::vector< path_vec_t > directory_files( directories.size() );
+			for_each_on_workers( directories, [ & ]( const std::filesystem::path& _directory )
+			{
+				auto& found = directory_files[ &_directory - directories.data() ];
+				for( const auto& entry : std::filesystem::recursive_directory_iterator( _directory, std::filesystem::directory_options::skip_permission_denied ) )
+				{
+					if( entry.is_regular_file() )
+						found.emplace_back( entry.path() );
+				}
+			} );
+
+			for( auto& found : directory_files )
+				files.insert( files.end(), std::make_move_iterator( found.begin() ), std::make_move_iterator( found.end() ) );
+		}
+
+		if( files.empty() )
+			return {};
+
+		// Every worker, and the calling thread, stages its own metas, which then get registered all at once.
+		// The files are strided between them, as a few large files next to each other would otherwise end up on the same thread.
+		const auto stage_count = std::min< size_t >( files.size(), Assets::Jobs::cAsset_Job_Manager::get().GetWorkerCount() + 1 );
+		std::vector< Assets::cAsset_List > staged( stage_count );
+		for_each_on_workers( staged, [ & ]( Assets::cAsset_List& _metas )
+		{
+			for( size_t i = &_metas - staged.data(); i < files.size(); i += stage_count )
+				loadFileMeta( files[ i ], _metas );
+		} );
+
+		Assets::cAsset_List assets;
+		for( auto& metas : staged )
+			assets += std::move( metas );
+
+		registerAssets( assets, _reload );
+
 		return assets;
 	} // loadFolder
 
 	auto cAsset_Manager::loadFile( const std::filesystem::path& _path, const bool _reload ) -> Assets::cAsset_List
+	{
+		Assets::cAsset_List assets;
+		loadFileMeta( _path, assets );
+		registerAssets( assets, _reload );
+
+		return assets;
+	} // loadFile
+
+	void cAsset_Manager::loadFileMeta( const std::filesystem::path& _path, Assets::cAsset_List& _metas ) const
 	{
 		auto ext = _path.extension().string();
 		SK_ERR_IF( ext.empty(),
@@ -197,7 +305,7 @@ namespace sk
 		const auto callback_pair = m_load_callbacks_.find( extension );
 
 		if( callback_pair == m_load_callbacks_.end() )
-			return {};
+			return;
 
 		const auto absolute_path = getAbsolutePath( _path );
 
@@ -205,13 +313,10 @@ namespace sk
 		callback_pair->second( absolute_path, assets, Assets::eAssetTask::kLoadMeta );
 
 		for( auto& asset : assets )
-		{
 			asset->setPath( absolute_path );
-			registerAsset( asset );
-		}
 
-		return assets;
-	} // loadFile
+		_metas += std::move( assets );
+	} // loadFileMeta
 
 	auto cAsset_Manager::getAbsolutePath( const std::filesystem::path& _path ) -> std::filesystem::path
 	{
@@ -327,21 +432,24 @@ namespace sk
 			}
 		}
 		
-		auto [ mesh_fst, mesh_lst ] = _metas.GetRange< Assets::cMesh >();
-		for( size_t i = 0; i < asset.meshes.size(); i++ )
+		if( _load_task == Assets::eAssetTask::kLoadMeta )
 		{
-			if( _load_task == Assets::eAssetTask::kLoadMeta )
-			{
-				auto& mesh = asset.meshes[ i ];
-				_metas.AddAsset( createGltfMeshMeta( mesh, i ) );
-			}
-			else
+			for( size_t i = 0; i < asset.meshes.size(); i++ )
+				_metas.AddAsset( createGltfMeshMeta( asset.meshes[ i ], i ) );
+		}
+		else
+		{
+			std::vector< cAsset_Meta* > mesh_metas;
+			for( auto [ mesh_fst, mesh_lst ] = _metas.GetRange< Assets::cMesh >(); mesh_fst != mesh_lst; ++mesh_fst )
+				mesh_metas.emplace_back( mesh_fst->second.get() );
+
+			// The meshes don't depend on each other, so they're imported on the workers as the LOD generation is fairly heavy.
+			// Their buffers are created through GL tasks, which the main thread runs even while it's waiting on this file.
+			for_each_on_workers( mesh_metas, [ & ]( cAsset_Meta* _meta )
 			{
-				auto& meta = *mesh_fst->second;
-				auto& mesh = asset.meshes[ std::any_cast< size_t >( meta.m_info_[ "gltf_index" ] ) ];
-				handleGltfMesh( meta, asset, mesh, _load_task );
-				++mesh_fst;
-			}
+				auto& mesh = asset.meshes[ std::any_cast< size_t >( _meta->m_info_[ "gltf_index" ] ) ];
+				handleGltfMesh( *_meta, asset, mesh, _load_task );
+			} );
 		}
 
 		if( _load_task == Assets::eAssetTask::kLoadMeta )
@@ -536,6 +644,29 @@ namespace sk
 				}
 			}
 		}
+
+		void generate_lods( Assets::cMesh& _mesh )
+		{
+			auto& vertex_buffers = _mesh.GetVertexBuffers();
+			const auto positions = vertex_buffers.find( "POSITION" );
+			if( positions == vertex_buffers.end() || positions->second->GetItemType() != &kTypeInfo< cVector3f > )
+				return;
+
+			const auto& index_buffer = *_mesh.GetIndexBuffer();
+
+			std::vector< uint32_t > indices( index_buffer.GetSize() );
+			if( index_buffer.GetItemSize() == sizeof( uint16_t ) )
+				std::ranges::copy( std::span( index_buffer.Data< uint16_t >(), indices.size() ), indices.begin() );
+			else
+				std::ranges::copy( std::span( index_buffer.Data< uint32_t >(), indices.size() ), indices.begin() );
+
+			const auto& position_buffer = *positions->second;
+			const auto  lods = Assets::Utils::GenerateLods( indices.data(), indices.size(),
+				position_buffer.RawData(), position_buffer.GetSize(), position_buffer.GetItemSize() );
+
+			for( auto& [ lod_indices, error ] : lods )
+				_mesh.AddLod( lod_indices.data(), lod_indices.size(), error );
+		}
 	} // ::
 
 	void cAsset_Manager::handleGltfMesh( cAsset_Meta& _meta, const fastgltf::Asset& _asset, fastgltf::Mesh& _mesh, const Assets::eAssetTask _task )
@@ -554,6 +685,13 @@ namespace sk
 
 			fill_vertex_buffers( *mesh_asset, _asset, primitive.attributes.data(), primitive.attributes.size() );
 
+			mesh_asset->ComputeBounds();
+
+			generate_lods( *mesh_asset );
+
+			if( get().GetBuildMeshlets() )
+				mesh_asset->BuildMeshlets();
+
 			// TODO: Support multiple primitives
 			break;
 		} // auto& primitive : _mesh.primitives
@@ -12,11 +12,13 @@
 #include <sk/Assets/Access/Asset_Ref.h>
 #include <sk/Assets/Utils/Asset_List.h>
 #include <sk/Containers/Map.h>
+#include <sk/Misc/Future.h>
 #include <sk/Misc/Singleton.h>
 #include <sk/Misc/Smart_Ptrs.h>
 
 #include <fastgltf/core.hpp>
 
+#include <mutex>
 #include <unordered_set>
 
 namespace sk
@@ -98,6 +100,11 @@ namespace sk
 		auto loadFolder( const std::filesystem::path& _path, const bool _recursive = true, const bool _reload = false ) -> Assets::cAsset_List;
 		auto loadFile  ( const std::filesystem::path& _path, const bool _reload = false ) -> Assets::cAsset_List;
 
+		// Creates the metas for a file without registering them. Safe to call from multiple threads.
+		void loadFileMeta  ( const std::filesystem::path& _path, Assets::cAsset_List& _metas ) const;
+		// Registers every asset in the list while only locking once.
+		void registerAssets( const Assets::cAsset_List& _assets, bool _reload = false );
+
 		// Asset ptrs
 		template< class Ty >
 		requires std::is_base_of_v< cAsset, Ty >
@@ -138,6 +145,46 @@ namespace sk
 			return ptr;
 		}
 
+		// Async asset ptrs, the future becomes ready once the asset is loaded. Dropping every copy of the future releases the request.
+		template< class Ty >
+		requires std::is_base_of_v< cAsset, Ty >
+		auto LoadAsyncByName( const str_hash& _name_hash, const cShared_ptr< iClass >& _self = nullptr )
+			-> cFuture< cAsset_Ptr< Ty > >
+		{
+			return LoadAsync< Ty >( getAssetByName( _name_hash ), _self );
+		}
+		template< class Ty >
+		requires std::is_base_of_v< cAsset, Ty >
+		auto LoadAsyncByPath( const cStringID& _path, const cShared_ptr< iClass >& _self = nullptr )
+			-> cFuture< cAsset_Ptr< Ty > >
+		{
+			return LoadAsync< Ty >( GetAssetByPathHash( _path ), _self );
+		}
+		template< class Ty >
+		requires std::is_base_of_v< cAsset, Ty >
+		static auto LoadAsync( const cShared_ptr< cAsset_Meta >& _meta, const cShared_ptr< iClass >& _self = nullptr )
+			-> cFuture< cAsset_Ptr< Ty > >
+		{
+			SK_BREAK_RET_IF( sk::Severity::kEngine, _meta == nullptr,
+				"Error: Trying to load an asset that doesn't exist.", cFuture< cAsset_Ptr< Ty > >{} )
+
+			cPromise< cAsset_Ptr< Ty > > promise;
+
+			// The ptr lives inside of the future, so its address stays the same while loading.
+			// The listener is stored in the ptr, so it only holds on to the promise weakly. Otherwise an asset which never loads
+			// would keep the state, and with it the request, alive forever. Dropping every future releases the asset instead.
+			auto& ptr = promise.Emplace( _self, _meta );
+			ptr.on_asset_loaded += typename cAsset_Ptr< Ty >::load_dispatcher_t::weak_listener_t(
+				[ weak = promise.GetWeak() ]( Ty& )
+				{
+					weak.SetReady();
+					return false;
+				} );
+			ptr.LoadAsync();
+
+			return promise.GetFuture();
+		}
+
 		// Asset Refs
 		template< class Ty, eAsset_Ref_Mode Mode = eAsset_Ref_Mode::kAutomaticAsync >
 		requires std::is_base_of_v< cAsset, Ty >
@@ -199,6 +246,10 @@ namespace sk
 		void RemoveFileLoaders( const std::vector< cStringID >& _extensions );
 		auto GetFileLoader   ( const str_hash& _extension_hash ) -> load_file_func_t;
 		auto GetExtensions   () -> std::vector< cStringID >;
+
+		// Makes imported meshes get split into meshlets, for cluster culling.
+		void SetBuildMeshlets( const bool _build ){ m_build_meshlets_ = _build; }
+		bool GetBuildMeshlets() const { return m_build_meshlets_; }
 	
 	private:
 		struct sRef_Info
@@ -214,6 +265,9 @@ namespace sk
 		using extension_loader_map_t = unordered_map< cStringID, load_file_func_t >;
 		using extension_map_entry_t  = extension_loader_map_t::value_type;
 
+		// Expects m_asset_mtx_ to be held.
+		bool insertAsset( const cShared_ptr< cAsset_Meta >& _asset );
+
 		void addPathReferrer   ( const str_hash& _path_hash, const void* _referrer );
 		// Returns if there are no more referrers.
 		bool removePathReferrer( const str_hash& _path_hash, const void* _referrer );
@@ -242,6 +296,11 @@ namespace sk
 		str_to_asset_map_t m_asset_name_map_;
 		str_to_asset_map_t m_asset_path_map_;
 		path_to_ref_map_t  m_path_ref_map_;
+
+		// Guards registering new assets.
+		std::mutex m_asset_mtx_;
+
+		std::atomic_bool m_build_meshlets_ = false;
 	};
 
 	namespace Assets
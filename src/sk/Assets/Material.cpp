@@ -10,6 +10,8 @@
 #include <sk/Graphics/Utils/Shader_Link.h>
 #include <sk/Graphics/Utils/Shader_Reflection.h>
 
+#include <algorithm>
+
 using namespace sk::Assets;
 
 cMaterial::cBlock::cBlock( const cMaterial& _owner, std::string _name, const block_t* _info, const size_t _binding )
@@ -17,6 +19,7 @@ cMaterial::cBlock::cBlock( const cMaterial& _owner, std::string _name, const blo
 , m_info_( _info )
 , m_binding_( _binding )
 , m_buffer_( m_pretty_name_ + ": Constant buffer", _info->size, _info->size, Graphics::Buffer::eType::kConstant, false, false )
+, m_dirty_end_( _info->size )
 , m_owner_( &_owner )
 {}
 
@@ -40,12 +43,39 @@ bool cMaterial::cBlock::SetUniformRaw( const cStringID& _name, const void* _data
     
     std::visit( [ & ]( auto& _uniform_ptr )
     {
+        if( std::memcmp( _uniform_ptr, _data, _size ) == 0 )
+            return;
+        
         std::memcpy( static_cast< void* >( _uniform_ptr ), _data, _size );
+        mark_dirty( _uniform_ptr, _size );
     }, uniform.accessor );
     
     return true;
 }
 
+void cMaterial::cBlock::mark_dirty( const void* _data, const size_t _size )
+{
+    const auto offset = static_cast< size_t >( static_cast< const std::byte* >( _data ) - static_cast< const std::byte* >( m_buffer_.Data() ) );
+    
+    m_dirty_begin_ = std::min( m_dirty_begin_, offset );
+    m_dirty_end_   = std::max( m_dirty_end_, offset + _size );
+    m_version_++;
+}
+
+auto cMaterial::cBlock::upload() -> size_t
+{
+    if( !IsDirty() )
+        return 0;
+    
+    const auto size = m_dirty_end_ - m_dirty_begin_;
+    m_buffer_.UploadSegment( m_dirty_begin_, size );
+    
+    m_dirty_begin_ = std::numeric_limits< size_t >::max();
+    m_dirty_end_   = 0;
+    
+    return size;
+}
+
 cMaterial::cMaterial( Graphics::Utils::cShader_Link&& _shader_link )
 : m_shader_link_( std::move( _shader_link ) )
 {
@@ -139,10 +169,13 @@ bool cMaterial::IsReady() const
     return m_shader_link_.IsReady();
 }
 
-void cMaterial::Update()
+auto cMaterial::Update() -> size_t
 {
+    size_t uploaded = 0;
     for( auto& block : m_block_map_ | std::views::values )
-        block.m_buffer_.Upload( true );
+        uploaded += block.upload();
+    
+    return uploaded;
 }
 
 void cMaterial::create_data()
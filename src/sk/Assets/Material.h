@@ -15,6 +15,9 @@
 #include <sk/Math/Matrix4x4.h>
 #include <sk/Math/Vector4.h>
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
 #include <variant>
 
 
@@ -103,7 +106,22 @@ namespace sk::Assets
             auto& GetUniformMap() const { return m_uniform_map_; }
             auto& GetUniformVec() const { return m_uniform_vec_; }
             
+            // If anything changed since the blocks own buffer was last uploaded.
+            [[ nodiscard ]] bool IsDirty() const { return m_dirty_begin_ < m_dirty_end_; }
+            // Increased every time a value in the block changes.
+            [[ nodiscard ]] auto GetVersion() const { return m_version_; }
+            
+            // Per draw blocks are written to the renderers uniform ring on every upload, instead of to their own buffer.
+            // Blocks which change between two draws of the same frame are switched over by the frame buffer on their own.
+            void SetPerDraw( const bool _per_draw ){ m_per_draw_ = _per_draw; }
+            [[ nodiscard ]] bool IsPerDraw() const { return m_per_draw_; }
+            
         private:
+            // Widens the dirty range to cover the data, which has to be within the buffer.
+            void mark_dirty( const void* _data, size_t _size );
+            // Uploads the dirty range of the blocks own buffer, returns the number of bytes uploaded.
+            auto upload() -> size_t;
+            
             std::string    m_pretty_name_;
             const block_t* m_info_;
             size_t         m_binding_;
@@ -112,6 +130,20 @@ namespace sk::Assets
             uniform_map_t m_uniform_map_;
             uniform_vec_t m_uniform_vec_;
             
+            // The whole block starts out dirty, as nothing has been uploaded yet.
+            size_t   m_dirty_begin_ = 0;
+            size_t   m_dirty_end_   = 0;
+            uint64_t m_version_     = 0;
+            
+            // The frame the blocks own buffer was last uploaded during.
+            uint64_t m_upload_frame_ = std::numeric_limits< uint64_t >::max();
+            bool     m_per_draw_     = false;
+            
+            // Where the frame buffer last wrote the block in the renderers uniform ring.
+            uint64_t m_ring_frame_   = std::numeric_limits< uint64_t >::max();
+            uint64_t m_ring_version_ = 0;
+            size_t   m_ring_offset_  = 0;
+            
             const cMaterial* m_owner_;
         };
         struct sInvalid{};
@@ -147,7 +179,8 @@ namespace sk::Assets
         
         bool IsReady() const;
         
-        void Update();
+        // Uploads the changed range of every dirty block, returns the number of bytes uploaded.
+        auto Update() -> size_t;
         
     private:
         struct sTexture
@@ -222,13 +255,35 @@ namespace sk::Assets
             {
                 if constexpr( std::is_array_v< value_type > )
                 {
-                    std::copy_n( std::addressof( _value ), elements, _uniform_ptr );
+                    const auto values = reinterpret_cast< const element_type* >( std::addressof( _value ) );
+
+                    // Compared after the conversion, so only the elements which actually change are marked as dirty.
+                    size_t first = elements, last = 0;
+                    for( size_t i = 0; i < elements; i++ )
+                    {
+                        const Ty value = values[ i ];
+                        if( std::memcmp( &value, &_uniform_ptr[ i ], sizeof( Ty ) ) == 0 )
+                            continue;
+
+                        _uniform_ptr[ i ] = value;
+                        first = std::min( first, i );
+                        last  = i;
+                    }
+
+                    if( first < elements )
+                        mark_dirty( &_uniform_ptr[ first ], sizeof( Ty ) * ( last - first + 1 ) );
                 }
                 else
                 {
                     // If you get an error here, that means you've provided an invalid type.
-                    auto& value = *_uniform_ptr;
-                    value = _value;
+                    const Ty value = _value;
+                    
+                    // Setting a uniform to what it already is leaves the block clean.
+                    if( std::memcmp( &value, _uniform_ptr, sizeof( Ty ) ) != 0 )
+                    {
+                        *_uniform_ptr = value;
+                        mark_dirty( _uniform_ptr, sizeof( Ty ) );
+                    }
                 }
             }
         
@@ -7,17 +7,20 @@
 #include "Mesh.h"
 
 #include <sk/Graphics/Buffer/Dynamic_Buffer.h>
+#include <sk/Scene/Components/CameraComponent.h>
 
 namespace sk::Assets
 {
     cMesh::cMesh( const std::string& _name )
-    : m_indices_( sk::make_shared< Graphics::cDynamic_Buffer >( _name + ": Indices", Graphics::Buffer::eType::kIndex, false ) )
+    : m_name_( _name )
+    , m_indices_( sk::make_shared< Graphics::cDynamic_Buffer >( _name + ": Indices", Graphics::Buffer::eType::kIndex, false ) )
     {} // cMesh
 
     cMesh::~cMesh()
     {
         m_indices_ = nullptr;
         m_vertex_buffers_.clear();
+        m_lods_.clear();
     }
 
     void cMesh::CreateIndexBufferFrom( const eIndexType _type, const void* _data, const size_t _item_count )
@@ -34,6 +37,104 @@ namespace sk::Assets
             memcpy( m_indices_->RawData(), _data, _item_count * m_indices_->GetItemSize() );
     }
 
+    void cMesh::AddLod( const uint32_t* _indices, const size_t _item_count, const float _error )
+    {
+        auto buffer = sk::make_shared< Graphics::cDynamic_Buffer >(
+            std::format( "{}: Lod {}", m_name_, m_lods_.size() + 1 ), Graphics::Buffer::eType::kIndex, false );
+
+        // Matches the source so every LOD can be bound the same way.
+        if( m_indices_->GetItemSize() == sizeof( uint16_t ) )
+        {
+            buffer->AlignAs< uint16_t >();
+            buffer->Resize( _item_count );
+
+            const auto data = buffer->Data< uint16_t >();
+            for( size_t i = 0; i < _item_count; i++ )
+                data[ i ] = static_cast< uint16_t >( _indices[ i ] );
+        }
+        else
+        {
+            buffer->AlignAs< uint32_t >();
+            buffer->Resize( _item_count );
+
+            memcpy( buffer->RawData(), _indices, _item_count * sizeof( uint32_t ) );
+        }
+
+        m_lods_.emplace_back( std::move( buffer ), _error );
+    } // AddLod
+
+    auto cMesh::GetIndexBuffer( const size_t _lod ) const -> const buffer_t&
+    {
+        if( _lod == 0 || m_lods_.empty() )
+            return m_indices_;
+
+        return m_lods_[ std::min( _lod, m_lods_.size() ) - 1 ].indices;
+    } // GetIndexBuffer
+
+    auto cMesh::GetLodError( const size_t _lod ) const -> float
+    {
+        if( _lod == 0 || m_lods_.empty() )
+            return 0.0f;
+
+        return m_lods_[ std::min( _lod, m_lods_.size() ) - 1 ].error;
+    } // GetLodError
+
+    auto cMesh::SelectLod( const Object::Components::cCameraComponent& _camera, const cMatrix4x4f& _world, const float _max_pixel_error ) const -> size_t
+    {
+        if( m_lods_.empty() )
+            return 0;
+
+        // The error is in object space, so it has to be scaled with the largest axis of the world matrix.
+        const auto scale = std::max( {
+            Math::Vector3::Dot( cVector3f{ _world.x } ),
+            Math::Vector3::Dot( cVector3f{ _world.y } ),
+            Math::Vector3::Dot( cVector3f{ _world.z } ) } );
+
+        const auto& settings = _camera.GetSettings();
+        const auto  distance = std::max( Math::Vector3::Length( cVector3f{ _world.w } - _camera.GetTransform().GetWorldPosition() ), settings.near );
+
+        // Projection y scale is 1 / tan( fov / 2 ), which maps half the viewport height.
+        const auto pixels_per_unit = static_cast< float >( _camera.getViewport().height ) * 0.5f * _camera.getProjection().y.y / distance;
+        const auto world_scale     = Math::sqrt( scale ) * pixels_per_unit;
+
+        for( size_t i = m_lods_.size(); i > 0; i-- )
+        {
+            if( m_lods_[ i - 1 ].error * world_scale <= _max_pixel_error )
+                return i;
+        }
+
+        return 0;
+    } // SelectLod
+
+    void cMesh::BuildMeshlets()
+    {
+        const auto positions = m_vertex_buffers_.find( "POSITION" );
+        SK_BREAK_RET_IF( sk::Severity::kEngine, positions == m_vertex_buffers_.end() || positions->second->GetItemType() != &kTypeInfo< cVector3f >,
+            TEXT( "Warning: Mesh {} needs a float3 POSITION buffer to build meshlets.", m_name_ ) )
+
+        std::vector< uint32_t > indices( m_indices_->GetSize() );
+        if( m_indices_->GetItemSize() == sizeof( uint16_t ) )
+            std::ranges::copy( std::span( m_indices_->Data< uint16_t >(), indices.size() ), indices.begin() );
+        else
+            std::ranges::copy( std::span( m_indices_->Data< uint32_t >(), indices.size() ), indices.begin() );
+
+        const auto& position_buffer = *positions->second;
+        m_meshlets_ = Utils::BuildMeshlets( indices.data(), indices.size(),
+            position_buffer.RawData(), position_buffer.GetSize(), position_buffer.GetItemSize() );
+    } // BuildMeshlets
+
+    void cMesh::ComputeBounds()
+    {
+        m_bounds_ = {};
+
+        const auto positions = m_vertex_buffers_.find( "POSITION" );
+        SK_BREAK_RET_IF( sk::Severity::kEngine, positions == m_vertex_buffers_.end() || positions->second->GetItemType() != &kTypeInfo< cVector3f >,
+            TEXT( "Warning: Mesh {} needs a float3 POSITION buffer to compute its bounds.", m_name_ ) )
+
+        for( auto& position : std::span( positions->second->Data< cVector3f >(), positions->second->GetSize() ) )
+            m_bounds_.Merge( position );
+    } // ComputeBounds
+
     bool cMesh::IsValid() const
     {
         if( !m_indices_->IsValid() )
@@ -7,13 +7,22 @@
 #pragma once
 
 #include <sk/Assets/Asset.h>
+#include <sk/Assets/Utils/Meshlet_Builder.h>
 #include <sk/Containers/Map.h>
+#include <sk/Containers/Vector.h>
+#include <sk/Math/AABB.h>
+#include <sk/Math/Matrix4x4.h>
 
 namespace sk::Graphics
 {
     class cDynamic_Buffer;
 } // sk::Graphics::
 
+namespace sk::Object::Components
+{
+    class cCameraComponent;
+} // sk::Object::Components::
+
 // TODO: Decide if I should move the Mesh from the opengl module to the main engine.
 namespace sk::Assets
 {
@@ -38,10 +47,24 @@ namespace sk::Assets
         using buffer_t     = cShared_ptr< Graphics::cDynamic_Buffer >;
         using buffer_map_t = unordered_map< cStringID, buffer_t >;
 
+        // A simplified version of the mesh, uses the same vertex buffers as the source.
+        struct sLod
+        {
+            buffer_t indices;
+            // Object space distance from the source surface.
+            float    error;
+        };
+
+        using lod_vec_t = vector< sLod >;
+
+        using meshlet_data_t = Utils::sMeshlet_Data;
+
         cMesh( const std::string& _name );
         ~cMesh() override;
 
         void CreateIndexBufferFrom( eIndexType _type, const void* _data, size_t _item_count );
+        // The LODs have to be added from the most to the least detailed.
+        void AddLod( const uint32_t* _indices, size_t _item_count, float _error );
 
         [[ nodiscard ]] auto& GetName() const { return m_name_; }
         
@@ -51,12 +74,37 @@ namespace sk::Assets
         [[ nodiscard ]] auto& GetVertexBuffers()       { return m_vertex_buffers_; }
         [[ nodiscard ]] auto& GetVertexBuffers() const { return m_vertex_buffers_; }
 
+        // Lod 0 is always the source index buffer.
+        [[ nodiscard ]] auto  GetLodCount() const { return m_lods_.size() + 1; }
+        [[ nodiscard ]] auto& GetLods    () const { return m_lods_; }
+
+        [[ nodiscard ]] auto GetIndexBuffer( size_t _lod ) const -> const buffer_t&;
+        [[ nodiscard ]] auto GetLodError   ( size_t _lod ) const -> float;
+
+        // Selects the least detailed LOD where the error projected onto the cameras viewport stays below _max_pixel_error.
+        [[ nodiscard ]] auto SelectLod( const Object::Components::cCameraComponent& _camera, const cMatrix4x4f& _world, float _max_pixel_error = 1.0f ) const -> size_t;
+
+        // Splits the source index buffer into meshlets. Requires a float3 POSITION buffer.
+        void BuildMeshlets();
+
+        // Meshlets are cpu side only for now.
+        [[ nodiscard ]] bool  HasMeshlets() const { return !m_meshlets_.meshlets.empty(); }
+        [[ nodiscard ]] auto& GetMeshlets() const { return m_meshlets_; }
+
+        // Recomputes the object space bounds from the POSITION buffer.
+        void ComputeBounds();
+        [[ nodiscard ]] auto& GetBounds() const { return m_bounds_; }
+
         [[ nodiscard ]] bool  IsValid() const;
         
     private:
         std::string  m_name_;
         buffer_t     m_indices_;
         buffer_map_t m_vertex_buffers_;
+        lod_vec_t    m_lods_;
+
+        meshlet_data_t m_meshlets_;
+        cAABBf         m_bounds_;
     };
 } // sk::Assets
 
@@ -0,0 +1,29 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "File_Io.h"
+
+#include <sk/Assets/Management/Asset_Job_Manager.h>
+
+#include <fstream>
+
+auto sk::Assets::ReadFileAsync( std::filesystem::path _path ) -> cTask< file_data_t >
+{
+    co_await Jobs::cAsset_Job_Manager::ResumeOnWorker();
+
+    auto file = std::ifstream( _path, std::ios::binary | std::ios::ate );
+    if( !file.is_open() )
+    {
+        SK_WARNING( sk::Severity::kEngine, "Warning: Unable to open file {}", _path.string() )
+        co_return file_data_t{};
+    }
+
+    file_data_t data( static_cast< size_t >( file.tellg() ) );
+    file.seekg( 0 );
+    file.read( reinterpret_cast< char* >( data.data() ), static_cast< std::streamsize >( data.size() ) );
+
+    co_return data;
+}
@@ -0,0 +1,22 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include <sk/Misc/Task.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <vector>
+
+namespace sk::Assets
+{
+    using file_data_t = std::vector< std::byte >;
+
+    // Reads the whole file on one of the asset workers. The coroutine awaiting it will continue on that worker.
+    // Returns an empty buffer if the file couldn't be read.
+    auto ReadFileAsync( std::filesystem::path _path ) -> cTask< file_data_t >;
+} // sk::Assets::
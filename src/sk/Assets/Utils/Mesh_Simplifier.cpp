@@ -0,0 +1,560 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Mesh_Simplifier.h"
+
+#include <sk/Math/Vector3.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <bit>
+
+namespace sk::Assets::Utils
+{
+    namespace
+    {
+        // Symmetric 4x4 matrix, only the upper triangle is stored.
+        struct sQuadric
+        {
+            double a00 = 0, a01 = 0, a02 = 0, a03 = 0;
+            double          a11 = 0, a12 = 0, a13 = 0;
+            double                   a22 = 0, a23 = 0;
+            double                            a33 = 0;
+            double weight = 0;
+
+            static auto FromPlane( const double _a, const double _b, const double _c, const double _d, const double _weight ) -> sQuadric
+            {
+                return {
+                    _a * _a * _weight, _a * _b * _weight, _a * _c * _weight, _a * _d * _weight,
+                                       _b * _b * _weight, _b * _c * _weight, _b * _d * _weight,
+                                                          _c * _c * _weight, _c * _d * _weight,
+                                                                             _d * _d * _weight,
+                    _weight
+                };
+            }
+
+            sQuadric& operator+=( const sQuadric& _other )
+            {
+                a00 += _other.a00; a01 += _other.a01; a02 += _other.a02; a03 += _other.a03;
+                a11 += _other.a11; a12 += _other.a12; a13 += _other.a13;
+                a22 += _other.a22; a23 += _other.a23;
+                a33 += _other.a33;
+                weight += _other.weight;
+                return *this;
+            }
+
+            sQuadric operator+( const sQuadric& _other ) const { auto res = *this; return res += _other; }
+
+            // Returns the weighted squared distance from the planes.
+            [[ nodiscard ]] double Evaluate( const cVector3f& _position ) const
+            {
+                const double x = _position.x;
+                const double y = _position.y;
+                const double z = _position.z;
+
+                const double error = a00 * x * x + 2 * a01 * x * y + 2 * a02 * x * z + 2 * a03 * x
+                                   + a11 * y * y + 2 * a12 * y * z + 2 * a13 * y
+                                   + a22 * z * z + 2 * a23 * z
+                                   + a33;
+
+                return weight > 0 ? std::max( error, 0.0 ) / weight : 0.0;
+            }
+        };
+
+        // Kept small, as most of the time is spent moving these around the queue.
+        struct sCollapse
+        {
+            float    error;
+            uint32_t from;
+            uint32_t to;
+            // The sum of the versions of both vertices when the error was computed. Versions only go up, so the collapse is stale once it changes.
+            uint32_t version;
+        };
+
+        // Orders the queue with the cheapest collapse on top, ties are broken by the vertices so the result stays deterministic.
+        struct sCollapse_Greater
+        {
+            bool operator()( const sCollapse& _l, const sCollapse& _r ) const
+            {
+                if( _l.error != _r.error ) return _l.error > _r.error;
+                if( _l.from  != _r.from  ) return _l.from  > _r.from;
+                return _l.to > _r.to;
+            }
+        };
+
+        // Min queue for the collapses, which mostly come out in increasing order.
+        // Collapses are put into buckets by the top bits of their error, only the lowest bucket is kept as a heap.
+        // Anything pushed below the lowest bucket goes straight into its heap, so the order is the same as a single heap.
+        class cCollapse_Queue
+        {
+        public:
+            cCollapse_Queue() = default;
+            explicit cCollapse_Queue( const std::vector< sCollapse >& _collapses )
+            : m_buckets_( kBucketCount )
+            {
+                for( const auto& collapse : _collapses )
+                    m_buckets_[ bucket_of( collapse ) ].emplace_back( collapse );
+                m_size_ = _collapses.size();
+                m_bucket_ = 0;
+                next_bucket();
+            }
+
+            [[ nodiscard ]] bool  empty() const { return m_size_ == 0; }
+            [[ nodiscard ]] auto& top  () const { return m_heap_.front(); }
+
+            void push( const sCollapse& _collapse )
+            {
+                const auto bucket = bucket_of( _collapse );
+                if( m_heap_.empty() )
+                    m_bucket_ = bucket;
+
+                if( bucket <= m_bucket_ )
+                {
+                    m_heap_.emplace_back( _collapse );
+                    std::ranges::push_heap( m_heap_, sCollapse_Greater{} );
+                }
+                else
+                    m_buckets_[ bucket ].emplace_back( _collapse );
+
+                m_size_++;
+            }
+
+            void pop()
+            {
+                std::ranges::pop_heap( m_heap_, sCollapse_Greater{} );
+                m_heap_.pop_back();
+                m_size_--;
+                next_bucket();
+            }
+
+        private:
+            // The exponent and the top of the mantissa. Errors are never negative, so the order of the bits is the order of the floats.
+            static constexpr uint32_t kBucketShift = 17;
+            static constexpr uint32_t kBucketCount = 1u << ( 31 - kBucketShift );
+
+            static uint32_t bucket_of( const sCollapse& _collapse )
+            {
+                return std::bit_cast< uint32_t >( _collapse.error ) >> kBucketShift & ( kBucketCount - 1 );
+            }
+
+            // Moves on to the next bucket with anything in it once the heap is empty.
+            void next_bucket()
+            {
+                if( !m_heap_.empty() || m_size_ == 0 )
+                    return;
+
+                while( m_buckets_[ m_bucket_ ].empty() )
+                    m_bucket_++;
+
+                std::swap( m_heap_, m_buckets_[ m_bucket_ ] );
+                std::ranges::make_heap( m_heap_, sCollapse_Greater{} );
+            }
+
+            std::vector< std::vector< sCollapse > > m_buckets_;
+            std::vector< sCollapse >                m_heap_;
+            uint32_t                                m_bucket_ = 0;
+            size_t                                  m_size_   = 0;
+        };
+
+        // Collapses one edge at a time from a priority queue, only recomputing the edges around each collapse.
+        // Entries aren't removed from the queue when they go stale, they're skipped once they reach the top instead.
+        class cSimplifier
+        {
+        public:
+            static constexpr uint32_t kCollapsed = std::numeric_limits< uint32_t >::max();
+
+            cSimplifier( const uint32_t* _indices, const size_t _index_count, const void* _positions, const size_t _vertex_count, const size_t _stride )
+            : m_indices_( _indices, _indices + _index_count - _index_count % 3 )
+            , m_positions_( _vertex_count )
+            , m_quadrics_( _vertex_count )
+            , m_locked_( _vertex_count, 0 )
+            , m_versions_( _vertex_count, 0 )
+            , m_visited_( _vertex_count, 0 )
+            , m_triangles_( _vertex_count )
+            , m_removed_( m_indices_.size() / 3, 0 )
+            {
+                const auto bytes = static_cast< const uint8_t* >( _positions );
+                for( size_t i = 0; i < _vertex_count; i++ )
+                    memcpy( &m_positions_[ i ], bytes + i * _stride, sizeof( float ) * 3 );
+
+                compute_quadrics();
+                lock_seams();
+                lock_borders();
+                build_adjacency();
+                collect_collapses();
+            }
+
+            // Keeps collapsing edges until the target is reached or the error limit is hit.
+            void SimplifyTo( const size_t _target_index_count, const double _max_error_sq )
+            {
+                while( m_triangle_count_ * 3 > _target_index_count )
+                {
+                    if( !m_queue_.empty() && m_queue_.top().error <= _max_error_sq )
+                    {
+                        const auto collapse = m_queue_.top();
+                        m_queue_.pop();
+
+                        if( is_stale( collapse ) )
+                            continue;
+
+                        // The neighbourhood may still change enough for it to be fine, so it's tried again later.
+                        if( would_flip( collapse.from, collapse.to ) )
+                        {
+                            m_deferred_.emplace_back( collapse );
+                            continue;
+                        }
+
+                        apply( collapse );
+                        m_collapses_since_retry_++;
+                        continue;
+                    }
+
+                    // Nothing more can be collapsed unless something changed since the flipping collapses were put aside.
+                    if( !retry_deferred() )
+                        break;
+                }
+
+                m_result_.clear();
+                m_result_.reserve( m_triangle_count_ * 3 );
+                for( size_t t = 0; t < m_removed_.size(); t++ )
+                {
+                    if( !m_removed_[ t ] )
+                        m_result_.insert( m_result_.end(), &m_indices_[ t * 3 ], &m_indices_[ t * 3 ] + 3 );
+                }
+            }
+
+            [[ nodiscard ]] auto& GetIndices() const { return m_result_; }
+            [[ nodiscard ]] float GetError  () const { return static_cast< float >( std::sqrt( m_error_sq_ ) ); }
+
+        private:
+            void compute_quadrics()
+            {
+                for( size_t i = 0; i + 2 < m_indices_.size(); i += 3 )
+                {
+                    const auto& p0 = m_positions_[ m_indices_[ i ] ];
+                    const auto& p1 = m_positions_[ m_indices_[ i + 1 ] ];
+                    const auto& p2 = m_positions_[ m_indices_[ i + 2 ] ];
+
+                    const auto normal = Math::Vector3::Cross( p1 - p0, p2 - p0 );
+                    const auto length = Math::Vector3::Length( normal );
+                    if( length <= 0.0f )
+                        continue;
+
+                    // The cross products length is twice the area, which makes larger triangles weigh more.
+                    const double a = normal.x / length;
+                    const double b = normal.y / length;
+                    const double c = normal.z / length;
+                    const double d = -( a * p0.x + b * p0.y + c * p0.z );
+
+                    const auto quadric = sQuadric::FromPlane( a, b, c, d, length * 0.5 );
+                    for( size_t k = 0; k < 3; k++ )
+                        m_quadrics_[ m_indices_[ i + k ] ] += quadric;
+                }
+            }
+
+            // Vertices sharing a position with another vertex sit on an attribute seam, moving only one side would tear the mesh.
+            void lock_seams()
+            {
+                std::vector< uint32_t > order( m_positions_.size() );
+                for( uint32_t i = 0; i < order.size(); i++ )
+                    order[ i ] = i;
+
+                const auto less = [ this ]( const uint32_t _l, const uint32_t _r )
+                {
+                    const auto& l = m_positions_[ _l ];
+                    const auto& r = m_positions_[ _r ];
+                    if( l.x != r.x ) return l.x < r.x;
+                    if( l.y != r.y ) return l.y < r.y;
+                    if( l.z != r.z ) return l.z < r.z;
+                    return _l < _r;
+                };
+                std::ranges::sort( order, less );
+
+                for( size_t i = 1; i < order.size(); i++ )
+                {
+                    const auto& l = m_positions_[ order[ i - 1 ] ];
+                    const auto& r = m_positions_[ order[ i ] ];
+                    if( l.x == r.x && l.y == r.y && l.z == r.z )
+                        m_locked_[ order[ i - 1 ] ] = m_locked_[ order[ i ] ] = 1;
+                }
+            }
+
+            // An edge without a twin going the opposite direction is on the border of the mesh.
+            void lock_borders()
+            {
+                std::vector< uint64_t > edges;
+                edges.reserve( m_indices_.size() );
+                for( size_t i = 0; i + 2 < m_indices_.size(); i += 3 )
+                {
+                    for( size_t k = 0; k < 3; k++ )
+                    {
+                        const uint64_t a = m_indices_[ i + k ];
+                        const uint64_t b = m_indices_[ i + ( k + 1 ) % 3 ];
+                        edges.emplace_back( a << 32 | b );
+                    }
+                }
+                std::ranges::sort( edges );
+
+                for( const auto edge : edges )
+                {
+                    const auto a = static_cast< uint32_t >( edge >> 32 );
+                    const auto b = static_cast< uint32_t >( edge );
+                    if( !std::ranges::binary_search( edges, static_cast< uint64_t >( b ) << 32 | a ) )
+                        m_locked_[ a ] = m_locked_[ b ] = 1;
+                }
+            }
+
+            // The triangles around every vertex, kept up to date by every collapse. Degenerate triangles are dropped right away.
+            void build_adjacency()
+            {
+                for( uint32_t t = 0; t < m_removed_.size(); t++ )
+                {
+                    const auto triangle = &m_indices_[ t * 3 ];
+                    if( triangle[ 0 ] == triangle[ 1 ] || triangle[ 1 ] == triangle[ 2 ] || triangle[ 0 ] == triangle[ 2 ] )
+                    {
+                        m_removed_[ t ] = 1;
+                        continue;
+                    }
+
+                    for( size_t k = 0; k < 3; k++ )
+                        m_triangles_[ triangle[ k ] ].emplace_back( t );
+                    m_triangle_count_++;
+                }
+            }
+
+            // Picks the cheaper direction of the edge, returns false if both of its vertices are locked.
+            [[ nodiscard ]] bool make_collapse( const uint32_t _a, const uint32_t _b, sCollapse& _collapse ) const
+            {
+                if( m_locked_[ _a ] && m_locked_[ _b ] )
+                    return false;
+
+                const auto quadric = m_quadrics_[ _a ] + m_quadrics_[ _b ];
+
+                // Collapsing a onto b keeps b's position, and the other way around.
+                const auto a_to_b = m_locked_[ _a ] ? std::numeric_limits< double >::max() : quadric.Evaluate( m_positions_[ _b ] );
+                const auto b_to_a = m_locked_[ _b ] ? std::numeric_limits< double >::max() : quadric.Evaluate( m_positions_[ _a ] );
+
+                const auto from = a_to_b <= b_to_a ? _a : _b;
+                const auto to   = a_to_b <= b_to_a ? _b : _a;
+                _collapse = { static_cast< float >( std::min( a_to_b, b_to_a ) ), from, to, m_versions_[ from ] + m_versions_[ to ] };
+                return true;
+            }
+
+            void collect_collapses()
+            {
+                std::vector< uint64_t > edges;
+                edges.reserve( m_indices_.size() );
+                for( size_t t = 0; t < m_removed_.size(); t++ )
+                {
+                    if( m_removed_[ t ] )
+                        continue;
+
+                    for( size_t k = 0; k < 3; k++ )
+                    {
+                        const uint64_t a = m_indices_[ t * 3 + k ];
+                        const uint64_t b = m_indices_[ t * 3 + ( k + 1 ) % 3 ];
+                        edges.emplace_back( std::min( a, b ) << 32 | std::max( a, b ) );
+                    }
+                }
+                std::ranges::sort( edges );
+                const auto [ fst, lst ] = std::ranges::unique( edges );
+                edges.erase( fst, lst );
+
+                std::vector< sCollapse > collapses;
+                collapses.reserve( edges.size() );
+                for( const auto edge : edges )
+                {
+                    if( sCollapse collapse; make_collapse( static_cast< uint32_t >( edge >> 32 ), static_cast< uint32_t >( edge ), collapse ) )
+                        collapses.emplace_back( collapse );
+                }
+
+                m_queue_ = cCollapse_Queue( collapses );
+            }
+
+            [[ nodiscard ]] bool is_stale( const sCollapse& _collapse ) const
+            {
+                const auto from = m_versions_[ _collapse.from ];
+                const auto to   = m_versions_[ _collapse.to ];
+                return from == kCollapsed || to == kCollapsed || from + to != _collapse.version;
+            }
+
+            // Checks if moving from onto to would flip any of the triangles around from.
+            [[ nodiscard ]] bool would_flip( const uint32_t _from, const uint32_t _to ) const
+            {
+                for( const auto t : m_triangles_[ _from ] )
+                {
+                    const auto triangle = &m_indices_[ t * 3 ];
+                    if( triangle[ 0 ] == _to || triangle[ 1 ] == _to || triangle[ 2 ] == _to )
+                        continue;
+
+                    cVector3f before[ 3 ];
+                    cVector3f after [ 3 ];
+                    for( size_t k = 0; k < 3; k++ )
+                    {
+                        before[ k ] = m_positions_[ triangle[ k ] ];
+                        after [ k ] = m_positions_[ triangle[ k ] == _from ? _to : triangle[ k ] ];
+                    }
+
+                    const auto normal_before = Math::Vector3::Cross( before[ 1 ] - before[ 0 ], before[ 2 ] - before[ 0 ] );
+                    const auto normal_after  = Math::Vector3::Cross( after [ 1 ] - after [ 0 ], after [ 2 ] - after [ 0 ] );
+
+                    if( Math::Vector3::Dot( normal_before, normal_after ) <= 0.0f )
+                        return true;
+                }
+
+                return false;
+            }
+
+            // Moves from onto to, then requeues every edge around to as its quadric has changed.
+            void apply( const sCollapse& _collapse )
+            {
+                const auto from = _collapse.from;
+                const auto to   = _collapse.to;
+
+                auto& to_triangles = m_triangles_[ to ];
+                for( const auto t : m_triangles_[ from ] )
+                {
+                    const auto triangle = &m_indices_[ t * 3 ];
+                    if( triangle[ 0 ] == to || triangle[ 1 ] == to || triangle[ 2 ] == to )
+                    {
+                        m_removed_[ t ] = 1;
+                        m_triangle_count_--;
+                        continue;
+                    }
+
+                    for( size_t k = 0; k < 3; k++ )
+                    {
+                        if( triangle[ k ] == from )
+                            triangle[ k ] = to;
+                    }
+                    to_triangles.emplace_back( t );
+                }
+                std::erase_if( to_triangles, [ this ]( const uint32_t _t ){ return m_removed_[ _t ] != 0; } );
+
+                // The removed triangles are also in the lists of their third vertex.
+                for( const auto t : m_triangles_[ from ] )
+                {
+                    if( !m_removed_[ t ] )
+                        continue;
+
+                    for( size_t k = 0; k < 3; k++ )
+                    {
+                        if( const auto other = m_indices_[ t * 3 + k ]; other != from && other != to )
+                            std::erase( m_triangles_[ other ], t );
+                    }
+                }
+
+                m_triangles_[ from ] = {};
+                m_versions_ [ from ] = kCollapsed;
+
+                m_quadrics_[ to ] += m_quadrics_[ from ];
+                m_versions_[ to ]++;
+                m_error_sq_ = std::max( m_error_sq_, static_cast< double >( _collapse.error ) );
+
+                m_visit_++;
+                m_visited_[ to ] = m_visit_;
+                for( const auto t : to_triangles )
+                {
+                    for( size_t k = 0; k < 3; k++ )
+                    {
+                        const auto other = m_indices_[ t * 3 + k ];
+                        if( m_visited_[ other ] == m_visit_ )
+                            continue;
+
+                        m_visited_[ other ] = m_visit_;
+                        if( sCollapse collapse; make_collapse( to, other, collapse ) )
+                            m_queue_.push( collapse );
+                    }
+                }
+            }
+
+            // Puts the collapses that would have flipped a triangle back in the queue, if anything has been collapsed since.
+            // Any that went stale in the meantime have already been requeued with their new error.
+            bool retry_deferred()
+            {
+                if( m_collapses_since_retry_ == 0 || m_deferred_.empty() )
+                    return false;
+
+                for( const auto& collapse : m_deferred_ )
+                {
+                    if( !is_stale( collapse ) )
+                        m_queue_.push( collapse );
+                }
+                m_deferred_.clear();
+                m_collapses_since_retry_ = 0;
+
+                return true;
+            }
+
+            std::vector< uint32_t >  m_indices_;
+            std::vector< cVector3f > m_positions_;
+            std::vector< sQuadric >  m_quadrics_;
+            std::vector< uint8_t >   m_locked_;
+            // Bumped every time a vertex is collapsed onto, as that changes the error of every edge around it. Collapsed vertices are kCollapsed.
+            std::vector< uint32_t >  m_versions_;
+            std::vector< uint32_t >  m_visited_;
+
+            std::vector< std::vector< uint32_t > > m_triangles_;
+            std::vector< uint8_t >   m_removed_;
+            size_t                   m_triangle_count_ = 0;
+
+            cCollapse_Queue          m_queue_;
+            std::vector< sCollapse > m_deferred_;
+            size_t                   m_collapses_since_retry_ = 0;
+            uint32_t                 m_visit_                 = 0;
+
+            std::vector< uint32_t >  m_result_;
+
+            double m_error_sq_ = 0.0;
+        };
+    } // ::
+
+    auto SimplifyMesh( const uint32_t* _indices, const size_t _index_count, const void* _positions, const size_t _vertex_count,
+        const size_t _stride, const size_t _target_index_count, const float _max_error, float* _out_error ) -> std::vector< uint32_t >
+    {
+        cSimplifier simplifier( _indices, _index_count, _positions, _vertex_count, _stride );
+
+        const auto max_error = static_cast< double >( _max_error );
+        simplifier.SimplifyTo( _target_index_count, max_error * max_error );
+
+        if( _out_error )
+            *_out_error = simplifier.GetError();
+
+        return simplifier.GetIndices();
+    } // SimplifyMesh
+
+    auto GenerateLods( const uint32_t* _indices, const size_t _index_count, const void* _positions, const size_t _vertex_count,
+        const size_t _stride, const sSimplify_Settings& _settings ) -> std::vector< sSimplified_Lod >
+    {
+        std::vector< sSimplified_Lod > lods;
+        if( _index_count < 3 || _settings.lod_count == 0 )
+            return lods;
+
+        lods.reserve( _settings.lod_count );
+
+        cSimplifier simplifier( _indices, _index_count, _positions, _vertex_count, _stride );
+
+        const auto max_error = static_cast< double >( _settings.max_error );
+        auto previous_count = _index_count;
+
+        for( uint32_t i = 0; i < _settings.lod_count; i++ )
+        {
+            const auto target = static_cast< size_t >( static_cast< float >( previous_count / 3 ) * _settings.reduction_ratio ) * 3;
+            simplifier.SimplifyTo( target, max_error * max_error );
+
+            const auto& indices = simplifier.GetIndices();
+            const auto  removed = static_cast< float >( previous_count - indices.size() ) / static_cast< float >( previous_count );
+            if( indices.empty() || removed < _settings.min_reduction )
+                break;
+
+            lods.emplace_back( indices, simplifier.GetError() );
+            previous_count = indices.size();
+        }
+
+        return lods;
+    } // GenerateLods
+} // sk::Assets::Utils
@@ -0,0 +1,45 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace sk::Assets::Utils
+{
+    struct sSimplify_Settings
+    {
+        // Amount of LODs to generate on top of the source indices.
+        uint32_t lod_count       = 3;
+        // Fraction of the previous LODs triangles the next LOD aims to keep.
+        float    reduction_ratio = 0.5f;
+        // Max object space error a LOD is allowed to have.
+        float    max_error       = std::numeric_limits< float >::max();
+        // A LOD that removes less than this fraction of the previous LODs triangles is discarded and ends the chain.
+        float    min_reduction   = 0.05f;
+    };
+
+    struct sSimplified_Lod
+    {
+        std::vector< uint32_t > indices;
+        // Object space distance from the source surface.
+        float                   error;
+    };
+
+    // Quadric error metric edge collapse simplification.
+    // Vertices are only ever collapsed onto other existing vertices, meaning the result can keep using the source vertex buffer.
+    // Border and seam vertices are locked. The same input will always produce the same output.
+    auto SimplifyMesh( const uint32_t* _indices, size_t _index_count, const void* _positions, size_t _vertex_count, size_t _stride,
+        size_t _target_index_count, float _max_error = std::numeric_limits< float >::max(), float* _out_error = nullptr ) -> std::vector< uint32_t >;
+
+    // Generates a chain of LODs where each LOD is simplified further from the previous one.
+    // The error keeps accumulating through the chain so it's always relative to the source mesh.
+    auto GenerateLods( const uint32_t* _indices, size_t _index_count, const void* _positions, size_t _vertex_count, size_t _stride,
+        const sSimplify_Settings& _settings = {} ) -> std::vector< sSimplified_Lod >;
+} // sk::Assets::Utils
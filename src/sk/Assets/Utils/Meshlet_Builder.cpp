@@ -0,0 +1,193 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Meshlet_Builder.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace sk::Assets::Utils
+{
+    namespace
+    {
+        constexpr uint8_t  kNotInMeshlet = 0xff;
+        constexpr uint32_t kNoTriangle   = ~0u;
+
+        void compute_bounds( sMeshlet& _meshlet, const sMeshlet_Data& _data, const std::vector< cVector3f >& _positions )
+        {
+            const auto vertices  = &_data.vertices [ _meshlet.vertex_offset ];
+            const auto triangles = &_data.triangles[ _meshlet.triangle_offset ];
+
+            cVector3f min = _positions[ vertices[ 0 ] ];
+            cVector3f max = min;
+            for( size_t i = 1; i < _meshlet.vertex_count; i++ )
+            {
+                const auto& position = _positions[ vertices[ i ] ];
+                for( size_t k = 0; k < 3; k++ )
+                {
+                    min[ k ] = std::min( min[ k ], position[ k ] );
+                    max[ k ] = std::max( max[ k ], position[ k ] );
+                }
+            }
+
+            _meshlet.center = ( min + max ) * 0.5f;
+            _meshlet.radius = 0.0f;
+            for( size_t i = 0; i < _meshlet.vertex_count; i++ )
+                _meshlet.radius = std::max( _meshlet.radius, Math::Vector3::Dot( _positions[ vertices[ i ] ] - _meshlet.center ) );
+            _meshlet.radius = Math::sqrt( _meshlet.radius );
+
+            cVector3f normals[ sMeshlet::kMaxTriangles ];
+            size_t    normal_count = 0;
+            cVector3f axis;
+            for( size_t i = 0; i < _meshlet.triangle_count; i++ )
+            {
+                const auto& p0 = _positions[ vertices[ triangles[ i * 3 ] ] ];
+                const auto& p1 = _positions[ vertices[ triangles[ i * 3 + 1 ] ] ];
+                const auto& p2 = _positions[ vertices[ triangles[ i * 3 + 2 ] ] ];
+
+                const auto normal = Math::Vector3::Cross( p1 - p0, p2 - p0 );
+                const auto length = Math::Vector3::Length( normal );
+                if( length <= 0.0f )
+                    continue;
+
+                normals[ normal_count ] = normal * ( 1.0f / length );
+                axis += normals[ normal_count++ ];
+            }
+
+            _meshlet.cone_axis   = Math::Vector3::Normalized( axis );
+            _meshlet.cone_cutoff = 1.0f;
+
+            if( normal_count == 0 )
+                return;
+
+            float min_dot = 1.0f;
+            for( size_t i = 0; i < normal_count; i++ )
+                min_dot = std::min( min_dot, Math::Vector3::Dot( normals[ i ], _meshlet.cone_axis ) );
+
+            // Anything wider than ~84 degrees will barely ever get culled, so it's not worth testing.
+            if( min_dot > 0.1f )
+                _meshlet.cone_cutoff = Math::sqrt( 1.0f - min_dot * min_dot );
+        }
+    } // ::
+
+    auto BuildMeshlets( const uint32_t* _indices, const size_t _index_count, const void* _positions, const size_t _vertex_count,
+        const size_t _stride ) -> sMeshlet_Data
+    {
+        sMeshlet_Data data;
+
+        const auto triangle_count = _index_count / 3;
+        if( triangle_count == 0 )
+            return data;
+
+        std::vector< cVector3f > positions( _vertex_count );
+        const auto bytes = static_cast< const uint8_t* >( _positions );
+        for( size_t i = 0; i < _vertex_count; i++ )
+            memcpy( &positions[ i ], bytes + i * _stride, sizeof( float ) * 3 );
+
+        // Triangles per vertex.
+        std::vector< uint32_t > adjacency_offsets( _vertex_count + 1, 0 );
+        std::vector< uint32_t > adjacency( triangle_count * 3 );
+        for( size_t i = 0; i < triangle_count * 3; i++ )
+            ++adjacency_offsets[ _indices[ i ] + 1 ];
+        for( size_t i = 1; i < adjacency_offsets.size(); i++ )
+            adjacency_offsets[ i ] += adjacency_offsets[ i - 1 ];
+        {
+            auto fill = adjacency_offsets;
+            for( uint32_t i = 0; i < triangle_count * 3; i++ )
+                adjacency[ fill[ _indices[ i ] ]++ ] = i / 3;
+        }
+
+        std::vector< uint8_t > emitted( triangle_count, 0 );
+        std::vector< uint8_t > local( _vertex_count, kNotInMeshlet );
+
+        // Rough estimate, most meshes end up close to the triangle limit.
+        data.meshlets.reserve( triangle_count / sMeshlet::kMaxTriangles + 1 );
+        data.vertices.reserve( triangle_count );
+        data.triangles.reserve( triangle_count * 3 );
+
+        sMeshlet meshlet{};
+
+        const auto new_vertices = [ & ]( const uint32_t _triangle )
+        {
+            uint32_t count = 0;
+            for( size_t k = 0; k < 3; k++ )
+                count += local[ _indices[ _triangle * 3 + k ] ] == kNotInMeshlet;
+            return count;
+        };
+
+        const auto fits = [ & ]( const uint32_t _triangle )
+        {
+            return meshlet.vertex_count + new_vertices( _triangle ) <= sMeshlet::kMaxVertices
+                && meshlet.triangle_count + 1u <= sMeshlet::kMaxTriangles;
+        };
+
+        const auto finish = [ & ]
+        {
+            compute_bounds( meshlet, data, positions );
+            data.meshlets.emplace_back( meshlet );
+
+            for( size_t i = 0; i < meshlet.vertex_count; i++ )
+                local[ data.vertices[ meshlet.vertex_offset + i ] ] = kNotInMeshlet;
+
+            meshlet = {};
+            meshlet.vertex_offset   = static_cast< uint32_t >( data.vertices.size() );
+            meshlet.triangle_offset = static_cast< uint32_t >( data.triangles.size() );
+        };
+
+        size_t next_unused = 0;
+        for( size_t emitted_count = 0; emitted_count < triangle_count; emitted_count++ )
+        {
+            // Prefer triangles connected to the current meshlet that add the fewest vertices.
+            auto     best       = kNoTriangle;
+            uint32_t best_score = 4;
+            for( size_t i = 0; i < meshlet.vertex_count && best_score > 0; i++ )
+            {
+                const auto vertex = data.vertices[ meshlet.vertex_offset + i ];
+                for( auto k = adjacency_offsets[ vertex ]; k < adjacency_offsets[ vertex + 1 ] && best_score > 0; k++ )
+                {
+                    const auto triangle = adjacency[ k ];
+                    if( emitted[ triangle ] )
+                        continue;
+
+                    if( const auto score = new_vertices( triangle ); score < best_score )
+                    {
+                        best       = triangle;
+                        best_score = score;
+                    }
+                }
+            }
+
+            if( best == kNoTriangle )
+            {
+                while( emitted[ next_unused ] )
+                    ++next_unused;
+                best = static_cast< uint32_t >( next_unused );
+            }
+
+            if( !fits( best ) )
+                finish();
+
+            for( size_t k = 0; k < 3; k++ )
+            {
+                const auto vertex = _indices[ best * 3 + k ];
+                if( local[ vertex ] == kNotInMeshlet )
+                {
+                    local[ vertex ] = meshlet.vertex_count++;
+                    data.vertices.emplace_back( vertex );
+                }
+                data.triangles.emplace_back( local[ vertex ] );
+            }
+
+            ++meshlet.triangle_count;
+            emitted[ best ] = 1;
+        }
+
+        if( meshlet.triangle_count > 0 )
+            finish();
+
+        return data;
+    } // BuildMeshlets
+} // sk::Assets::Utils
@@ -0,0 +1,48 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include <sk/Math/Vector3.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace sk::Assets::Utils
+{
+    struct sMeshlet
+    {
+        static constexpr size_t kMaxVertices  = 64;
+        static constexpr size_t kMaxTriangles = 124;
+
+        // Offset into the meshlet vertex list, which holds indices into the meshes vertex buffers.
+        uint32_t vertex_offset;
+        // Offset into the meshlet triangle list, which holds three local indices per triangle.
+        uint32_t triangle_offset;
+        uint8_t  vertex_count;
+        uint8_t  triangle_count;
+
+        // Bounding sphere in object space.
+        cVector3f center;
+        float     radius;
+
+        // Normal cone, the cutoff is the sine of the cones half angle. A cutoff of 1 means the cone can't be used for culling.
+        cVector3f cone_axis;
+        float     cone_cutoff;
+    };
+
+    struct sMeshlet_Data
+    {
+        std::vector< sMeshlet > meshlets;
+        std::vector< uint32_t > vertices;
+        std::vector< uint8_t  > triangles;
+    };
+
+    // Greedily grows meshlets by picking the adjacent triangle that adds the least amount of new vertices.
+    // The same input will always produce the same output.
+    auto BuildMeshlets( const uint32_t* _indices, size_t _index_count, const void* _positions, size_t _vertex_count, size_t _stride ) -> sMeshlet_Data;
+} // sk::Assets::Utils
@@ -8,6 +8,8 @@
 
 #include <sk/Assets/Management/Asset_Job_Manager.h>
 
+#include <coroutine>
+
 namespace
 {
     sk::Assets::Jobs::cAsset_Job_Manager* manager = nullptr;
@@ -23,6 +25,8 @@ void sk::Assets::Jobs::cAsset_Worker::worker( cAsset_Worker* _loader )
 {
     auto& self = *_loader;
 
+    cAsset_Job_Manager::mark_worker_thread();
+
     while( self.m_active_ )
     {
         if( auto task = manager->WaitForTask( self.m_active_ ); task.type != eJobType::kNone )
@@ -30,6 +34,7 @@ void sk::Assets::Jobs::cAsset_Worker::worker( cAsset_Worker* _loader )
             self.m_working_.store( true );
             do_work( task );
             self.m_working_.store( false );
+            manager->complete_task();
         }
     }
 }
@@ -50,6 +55,10 @@ void sk::Assets::Jobs::cAsset_Worker::do_work( const sTask& _work )
     case eJobType::kPushEvent:
         push_event( *static_cast< sListenerTask* >( _work.data ) );
         break;
+    case eJobType::kResume:
+        // The coroutine frame owns itself, so there's nothing to free.
+        std::coroutine_handle<>::from_address( _work.data ).resume();
+        return;
     }
 
     Memory::free_fast( _work.data );
@@ -26,6 +26,9 @@ namespace sk::Assets::Jobs
         kRefresh,
                 
         kPushEvent,
+
+        // Resumes a suspended coroutine, the data is the coroutine address.
+        kResume,
     };
 
     struct sAssetTask
@@ -49,6 +49,9 @@ namespace sk::Graphics
         void Resize( size_t _new_size );
         void Reserve( size_t _new_capacity );
         
+        // For binding the buffer.
+        auto GetBuffer() -> cUnsafe_Buffer&;
+        
         // Returns the index of the inserted value
         template< class... Args >
         requires std::constructible_from< Ty, Args... >
@@ -178,6 +181,12 @@ namespace sk::Graphics
         // TODO: Add the reserve function
     }
 
+    template< class Ty, Buffer::eType Type >
+    auto cBuffer< Ty, Type >::GetBuffer() -> cUnsafe_Buffer&
+    {
+        return m_buffer_;
+    }
+
     template< class Ty, Buffer::eType Type >
     template< class... Args >
     requires std::constructible_from< Ty, Args... >
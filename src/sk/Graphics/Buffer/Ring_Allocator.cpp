@@ -0,0 +1,74 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Ring_Allocator.h"
+
+#include <sk/Debugging/Macros/Assert.h>
+
+#include <utility>
+
+namespace sk::Graphics
+{
+    cRing_Allocator::cRing_Allocator( const size_t _capacity, const size_t _alignment, sFences _fences )
+    : m_capacity_ ( _capacity )
+    , m_alignment_( _alignment == 0 ? 1 : _alignment )
+    , m_fences_   ( std::move( _fences ) )
+    {
+        SK_ERR_IF( ( m_alignment_ & ( m_alignment_ - 1 ) ) != 0, "Error: The alignment of a ring allocator has to be a power of two." )
+    } // cRing_Allocator
+
+    cRing_Allocator::~cRing_Allocator()
+    {
+        while( !m_frames_.empty() )
+            retire();
+    } // ~cRing_Allocator
+
+    auto cRing_Allocator::Allocate( const size_t _size ) -> size_t
+    {
+        auto offset = ( m_head_ + m_alignment_ - 1 ) & ~( m_alignment_ - 1 );
+
+        // Allocations are never split, so whatever is left at the end is skipped when it's too small.
+        if( offset + _size > m_capacity_ )
+            offset = 0;
+
+        const auto required = ( offset >= m_head_ ? offset - m_head_ : m_capacity_ - m_head_ ) + _size;
+
+        // Checked up front so a failed allocation doesn't wait on every frame in flight first.
+        SK_BREAK_RET_IF( sk::Severity::kGraphics, required > m_capacity_ - m_frame_size_,
+            TEXT( "Error: The current frame needs more than the {} bytes the ring has.", m_capacity_ ), kInvalid )
+
+        while( m_capacity_ - m_used_ < required )
+            retire();
+
+        m_head_        = offset + _size;
+        m_used_       += required;
+        m_frame_size_ += required;
+
+        return offset;
+    } // Allocate
+
+    void cRing_Allocator::EndFrame()
+    {
+        m_frame_index_++;
+
+        if( m_frame_size_ == 0 )
+            return;
+
+        m_frames_.emplace_back( sFrame{ .size = m_frame_size_, .fence = m_fences_.insert() } );
+        m_frame_size_ = 0;
+    } // EndFrame
+
+    void cRing_Allocator::retire()
+    {
+        const auto frame = m_frames_.front();
+        m_frames_.pop_front();
+
+        m_fences_.wait( frame.fence );
+        m_wait_count_++;
+
+        m_used_ -= frame.size;
+    } // retire
+} // sk::Graphics
@@ -0,0 +1,84 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+
+namespace sk::Graphics
+{
+    // Hands out offsets into a ring of memory shared with the gpu, without knowing anything about the graphics api.
+    // Every frame ends with a fence, the memory the frame used is only reused once the fence has been passed.
+    class cRing_Allocator
+    {
+    public:
+        // Whatever the backend uses to identify a fence.
+        using fence_t = uint64_t;
+
+        struct sFences
+        {
+            // Called at the end of a frame which allocated anything.
+            std::function< fence_t() >      insert;
+            // Has to block until the fence has been passed, the fence is done with afterwards.
+            std::function< void( fence_t ) > wait;
+        };
+
+        static constexpr size_t kInvalid = std::numeric_limits< size_t >::max();
+
+        cRing_Allocator( size_t _capacity, size_t _alignment, sFences _fences );
+        // Waits on every frame still in flight, so the memory can be released afterwards.
+        ~cRing_Allocator();
+
+        cRing_Allocator( const cRing_Allocator& ) = delete;
+        cRing_Allocator& operator=( const cRing_Allocator& ) = delete;
+
+        /**
+         * Allocates from the ring, waiting on the oldest frames until there's room.
+         * @return The offset of the allocation, or kInvalid if the current frame alone would need more than the capacity.
+         */
+        auto Allocate( size_t _size ) -> size_t;
+
+        // Fences everything allocated since the last call.
+        void EndFrame();
+
+        [[ nodiscard ]] auto GetCapacity  () const { return m_capacity_; }
+        [[ nodiscard ]] auto GetAlignment () const { return m_alignment_; }
+        // Bytes in use by the current frame and the ones in flight, padding included.
+        [[ nodiscard ]] auto GetUsed      () const { return m_used_; }
+        [[ nodiscard ]] auto GetFrameCount() const { return m_frames_.size(); }
+        // Increased by every EndFrame. An allocation can only be reused by draws made under the same index.
+        [[ nodiscard ]] auto GetFrameIndex() const { return m_frame_index_; }
+        // How many times an allocation had to wait on a fence.
+        [[ nodiscard ]] auto GetWaitCount () const { return m_wait_count_; }
+
+    private:
+        struct sFrame
+        {
+            size_t  size;
+            fence_t fence;
+        };
+
+        // Waits on the oldest frame and frees its memory.
+        void retire();
+
+        size_t  m_capacity_;
+        size_t  m_alignment_;
+        sFences m_fences_;
+
+        size_t m_head_       = 0;
+        size_t m_used_       = 0;
+        size_t m_frame_size_ = 0;
+        size_t m_wait_count_ = 0;
+
+        uint64_t m_frame_index_ = 0;
+
+        // Oldest first.
+        std::deque< sFrame > m_frames_;
+    };
+} // sk::Graphics
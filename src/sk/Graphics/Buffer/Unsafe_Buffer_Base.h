@@ -101,6 +101,12 @@ namespace sk::Graphics
 
         virtual void  SetChanged() = 0;
         virtual void  Upload( bool _force ) = 0;
+        /**
+         * Uploads part of the data, whether the buffer has changed or not.
+         * @param _offset Offset in bytes from the start of the buffer.
+         * @param _size Size of the segment in bytes.
+         */
+        virtual void  UploadSegment( size_t _offset, size_t _size ) = 0;
 
         [[ nodiscard ]]
         virtual std::string GetName() const = 0;
@@ -51,20 +51,18 @@ void sk::Graphics::Passes::cForward_Pass::RenderWithCamera( const Object::Compon
     frame_buffer.Begin( _camera.getViewport(), _camera.getScissor() );
     frame_buffer.Clear( Rendering::eClear::kTargets | Rendering::eClear::kDepth );
 
-    for( auto [ fst, lst ] = layer_manager.GetMeshesIn( _camera.GetLayers() ); fst != lst; ++fst )
+    for( auto layers = _camera.GetLayers(); layers != 0; layers &= layers - 1 )
     {
-        if( !fst.IsValid() )
-            continue;
-        
-        auto& mesh = *fst;
-        
-        if( !mesh->IsReady() )
-            continue;
+        for( const auto mesh : layer_manager.GetMeshes( std::countr_zero( layers ) ) )
+        {
+            if( !mesh->IsReady() )
+                continue;
 
-        const bool res = Utils::RenderMesh( _camera, frame_buffer,
-            *mesh->GetMaterial(), mesh->GetTransform().GetWorld(), *mesh->GetMesh() );
-        if( !res )
-            SK_BREAK;
+            const bool res = Utils::RenderMesh( _camera, frame_buffer,
+                *mesh->GetMaterial(), mesh->GetTransform(), *mesh->GetMesh() );
+            if( !res )
+                SK_BREAK;
+        }
     }
     
     frame_buffer.End();
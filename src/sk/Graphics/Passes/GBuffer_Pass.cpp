@@ -2,12 +2,17 @@
 
 #include "GBuffer_Pass.h"
 
-#include <framework/App.h>
+#include <sk/Assets/Material.h>
+#include <sk/Assets/Mesh.h>
+#include <sk/Assets/Management/Asset_Job_Manager.h>
 #include <sk/Debugging/Macros/Assert.h>
 #include <sk/Graphics/Pipelines/Pipeline.h>
 #include <sk/Graphics/Rendering/Depth_Target.h>
 #include <sk/Graphics/Rendering/Frame_Buffer.h>
+#include <sk/Graphics/Rendering/Graph_Backend.h>
 #include <sk/Graphics/Utils/RenderUtils.h>
+#include <sk/Misc/Future.h>
+#include <sk/Misc/Task.h>
 #include <sk/Platform/Window/Window_Base.h>
 #include <sk/Scene/Components/CameraComponent.h>
 #include <sk/Scene/Components/MeshComponent.h>
@@ -16,36 +21,53 @@
 
 using namespace sk::Graphics::Passes;
 
-void cGBuffer_Pass::Init()
+namespace
 {
-    m_render_context_ = std::make_unique< Rendering::cRender_Context >( 2, 3 );
-    
-    auto resolution = getPipeline().GetWindow()->GetResolution();
+    // Below this many draws per slice the time spent handing out the slices is more than what recording them in parallel saves.
+    constexpr size_t kMinDrawsPerSlice = 256;
     
-    for( const auto& frame_buffer : *m_render_context_ )
+    auto record_slice( const sk::Graphics::Utils::cDraw_List& _list, const size_t _begin, const size_t _end,
+        sk::Graphics::Utils::cCommand_Buffer& _commands ) -> sk::cTask<>
     {
-        auto color_target    = sk::make_shared< Rendering::cRender_Target >( resolution, Rendering::cRender_Target::eFormat::kRGBA8 );
-        auto position_target = sk::make_shared< Rendering::cRender_Target >( resolution, Rendering::cRender_Target::eFormat::kRGBA16F );
-        auto normal_target   = sk::make_shared< Rendering::cRender_Target >( resolution, Rendering::cRender_Target::eFormat::kRGBA16F );
-        
-        auto depth_target = sk::make_shared< Rendering::cDepth_Target >( resolution, Rendering::cDepth_Target::eFormat::kD24FS8 );
+        co_await sk::Assets::Jobs::cAsset_Job_Manager::ResumeOnWorker();
         
-        frame_buffer->Bind( 0, position_target );
-        frame_buffer->Bind( 1, normal_target );
-        frame_buffer->Bind( 2, color_target );
-        
-        frame_buffer->Bind( depth_target );
+        sk::Graphics::Utils::RecordDrawList( _list, _begin, _end, _commands );
     }
+} // ::
+
+void cGBuffer_Pass::Init()
+{
+    // A single buffer, the graph decides which textures it renders to.
+    m_render_context_ = std::make_unique< Rendering::cRender_Context >( 1, 3 );
+}
+
+void cGBuffer_Pass::Setup( cRender_Graph::cBuilder& _builder )
+{
+    using Rendering::cGraph_Backend;
+    
+    const auto resolution = getPipeline().GetWindow()->GetResolution();
+    
+    m_position_ = _builder.Create( "GBuffer Position", cGraph_Backend::Describe( resolution, Rendering::cRender_Target::eFormat::kRGBA16F ) );
+    m_normal_   = _builder.Create( "GBuffer Normal",   cGraph_Backend::Describe( resolution, Rendering::cRender_Target::eFormat::kRGBA16F ) );
+    m_albedo_   = _builder.Create( "GBuffer Albedo",   cGraph_Backend::Describe( resolution, Rendering::cRender_Target::eFormat::kRGBA8 ) );
+    m_depth_    = _builder.Create( "GBuffer Depth",    cGraph_Backend::Describe( resolution, Rendering::cDepth_Target::eFormat::kD24FS8 ) );
 }
 
 bool cGBuffer_Pass::Begin()
 {
-    auto  main_window    = cApp::get().GetMainWindow();
     auto& camera_manager = Scene::cCameraManager::get();
     auto& main_camera    = *camera_manager.getMainCamera();
     
-    if( main_window->WasResizedThisFrame() )
-        m_render_context_->Resize( main_window->GetResolution() );
+    const auto& graph   = getPipeline().GetGraph();
+    const auto& backend = getPipeline().GetGraphBackend();
+    auto& frame_buffer  = m_render_context_->GetBack();
+    
+    // Binding the same targets again does nothing, they only change when the graph is recompiled.
+    frame_buffer.Bind( 0, backend.GetRenderTarget( graph.GetTexture( m_position_ ) ) );
+    frame_buffer.Bind( 1, backend.GetRenderTarget( graph.GetTexture( m_normal_ ) ) );
+    frame_buffer.Bind( 2, backend.GetRenderTarget( graph.GetTexture( m_albedo_ ) ) );
+    
+    frame_buffer.Bind( backend.GetDepthTarget( graph.GetTexture( m_depth_ ) ) );
     
     RenderWithCamera( main_camera );
     
@@ -62,7 +84,7 @@ void cGBuffer_Pass::Destroy()
     m_render_context_.reset();
 }
 
-void cGBuffer_Pass::RenderWithCamera( const Object::Components::cCameraComponent& _camera ) const
+void cGBuffer_Pass::RenderWithCamera( const Object::Components::cCameraComponent& _camera )
 {
     const auto& layer_manager = Scene::cLayer_Manager::get();
     
@@ -71,20 +93,114 @@ void cGBuffer_Pass::RenderWithCamera( const Object::Components::cCameraComponent
     frame_buffer.Begin( _camera.getViewport(), _camera.getScissor() );
     frame_buffer.Clear( Rendering::eClear::kAll );
     
-    for( auto [ fst, lst ] = layer_manager.GetMeshesIn( _camera.GetLayers() ); fst != lst; ++fst )
+    m_cull_meshes_.clear();
+    m_cull_bounds_.Clear();
+    m_visible_    .clear();
+    
+    for( auto layers = _camera.GetLayers(); layers != 0; layers &= layers - 1 )
+    {
+        for( const auto mesh : layer_manager.GetMeshes( std::countr_zero( layers ) ) )
+        {
+            if( !mesh->IsReady() )
+                continue;
+
+            m_cull_meshes_.emplace_back( mesh );
+            m_cull_bounds_.Add( mesh->UpdateBounds() );
+        }
+    }
+
+    Utils::CullBounds( m_cull_bounds_, _camera.GetFrustum(), m_visible_ );
+
+    m_draw_list_.Clear();
+    m_draw_list_.Reserve( m_visible_.size() );
+
+    const auto& camera_position = _camera.GetTransform().GetWorldPosition();
+    const auto  inverse_far     = 1.0f / _camera.GetSettings().far;
+
+    for( const auto index : m_visible_ )
     {
-        if( !fst.IsValid() )
-            continue;
+        const auto mesh      = m_cull_meshes_[ index ];
+        const auto material  = mesh->GetMaterial();
+        const auto mesh_data = mesh->GetMesh();
+        const auto& world    = mesh->GetTransform().GetWorld();
+
+        const auto center = sk::cVector3f( m_cull_bounds_.center_x[ index ], m_cull_bounds_.center_y[ index ], m_cull_bounds_.center_z[ index ] );
+        const auto depth  = sk::Math::Vector3::Length( center - camera_position ) * inverse_far;
+
+        const auto lod = mesh_data->SelectLod( _camera, world );
+
+        const auto key = MakeKey( m_draw_list_, material->GetShaderLink().get_program(), material, mesh_data, lod, depth );
+
+        m_draw_list_.Add( key, {
+            .material  = material,
+            .mesh      = mesh_data,
+            .transform = &mesh->GetTransform(),
+            .lod       = lod,
+        } );
+    }
+
+    m_draw_list_.Sort();
+    
+    record_draws();
+
+    m_draw_stats_ = {};
+    if( !Utils::SubmitCommands( _camera, frame_buffer, std::span( m_commands_ ).first( m_command_count_ ), m_instances_, &m_draw_stats_ ) )
+        SK_BREAK;
+}
+
+auto cGBuffer_Pass::MakeKey( Utils::cDraw_List& _list, const uint32_t _program, const Assets::cMaterial* _material, const Assets::cMesh* _mesh,
+    const size_t _lod, const float _depth ) -> uint64_t
+{
+    // Front to back within the same mesh and lod, so the depth test can reject more of the overlapping ones.
+    return Utils::cDraw_List::MakeKey( 0, _list.GetProgramId( _program ), _list.GetMaterialId( _material ), _list.GetMeshId( _mesh ),
+        static_cast< uint32_t >( _lod ), _depth );
+}
+
+void cGBuffer_Pass::record_draws()
+{
+    const auto entries     = m_draw_list_.GetEntries();
+    const auto is_same_run = [ & ]( const size_t _index )
+    {
+        const auto& previous = m_draw_list_.GetDraw( entries[ _index - 1 ].draw );
+        const auto& current  = m_draw_list_.GetDraw( entries[ _index ].draw );
+        return previous.material == current.material && previous.mesh == current.mesh && previous.lod == current.lod;
+    };
+    
+    const auto worker_count = Assets::Jobs::cAsset_Job_Manager::get().GetWorkerCount();
+    m_command_count_ = std::clamp< size_t >( entries.size() / kMinDrawsPerSlice, 1, worker_count );
+    
+    if( m_commands_.size() < m_command_count_ )
+        m_commands_.resize( m_command_count_ );
+    
+    for( auto& commands : m_commands_ )
+        commands.Clear();
+    
+    if( m_command_count_ == 1 )
+    {
+        Utils::RecordDrawList( m_draw_list_, 0, entries.size(), m_commands_.front() );
+        return;
+    }
+    
+    std::vector< cFuture< void > > slices;
+    slices.reserve( m_command_count_ - 1 );
+    
+    size_t begin = 0;
+    for( size_t slice = 0; slice < m_command_count_; slice++ )
+    {
+        // Slices end between instanced runs, so a run isn't split into two draws.
+        auto end = std::max( begin, entries.size() * ( slice + 1 ) / m_command_count_ );
+        while( end < entries.size() && end > 0 && is_same_run( end ) )
+            end++;
         
-        auto& mesh = *fst;
+        // Only the workers run queued jobs, so the last slice is recorded here instead of idling.
+        if( slice == m_command_count_ - 1 )
+            Utils::RecordDrawList( m_draw_list_, begin, end, m_commands_[ slice ] );
+        else
+            slices.emplace_back( record_slice( m_draw_list_, begin, end, m_commands_[ slice ] ).Start() );
         
-        if( !mesh->IsReady() )
-            continue;
-
-        // TODO: Add a local render function that's more optimized
-        const bool res = Utils::RenderMesh( _camera, frame_buffer,
-            *mesh->GetMaterial(), mesh->GetTransform().GetWorld(), *mesh->GetMesh() );
-        if( !res )
-            SK_BREAK;
+        begin = end;
     }
+    
+    for( const auto& slice : slices )
+        slice.Wait();
 }
@@ -3,13 +3,18 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include <sk/Graphics/Passes/Render_Pass.h>
 #include <sk/Graphics/Rendering/Render_Context.h>
+#include <sk/Graphics/Utils/Draw_List.h>
+#include <sk/Graphics/Utils/Frustum_Culling.h>
+#include <sk/Graphics/Utils/RenderUtils.h>
 
 namespace sk::Object::Components
 {
     class cCameraComponent;
+    class cMeshComponent;
 } // sk::Object::Components::
 
 namespace sk::Graphics::Passes
@@ -18,15 +23,41 @@ namespace sk::Graphics::Passes
     {
     public:
         void Init   () override;
+        void Setup  ( cRender_Graph::cBuilder& _builder ) override;
         bool Begin  () override;
         void End    () override;
         void Destroy() override;
         
-        void RenderWithCamera( const Object::Components::cCameraComponent& _camera ) const;
+        void RenderWithCamera( const Object::Components::cCameraComponent& _camera );
 
-        auto& GetFront() const { return m_render_context_->GetFront(); }
+        // The key the draws are sorted by, grouping them by program, material, mesh and lod so each is only bound once.
+        static auto MakeKey( Utils::cDraw_List& _list, uint32_t _program, const Assets::cMaterial* _material, const Assets::cMesh* _mesh, size_t _lod, float _depth ) -> uint64_t;
+
+        // The amount of meshes tested and drawn during the last RenderWithCamera.
+        auto GetTestedCount () const { return m_cull_meshes_.size(); }
+        auto GetVisibleCount() const { return m_visible_.size(); }
+        // The state changes made while submitting the last RenderWithCamera.
+        auto& GetDrawStats   () const { return m_draw_stats_; }
         
     private:
+        // Splits the sorted draw list into slices recorded in parallel on the asset workers.
+        void record_draws();
+        
         std::unique_ptr< Rendering::cRender_Context > m_render_context_;
+        // Owned by the graph, bound to the frame buffer before rendering.
+        cRender_Graph::resource_t m_position_ = cRender_Graph::kInvalid;
+        cRender_Graph::resource_t m_normal_   = cRender_Graph::kInvalid;
+        cRender_Graph::resource_t m_albedo_   = cRender_Graph::kInvalid;
+        cRender_Graph::resource_t m_depth_    = cRender_Graph::kInvalid;
+
+        // Kept between frames to avoid reallocating.
+        std::vector< Object::Components::cMeshComponent* > m_cull_meshes_;
+        Utils::sPacked_Bounds                              m_cull_bounds_;
+        std::vector< uint32_t >                            m_visible_;
+        Utils::cDraw_List                                  m_draw_list_;
+        std::vector< Utils::cCommand_Buffer >              m_commands_;
+        size_t                                             m_command_count_ = 0;
+        Utils::instance_buffer_t                           m_instances_{ "GBuffer Instances" };
+        Utils::sDraw_Stats                                 m_draw_stats_;
     };
 } // sk::Graphics::Passes::
@@ -2,6 +2,9 @@
 
 #include "Light_Pass.h"
 
+#include <sk/Scene/Components/CameraComponent.h>
+#include <sk/Scene/Managers/CameraManager.h>
+#include <sk/Scene/Managers/Light_Manager.h>
 
 using namespace sk::Graphics::Passes;
 
@@ -13,7 +16,15 @@ void cLight_Pass::Init()
 
 bool cLight_Pass::Begin()
 {
+    const auto main_camera = Scene::cCameraManager::get().getMainCamera();
+    if( main_camera == nullptr )
+        return false;
     
+    auto& light_manager = Scene::cLight_Manager::get();
+    light_manager.UpdateClusters   ( *main_camera );
+    light_manager.UpdateShadowAtlas( *main_camera );
+    
+    return true;
 }
 
 void cLight_Pass::End()
@@ -9,6 +9,7 @@
 
 namespace sk::Graphics::Passes
 {
+    // Assigns the lights to the clusters of the main camera, ahead of the passes shading with them.
     class cLight_Pass : public iPass
     {
     public:
@@ -4,6 +4,8 @@
 
 // TODO: Rename this file to "Pass"
 
+#include <sk/Graphics/Pipelines/Render_Graph.h>
+
 #include <string>
 
 namespace sk::Graphics
@@ -32,6 +34,9 @@ namespace sk::Graphics::Passes
         std::string name;
         
         virtual void Init   () = 0;
+        // Declares the textures the pass uses, called again whenever the pipeline recompiles its graph.
+        // Passes which don't declare anything are always kept, and run in the order they were added.
+        virtual void Setup  ( cRender_Graph::cBuilder& _builder ){ _builder.SetSideEffect(); }
         virtual bool Begin  () = 0;
         virtual void End    () = 0;
         virtual void Destroy() = 0;
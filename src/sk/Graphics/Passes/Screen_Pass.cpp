@@ -2,7 +2,9 @@
 
 #include "Screen_Pass.h"
 
+#include <sk/Graphics/Pipelines/Pipeline.h>
 #include <sk/Graphics/Rendering/Frame_Buffer.h>
+#include <sk/Graphics/Rendering/Graph_Backend.h>
 #include <sk/Graphics/Rendering/Scissor.h>
 #include <sk/Graphics/Rendering/Viewport.h>
 #include <sk/Graphics/Rendering/Window_Context.h>
@@ -19,6 +21,11 @@ cScreen_Pass::cScreen_Pass( Platform::iWindow* _window, const cShared_ptr< cAsse
     m_screen_vertex_buffer_.AlignAs< cVector2f >();
 }
 
+void cScreen_Pass::Sample( std::string _resource, const cStringID& _sampler )
+{
+    m_inputs_.push_back( sInput{ .name = std::move( _resource ), .sampler = _sampler } );
+}
+
 void cScreen_Pass::Init()
 {
     static constexpr cVector2f kVertexArray[] = {
@@ -31,11 +38,24 @@ void cScreen_Pass::Init()
     m_material_ = m_material_meta_.Lock();
 }
 
+void cScreen_Pass::Setup( cRender_Graph::cBuilder& _builder )
+{
+    for( auto& input : m_inputs_ )
+        input.resource = _builder.Read( input.name );
+    
+    _builder.Write( "Backbuffer" );
+}
+
 bool cScreen_Pass::Begin()
 {
     if( !m_material_.IsLoaded() )
         return false;
     
+    const auto& graph   = getPipeline().GetGraph();
+    const auto& backend = getPipeline().GetGraphBackend();
+    for( const auto& input : m_inputs_ )
+        m_material_->SetTexture( input.sampler, backend.GetRenderTarget( graph.GetTexture( input.resource ) ) );
+    
     const auto  resolution = m_window_->GetResolution();
     auto viewport = sViewport{ .x = 0, .y = 0, .width = resolution.x, .height = resolution.y };
     auto scissor  = sScissor{  .x = 0, .y = 0, .width = resolution.x, .height = resolution.y };
@@ -47,10 +67,10 @@ bool cScreen_Pass::Begin()
     
     m_material_meta_->LockAsset();
     
-    m_material_->Update();
     bool res = false;
     if( frame_buffer.UseMaterial( *m_material_ ) )
     {
+        frame_buffer.UploadBlocks( *m_material_ );
         frame_buffer.BindVertexBuffer( 0, &m_screen_vertex_buffer_ );
 
         res = frame_buffer.DrawAuto();
@@ -8,6 +8,9 @@
 #include <sk/Assets/Access/Asset_Ref.h>
 #include <sk/Graphics/Buffer/Dynamic_Buffer.h>
 
+#include <string>
+#include <vector>
+
 namespace sk
 {
     class cAsset_Meta;
@@ -25,16 +28,28 @@ namespace sk::Graphics::Passes
     public:
         explicit cScreen_Pass( Platform::iWindow* _window, const cShared_ptr< cAsset_Meta >& _screen_material );
         
+        // Binds a texture from the pipelines graph to a sampler in the screen material, has to be called before the pipeline is initialized.
+        void Sample( std::string _resource, const cStringID& _sampler );
+        
         void Init   () override;
+        void Setup  ( cRender_Graph::cBuilder& _builder ) override;
         bool Begin  () override;
         void End    () override;
         void Destroy() override;
         
     private:
+        struct sInput
+        {
+            std::string               name;
+            cStringID                 sampler;
+            cRender_Graph::resource_t resource = cRender_Graph::kInvalid;
+        };
+        
         cDynamic_Buffer    m_screen_vertex_buffer_;
         Platform::iWindow* m_window_;
         
         cWeak_Ptr< cAsset_Meta >        m_material_meta_;
         cAsset_Ref< Assets::cMaterial > m_material_;
+        std::vector< sInput >           m_inputs_;
     };
 } // sk::Graphics::Passes::
@@ -4,9 +4,8 @@
 
 #include <sk/Assets/Management/Asset_Manager.h>
 #include <sk/Graphics/Passes/GBuffer_Pass.h>
+#include <sk/Graphics/Passes/Light_Pass.h>
 #include <sk/Graphics/Passes/Screen_Pass.h>
-#include <sk/Graphics/Rendering/Frame_Buffer.h>
-#include <sk/Graphics/Rendering/Render_Target.h>
 #include <sk/Platform/Window/Window_Base.h>
 
 using namespace sk::Graphics;
@@ -19,7 +18,8 @@ cDeferred_Pipeline::cDeferred_Pipeline( Platform::iWindow* _window )
 
 void cDeferred_Pipeline::Initialize()
 {
-    m_gbuffer_pass_ = &AddPass< Passes::cGBuffer_Pass >();
+    AddPass< Passes::cGBuffer_Pass >();
+    AddPass< Passes::cLight_Pass >();
     
     auto& asset_manager = cAsset_Manager::get();
     const auto screen_shader   = asset_manager.GetAssetByPath( "shaders/screen.vert" );
@@ -29,17 +29,8 @@ void cDeferred_Pipeline::Initialize()
     );
     m_screen_material_ = material_meta;
     
-    AddPass< Passes::cScreen_Pass >( m_window_, material_meta );
+    auto& screen_pass = AddPass< Passes::cScreen_Pass >( m_window_, material_meta );
+    screen_pass.Sample( "GBuffer Albedo", "Albedo" );
     
     cPipeline::Initialize();
 }
-
-void cDeferred_Pipeline::Execute()
-{
-    cPipeline::Execute();
-
-    const auto& front = m_gbuffer_pass_->GetFront();
-    auto& color_buffer = front.GetRenderTarget( 2 );
-
-    m_screen_material_->SetTexture( "Albedo", color_buffer );
-}
@@ -5,11 +5,6 @@
 #include <sk/Assets/Material.h>
 #include <sk/Graphics/Pipelines/Pipeline.h>
 
-namespace sk::Graphics::Passes
-{
-    class cGBuffer_Pass;
-}
-
 namespace sk::Platform
 {
     class iWindow;
@@ -22,10 +17,8 @@ namespace sk::Graphics
     public:
         explicit cDeferred_Pipeline( Platform::iWindow* _window );
         void Initialize() override;
-        void Execute() override;
         
     private:
-        Passes::cGBuffer_Pass*          m_gbuffer_pass_ = nullptr;
         cAsset_Ref< Assets::cMaterial > m_screen_material_;
     };
 } // sk::Graphics::
@@ -5,6 +5,7 @@
 #include <sk/Debugging/Debugging.h>
 #include <sk/Graphics/Renderer_Impl.h>
 #include <sk/Graphics/Passes/Render_Pass.h>
+#include <sk/Platform/Window/Window_Base.h>
 #include <sk/Scene/Managers/EventManager.h>
 #include <sk/Scene/Managers/SceneManager.h>
 
@@ -14,25 +15,37 @@ sk::Graphics::cPipeline::cPipeline( Platform::iWindow* _window )
 
 void sk::Graphics::cPipeline::Initialize()
 {
+    m_graph_.Import( "Backbuffer", Rendering::cGraph_Backend::kWindow );
+    
     for( const auto& pass : m_passes_ )
     {
         pass->m_current_pipeline_ = this;
         pass->Init();
+        
+        m_graph_.AddPass( pass->name,
+            [ pass = pass.get() ]( cRender_Graph::cBuilder& _builder ){ pass->Setup( _builder ); },
+            [ pass = pass.get() ]( const cRender_Graph& )
+            {
+                if( pass->Begin() )
+                {
+                    // TODO: Figure out the logic to have here
+                    pass->End();
+                }
+            } );
     }
     
+    m_graph_.Compile();
+    
     m_initialized_ = true;
 } // Initialize
 
 void sk::Graphics::cPipeline::Execute()
 {
-    for( const auto& pass : m_passes_ )
-    {
-        if( pass->Begin() )
-        {
-            // TODO: Figure out the logic to have here
-            pass->End();
-        }
-    }
+    // The sizes of the textures follow the window.
+    if( m_window_->WasResizedThisFrame() )
+        m_graph_.Compile();
+    
+    m_graph_.Execute();
 } // Start
 
 void sk::Graphics::cPipeline::Destroy()
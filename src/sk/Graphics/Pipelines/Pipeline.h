@@ -3,6 +3,8 @@
 #pragma once
 
 #include <sk/Graphics/Passes/Render_Pass.h>
+#include <sk/Graphics/Pipelines/Render_Graph.h>
+#include <sk/Graphics/Rendering/Graph_Backend.h>
 
 #include <memory>
 #include <vector>
@@ -32,6 +34,10 @@ namespace sk::Graphics
         
         auto GetWindow() const { return m_window_; }
 
+        // The passes are executed through the graph, which owns the textures passed between them.
+        [[ nodiscard ]] auto& GetGraph       () const { return m_graph_; }
+        [[ nodiscard ]] auto& GetGraphBackend() const { return m_graph_backend_; }
+
         template< class Ty, class... Args >
         requires std::constructible_from< Ty, Args... >
         Ty&  AddPass( Args&&... _args );
@@ -45,6 +51,10 @@ namespace sk::Graphics
     private:
         bool       m_initialized_ = false;
         pass_vec_t m_passes_      = {};
+
+        // The backend has to outlive the graph, as the graph destroys its textures through it.
+        Rendering::cGraph_Backend m_graph_backend_;
+        cRender_Graph             m_graph_{ m_graph_backend_ };
     };
 
     template< class Ty, class ... Args >
@@ -0,0 +1,420 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Render_Graph.h"
+
+#include <sk/Debugging/Macros/Assert.h>
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+
+namespace sk::Graphics
+{
+    auto cRender_Graph::cBuilder::Create( const std::string& _name, const sGraph_Texture& _desc ) -> resource_t
+    {
+        const auto resource = m_graph_.get_resource( _name );
+        auto& data = m_graph_.m_resources_[ resource ];
+
+        SK_BREAK_RET_IF( sk::Severity::kGraphics, data.creator != kNoPass || data.imported,
+            TEXT( "Error: The render graph resource {} is already created or imported.", _name ), resource )
+
+        data.desc    = _desc;
+        data.creator = m_pass_;
+        m_graph_.access( m_pass_, resource, eGraph_Access::kWrite );
+
+        return resource;
+    } // Create
+
+    auto cRender_Graph::cBuilder::Read( const std::string& _name ) -> resource_t
+    {
+        const auto resource = m_graph_.get_resource( _name );
+        m_graph_.access( m_pass_, resource, eGraph_Access::kRead );
+
+        return resource;
+    } // Read
+
+    auto cRender_Graph::cBuilder::Write( const std::string& _name ) -> resource_t
+    {
+        const auto resource = m_graph_.get_resource( _name );
+        m_graph_.access( m_pass_, resource, eGraph_Access::kWrite );
+
+        return resource;
+    } // Write
+
+    void cRender_Graph::cBuilder::SetSideEffect()
+    {
+        m_graph_.m_passes_[ m_pass_ ].side_effect = true;
+    } // SetSideEffect
+
+    cRender_Graph::cRender_Graph( iGraph_Backend& _backend )
+    : m_backend_( _backend )
+    {} // cRender_Graph
+
+    cRender_Graph::~cRender_Graph()
+    {
+        release();
+
+        for( const auto& slot : m_pool_ )
+            m_backend_.Destroy( slot.texture );
+    } // ~cRender_Graph
+
+    void cRender_Graph::Import( const std::string& _name, const uint32_t _texture )
+    {
+        m_imports_[ _name ] = _texture;
+        m_compiled_ = false;
+    } // Import
+
+    void cRender_Graph::AddPass( std::string _name, setup_fn_t _setup, execute_fn_t _execute )
+    {
+        m_passes_.push_back( sPass{ .name = std::move( _name ), .setup = std::move( _setup ), .execute = std::move( _execute ) } );
+        m_compiled_ = false;
+    } // AddPass
+
+    bool cRender_Graph::Compile()
+    {
+        release();
+
+        m_compiled_ = false;
+        m_stats_    = {};
+        m_order_    .clear();
+        m_resources_.clear();
+        m_names_    .clear();
+
+        for( size_t i = 0; i < m_passes_.size(); i++ )
+        {
+            auto& pass = m_passes_[ i ];
+            pass.side_effect = false;
+            pass.accesses.clear();
+            pass.barriers.clear();
+
+            cBuilder builder{ *this, i };
+            pass.setup( builder );
+        }
+
+        for( size_t i = 0; i < m_passes_.size(); i++ )
+        {
+            auto& pass = m_passes_[ i ];
+            for( const auto& [ resource, access ] : pass.accesses )
+            {
+                auto& data = m_resources_[ resource ];
+                if( access == eGraph_Access::kRead )
+                {
+                    data.readers.push_back( i );
+                    continue;
+                }
+
+                data.writers.push_back( i );
+                // Anything written outside of the graph is seen by something after it.
+                if( data.imported )
+                    pass.side_effect = true;
+            }
+        }
+
+        // Whatever pass created a resource has to write to it first.
+        for( auto& data : m_resources_ )
+            std::ranges::stable_partition( data.writers, [ & ]( const size_t _pass ){ return _pass == data.creator; } );
+
+        if( !validate() )
+            return false;
+
+        std::vector< bool > kept;
+        cull( kept );
+
+        if( !sort( kept ) )
+            return false;
+
+        alias();
+        place_barriers();
+
+        m_stats_.passes = m_order_.size();
+        m_stats_.culled = m_passes_.size() - m_order_.size();
+        m_compiled_     = true;
+
+        return true;
+    } // Compile
+
+    void cRender_Graph::Execute()
+    {
+        SK_BREAK_RET_IF( sk::Severity::kGraphics, !m_compiled_,
+            "Error: The render graph has to be compiled before being executed." )
+
+        for( const auto index : m_order_ )
+        {
+            const auto& pass = m_passes_[ index ];
+            for( const auto& barrier : pass.barriers )
+                m_backend_.Barrier( barrier.texture, barrier.from, barrier.to );
+
+            pass.execute( *this );
+        }
+    } // Execute
+
+    auto cRender_Graph::GetResource( const std::string& _name ) const -> resource_t
+    {
+        const auto itr = m_names_.find( _name );
+        return itr != m_names_.end() ? itr->second : kInvalid;
+    } // GetResource
+
+    auto cRender_Graph::GetTexture( const resource_t _resource ) const -> uint32_t
+    {
+        SK_BREAK_RET_IF( sk::Severity::kGraphics, _resource >= m_resources_.size(),
+            "Error: Trying to get the texture of an invalid render graph resource.", kInvalid )
+
+        const auto& data = m_resources_[ _resource ];
+        if( data.imported || data.texture == kInvalid )
+            return data.texture;
+
+        return m_slots_[ data.texture ].texture;
+    } // GetTexture
+
+    auto cRender_Graph::get_resource( const std::string& _name ) -> resource_t
+    {
+        const auto [ itr, inserted ] = m_names_.try_emplace( _name, static_cast< resource_t >( m_resources_.size() ) );
+        if( !inserted )
+            return itr->second;
+
+        auto& data = m_resources_.emplace_back( sResource{ .name = _name } );
+        if( const auto import = m_imports_.find( _name ); import != m_imports_.end() )
+        {
+            data.imported = true;
+            data.texture  = import->second;
+        }
+
+        return itr->second;
+    } // get_resource
+
+    void cRender_Graph::access( const size_t _pass, const resource_t _resource, const eGraph_Access _access )
+    {
+        // A pass reading and writing the same resource only counts as a write.
+        auto& accesses = m_passes_[ _pass ].accesses;
+        const auto itr = std::ranges::find( accesses, _resource, &std::pair< resource_t, eGraph_Access >::first );
+        if( itr != accesses.end() )
+            itr->second = std::max( itr->second, _access );
+        else
+            accesses.emplace_back( _resource, _access );
+    } // access
+
+    bool cRender_Graph::validate() const
+    {
+        for( const auto& data : m_resources_ )
+        {
+            SK_BREAK_RET_IF( sk::Severity::kGraphics, !data.imported && data.creator == kNoPass,
+                TEXT( "Error: The render graph resource {} is used, but never created or imported.", data.name ), false )
+        }
+
+        return true;
+    } // validate
+
+    void cRender_Graph::cull( std::vector< bool >& _kept ) const
+    {
+        _kept.assign( m_passes_.size(), false );
+
+        std::vector< size_t > pending;
+        const auto keep = [ & ]( const size_t _pass )
+        {
+            if( _kept[ _pass ] )
+                return;
+
+            _kept[ _pass ] = true;
+            pending.push_back( _pass );
+        };
+
+        for( size_t i = 0; i < m_passes_.size(); i++ )
+        {
+            if( m_passes_[ i ].side_effect )
+                keep( i );
+        }
+
+        // Walks back from the passes which are kept, through everything they depend on.
+        while( !pending.empty() )
+        {
+            const auto pass = pending.back();
+            pending.pop_back();
+
+            for( const auto& [ resource, access ] : m_passes_[ pass ].accesses )
+            {
+                const auto& data = m_resources_[ resource ];
+                if( access == eGraph_Access::kRead )
+                {
+                    for( const auto writer : data.writers )
+                        keep( writer );
+                }
+                else if( data.creator != kNoPass )
+                    keep( data.creator );
+            }
+        }
+    } // cull
+
+    bool cRender_Graph::sort( const std::vector< bool >& _kept )
+    {
+        std::vector< std::vector< size_t > > edges( m_passes_.size() );
+        std::vector< size_t >                incoming( m_passes_.size(), 0 );
+
+        const auto add_edge = [ & ]( const size_t _from, const size_t _to )
+        {
+            edges[ _from ].push_back( _to );
+            incoming[ _to ]++;
+        };
+
+        std::vector< size_t > writers;
+        for( const auto& data : m_resources_ )
+        {
+            // Writers run in the order they were added.
+            writers.clear();
+            std::ranges::copy_if( data.writers, std::back_inserter( writers ), [ & ]( const size_t _pass ){ return _kept[ _pass ]; } );
+            if( writers.empty() )
+                continue;
+
+            for( size_t i = 1; i < writers.size(); i++ )
+                add_edge( writers[ i - 1 ], writers[ i ] );
+
+            // Readers see the last write added before them, and the write after that waits for them.
+            // Readers added before any write see the final result.
+            for( const auto reader : data.readers )
+            {
+                if( !_kept[ reader ] )
+                    continue;
+
+                auto previous = writers.size() - 1;
+                for( size_t i = 0; i < writers.size(); i++ )
+                {
+                    if( writers[ i ] < reader )
+                        previous = i;
+                }
+
+                add_edge( writers[ previous ], reader );
+                if( writers[ previous ] < reader && previous + 1 < writers.size() )
+                    add_edge( reader, writers[ previous + 1 ] );
+            }
+        }
+
+        // Ties go to the pass added first, so independent passes keep the order they were added in.
+        std::priority_queue< size_t, std::vector< size_t >, std::greater<> > ready;
+        size_t kept_count = 0;
+        for( size_t i = 0; i < m_passes_.size(); i++ )
+        {
+            if( !_kept[ i ] )
+                continue;
+
+            kept_count++;
+            if( incoming[ i ] == 0 )
+                ready.push( i );
+        }
+
+        while( !ready.empty() )
+        {
+            const auto pass = ready.top();
+            ready.pop();
+            m_order_.push_back( pass );
+
+            for( const auto next : edges[ pass ] )
+            {
+                if( --incoming[ next ] == 0 )
+                    ready.push( next );
+            }
+        }
+
+        SK_BREAK_RET_IF( sk::Severity::kGraphics, m_order_.size() != kept_count,
+            "Error: The passes in the render graph depend on each other in a cycle.", false )
+
+        return true;
+    } // sort
+
+    void cRender_Graph::alias()
+    {
+        // The first and last position in the order each resource is used at.
+        std::vector< size_t > first( m_resources_.size(), kNoPass );
+        std::vector< size_t > last ( m_resources_.size(), 0 );
+
+        for( size_t position = 0; position < m_order_.size(); position++ )
+        {
+            for( const auto& [ resource, _ ] : m_passes_[ m_order_[ position ] ].accesses )
+            {
+                first[ resource ] = std::min( first[ resource ], position );
+                last [ resource ] = std::max( last [ resource ], position );
+            }
+        }
+
+        std::vector< resource_t > transients;
+        for( resource_t i = 0; i < m_resources_.size(); i++ )
+        {
+            if( !m_resources_[ i ].imported && first[ i ] != kNoPass )
+                transients.push_back( i );
+        }
+
+        std::ranges::sort( transients, {}, [ & ]( const resource_t _resource ){ return first[ _resource ]; } );
+
+        for( const auto resource : transients )
+        {
+            auto& data = m_resources_[ resource ];
+            const auto bytes = m_backend_.GetByteSize( data.desc );
+
+            m_stats_.transient++;
+            m_stats_.transient_bytes += bytes;
+
+            // Any texture of the same kind which nothing uses anymore can be handed over.
+            auto slot = std::ranges::find_if( m_slots_, [ & ]( const sSlot& _slot )
+            {
+                return _slot.desc == data.desc && _slot.last_use < first[ resource ];
+            } );
+
+            if( slot == m_slots_.end() )
+            {
+                const auto pooled = std::ranges::find( m_pool_, data.desc, &sSlot::desc );
+                if( pooled != m_pool_.end() )
+                {
+                    m_slots_.push_back( *pooled );
+                    m_pool_.erase( pooled );
+                }
+                else
+                    m_slots_.push_back( sSlot{ .desc = data.desc, .texture = m_backend_.Create( data.desc ) } );
+
+                slot = std::prev( m_slots_.end() );
+                m_stats_.physical_bytes += bytes;
+            }
+
+            slot->last_use = last[ resource ];
+            data.texture   = static_cast< uint32_t >( std::distance( m_slots_.begin(), slot ) );
+        }
+
+        m_stats_.physical = m_slots_.size();
+
+        for( const auto& slot : m_pool_ )
+            m_backend_.Destroy( slot.texture );
+        m_pool_.clear();
+    } // alias
+
+    void cRender_Graph::place_barriers()
+    {
+        // Tracked per texture rather than resource, so handing a texture over to another resource gets one as well.
+        std::unordered_map< uint32_t, eGraph_Access > last_access;
+
+        for( const auto index : m_order_ )
+        {
+            auto& pass = m_passes_[ index ];
+            for( const auto& [ resource, access ] : pass.accesses )
+            {
+                const auto texture = GetTexture( resource );
+                if( texture == kInvalid )
+                    continue;
+
+                const auto [ itr, inserted ] = last_access.try_emplace( texture, access );
+                if( inserted || itr->second == access )
+                    continue;
+
+                pass.barriers.push_back( sBarrier{ .texture = texture, .from = itr->second, .to = access } );
+                itr->second = access;
+                m_stats_.barriers++;
+            }
+        }
+    } // place_barriers
+
+    void cRender_Graph::release()
+    {
+        m_pool_.insert( m_pool_.end(), m_slots_.begin(), m_slots_.end() );
+        m_slots_.clear();
+    } // release
+} // sk::Graphics
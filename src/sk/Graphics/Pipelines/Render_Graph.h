@@ -0,0 +1,198 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include <sk/Math/Vector2.h>
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace sk::Graphics
+{
+    // What the graph asks the backend to create, the graph itself only compares them.
+    struct sGraph_Texture
+    {
+        enum class eType : uint8_t
+        {
+            kColor,
+            kDepth,
+        };
+
+        cVector2u32 resolution;
+        eType       type;
+        // The backends own format enum.
+        uint32_t    format;
+
+        bool operator==( const sGraph_Texture& ) const = default;
+    };
+
+    enum class eGraph_Access : uint8_t
+    {
+        kNone,
+        kRead,
+        kWrite,
+    };
+
+    // Owns the textures behind the graph. Swapping it for one which only hands out ids lets a graph be compiled without a gpu.
+    class iGraph_Backend
+    {
+    public:
+        virtual ~iGraph_Backend() = default;
+
+        virtual auto Create ( const sGraph_Texture& _desc ) -> uint32_t = 0;
+        virtual void Destroy( uint32_t _texture ) = 0;
+        [[ nodiscard ]] virtual auto GetByteSize( const sGraph_Texture& _desc ) const -> size_t = 0;
+
+        // Called before a pass which uses the texture differently than the last pass did.
+        virtual void Barrier( uint32_t _texture, eGraph_Access _from, eGraph_Access _to ) = 0;
+    };
+
+    /**
+     * Passes declare which named textures they create, read and write, and the graph works out the rest when compiled:
+     * Passes whose results are never used are culled, the rest are ordered so a pass reads what the passes added before it wrote,
+     * barriers are placed where a texture changes from being written to read and back,
+     * and textures created by passes share memory with others whose lifetimes don't overlap.
+     */
+    class cRender_Graph
+    {
+    public:
+        using resource_t = uint32_t;
+        static constexpr resource_t kInvalid = std::numeric_limits< resource_t >::max();
+
+        class cBuilder
+        {
+            friend class cRender_Graph;
+        public:
+            // The texture only lives within the frame, and might share memory with others.
+            auto Create( const std::string& _name, const sGraph_Texture& _desc ) -> resource_t;
+            // Created by another pass, or imported. The passes can be added in any order.
+            auto Read  ( const std::string& _name ) -> resource_t;
+            auto Write ( const std::string& _name ) -> resource_t;
+            // Keeps the pass even if nothing uses what it writes.
+            void SetSideEffect();
+
+        private:
+            cBuilder( cRender_Graph& _graph, size_t _pass ) : m_graph_( _graph ), m_pass_( _pass ){}
+
+            cRender_Graph& m_graph_;
+            size_t         m_pass_;
+        };
+
+        struct sStats
+        {
+            size_t passes   = 0;
+            size_t culled   = 0;
+            size_t barriers = 0;
+            // Textures created by passes, and the textures actually allocated for them.
+            size_t transient = 0;
+            size_t physical  = 0;
+            // What the textures would take up without aliasing, and what they do.
+            size_t transient_bytes = 0;
+            size_t physical_bytes  = 0;
+        };
+
+        using setup_fn_t   = std::function< void( cBuilder& ) >;
+        using execute_fn_t = std::function< void( const cRender_Graph& ) >;
+
+        explicit cRender_Graph( iGraph_Backend& _backend );
+        ~cRender_Graph();
+
+        cRender_Graph( const cRender_Graph& ) = delete;
+        cRender_Graph& operator=( const cRender_Graph& ) = delete;
+
+        // A texture which lives outside of the graph, like the window. Writing to one keeps the pass.
+        void Import( const std::string& _name, uint32_t _texture );
+        void AddPass( std::string _name, setup_fn_t _setup, execute_fn_t _execute );
+
+        /**
+         * Runs the setup of every pass and builds the frame from scratch, has to be called again when a description changes.
+         * @return False if the graph is invalid, in which case nothing is executed.
+         */
+        bool Compile();
+        void Execute();
+
+        [[ nodiscard ]] auto GetResource( const std::string& _name ) const -> resource_t;
+        // The texture the resource ended up with, only valid during execution.
+        [[ nodiscard ]] auto GetTexture ( resource_t _resource ) const -> uint32_t;
+
+        [[ nodiscard ]] bool  IsCompiled() const { return m_compiled_; }
+        // Indices of the passes in the order they're added, in the order they're executed.
+        [[ nodiscard ]] auto& GetOrder  () const { return m_order_; }
+        [[ nodiscard ]] auto& GetStats  () const { return m_stats_; }
+
+    private:
+        static constexpr size_t kNoPass = std::numeric_limits< size_t >::max();
+
+        struct sResource
+        {
+            std::string    name;
+            sGraph_Texture desc     = {};
+            bool           imported = false;
+            // The imported texture, or the slot it got aliased into.
+            uint32_t       texture  = kInvalid;
+            size_t         creator  = kNoPass;
+            std::vector< size_t > writers  = {};
+            std::vector< size_t > readers  = {};
+        };
+
+        struct sBarrier
+        {
+            uint32_t      texture;
+            eGraph_Access from;
+            eGraph_Access to;
+        };
+
+        struct sPass
+        {
+            std::string  name;
+            setup_fn_t   setup;
+            execute_fn_t execute;
+
+            bool side_effect = false;
+            std::vector< std::pair< resource_t, eGraph_Access > > accesses = {};
+            std::vector< sBarrier > barriers = {};
+        };
+
+        struct sSlot
+        {
+            sGraph_Texture desc;
+            uint32_t       texture;
+            // Position in the order of the last pass using it.
+            size_t         last_use = 0;
+        };
+
+        auto get_resource( const std::string& _name ) -> resource_t;
+        void access( size_t _pass, resource_t _resource, eGraph_Access _access );
+
+        bool validate() const;
+        void cull( std::vector< bool >& _kept ) const;
+        bool sort( const std::vector< bool >& _kept );
+        void alias();
+        void place_barriers();
+        // Moves the textures into the pool, where the next compile can take them back.
+        void release();
+
+        iGraph_Backend& m_backend_;
+
+        std::vector< sPass >     m_passes_;
+        std::vector< sResource > m_resources_;
+        std::unordered_map< std::string, resource_t > m_names_;
+        std::unordered_map< std::string, uint32_t >   m_imports_;
+
+        std::vector< size_t > m_order_;
+        std::vector< sSlot >  m_slots_;
+        // Textures from the last compile, so a recompile with the same sizes doesn't recreate them.
+        std::vector< sSlot >  m_pool_;
+
+        bool   m_compiled_ = false;
+        sStats m_stats_;
+    };
+} // sk::Graphics
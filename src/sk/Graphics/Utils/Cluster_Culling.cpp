@@ -0,0 +1,64 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Cluster_Culling.h"
+
+#include <algorithm>
+
+namespace sk::Graphics::Utils
+{
+    auto CullMeshlets( const std::vector< Assets::Utils::sMeshlet >& _meshlets, const cMatrix4x4f& _world, const cFrustumf& _frustum,
+        const cVector3f& _view_position, std::vector< sMeshlet_Range >& _out_ranges ) -> size_t
+    {
+        const cVector3f right = _world.x;
+        const cVector3f up    = _world.y;
+        const cVector3f front = _world.z;
+
+        const auto right_sq = Math::Vector3::Dot( right );
+        const auto up_sq    = Math::Vector3::Dot( up );
+        const auto front_sq = Math::Vector3::Dot( front );
+
+        const auto max_scale = Math::sqrt( std::max( { right_sq, up_sq, front_sq } ) );
+        const auto min_scale = Math::sqrt( std::min( { right_sq, up_sq, front_sq } ) );
+
+        // Cones can't be transformed by a non uniformly scaled matrix without the inverse transpose, so they're skipped instead.
+        const bool use_cones = max_scale - min_scale <= max_scale * 0.001f && max_scale > 0.0f;
+        const auto inv_scale = use_cones ? 1.0f / max_scale : 0.0f;
+
+        size_t survivors = 0;
+        for( uint32_t i = 0; i < _meshlets.size(); i++ )
+        {
+            const auto& meshlet = _meshlets[ i ];
+
+            const auto& c      = meshlet.center;
+            const auto  center = right * c.x + up * c.y + front * c.z + cVector3f{ _world.w };
+            const auto  radius = meshlet.radius * max_scale;
+
+            if( !_frustum.Intersects( center, radius ) )
+                continue;
+
+            if( use_cones && meshlet.cone_cutoff < 1.0f )
+            {
+                const auto& a    = meshlet.cone_axis;
+                const auto  axis = ( right * a.x + up * a.y + front * a.z ) * inv_scale;
+                const auto  view = center - _view_position;
+
+                // The whole cluster is facing away from the camera.
+                if( Math::Vector3::Dot( view, axis ) >= meshlet.cone_cutoff * Math::Vector3::Length( view ) + radius )
+                    continue;
+            }
+
+            if( !_out_ranges.empty() && _out_ranges.back().first + _out_ranges.back().count == i )
+                ++_out_ranges.back().count;
+            else
+                _out_ranges.emplace_back( i, 1u );
+
+            ++survivors;
+        }
+
+        return survivors;
+    } // CullMeshlets
+} // sk::Graphics::Utils
@@ -0,0 +1,35 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include <sk/Assets/Utils/Meshlet_Builder.h>
+#include <sk/Math/Frustum.h>
+
+#include <vector>
+
+namespace sk::Graphics::Utils
+{
+    // A range of consecutive meshlets that survived culling.
+    struct sMeshlet_Range
+    {
+        uint32_t first;
+        uint32_t count;
+    };
+
+    /**
+     * Culls meshlets against a frustum and their normal cones.
+     * 
+     * @param _meshlets      The meshlets to cull, in object space.
+     * @param _world         The world matrix of the object the meshlets belong to.
+     * @param _frustum       The frustum in world space.
+     * @param _view_position The cameras position in world space.
+     * @param _out_ranges    Gets the surviving ranges appended to it.
+     * @return The amount of meshlets that survived.
+     */
+    auto CullMeshlets( const std::vector< Assets::Utils::sMeshlet >& _meshlets, const cMatrix4x4f& _world, const cFrustumf& _frustum,
+        const cVector3f& _view_position, std::vector< sMeshlet_Range >& _out_ranges ) -> size_t;
+} // sk::Graphics::Utils
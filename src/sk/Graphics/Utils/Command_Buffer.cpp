@@ -0,0 +1,51 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Command_Buffer.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace sk::Graphics::Utils;
+
+auto cCommand_Buffer::push( const eCommand _type, const size_t _command_bytes, const size_t _payload_bytes ) -> std::byte*
+{
+    const auto blocks = kHeaderBlocks + blocks_for( _command_bytes + _payload_bytes );
+
+    if( m_size_ + blocks > m_capacity_ )
+        Reserve( std::max( ( m_size_ + blocks ) * kAlignment, m_capacity_ * kAlignment * 2 ) );
+
+    const auto header = std::construct_at( reinterpret_cast< sHeader* >( &m_data_[ m_size_ ] ),
+        sHeader{ .type = _type, .blocks = static_cast< uint32_t >( blocks ) } );
+
+    const auto command = reinterpret_cast< std::byte* >( header ) + kHeaderBlocks * kAlignment;
+
+    m_size_ += blocks;
+    m_count_++;
+
+    return command;
+} // push
+
+void cCommand_Buffer::Clear()
+{
+    m_size_  = 0;
+    m_count_ = 0;
+} // Clear
+
+void cCommand_Buffer::Reserve( const size_t _bytes )
+{
+    const auto capacity = blocks_for( _bytes );
+    if( capacity <= m_capacity_ )
+        return;
+
+    // The commands are plain data, so growing is a single copy.
+    auto data = std::make_unique_for_overwrite< sBlock[] >( capacity );
+    if( m_size_ > 0 )
+        std::memcpy( data.get(), m_data_.get(), m_size_ * sizeof( sBlock ) );
+
+    m_data_     = std::move( data );
+    m_capacity_ = capacity;
+} // Reserve
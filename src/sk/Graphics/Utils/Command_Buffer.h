@@ -0,0 +1,194 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include <sk/Math/Matrix4x4.h>
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+namespace sk::Assets
+{
+    class cMaterial;
+    class cMesh;
+} // sk::Assets::
+
+namespace sk::Graphics::Utils
+{
+    // Per instance data read by instanced shaders, matches an std430 array of two mat4.
+    struct sInstance_Data
+    {
+        cMatrix4x4f world;
+        cMatrix4x4f inverse_world;
+    };
+
+    enum class eCommand : uint8_t
+    {
+        kUseMaterial,
+        kBindMesh,
+        kDraw,
+        kDrawInstanced,
+    };
+
+    namespace Commands
+    {
+        // The draws up to the next material use this one.
+        struct sUse_Material
+        {
+            static constexpr auto kType = eCommand::kUseMaterial;
+
+            Assets::cMaterial* material;
+        };
+
+        struct sBind_Mesh
+        {
+            static constexpr auto kType = eCommand::kBindMesh;
+
+            Assets::cMesh* mesh;
+            uint32_t       lod;
+        };
+
+        // A single draw with its own object uniforms.
+        struct sDraw
+        {
+            static constexpr auto kType = eCommand::kDraw;
+
+            cMatrix4x4f world;
+            cMatrix4x4f inverse_world;
+        };
+
+        // Followed by count sInstance_Data in the buffer, see cCommand_Buffer::GetPayload.
+        struct sDraw_Instanced
+        {
+            static constexpr auto kType = eCommand::kDrawInstanced;
+
+            uint32_t count;
+        };
+    } // Commands::
+
+    // A linear arena of plain commands, recorded on any thread and replayed later on the render thread.
+    // Nothing is shared between buffers, so each recording thread has to have its own.
+    // Commands only refer to assets by pointer, anything which changes per draw is copied into the buffer.
+    class cCommand_Buffer
+    {
+    public:
+        // Every command starts at a multiple of this.
+        static constexpr size_t kAlignment = 16;
+
+        cCommand_Buffer() = default;
+        cCommand_Buffer( cCommand_Buffer&& ) noexcept = default;
+        cCommand_Buffer& operator=( cCommand_Buffer&& ) noexcept = default;
+
+        // The reference is only valid until the next push.
+        template< class Ty >
+        auto Push( const Ty& _command ) -> Ty&;
+
+        // Pushes the command followed by room for _count payload items, which are returned to be written in place.
+        // The span is only valid until the next push.
+        template< class Payload, class Ty >
+        auto Push( const Ty& _command, size_t _count ) -> std::span< Payload >;
+
+        template< class Payload, class Ty >
+        static auto GetPayload( const Ty& _command, size_t _count ) -> std::span< const Payload >;
+
+        /**
+         * Calls _visitor with every command in the order they were pushed.
+         * The visitor has to take every command type in Commands, a generic lambda works as an empty backend.
+         */
+        template< class Fn >
+        void Replay( Fn&& _visitor ) const;
+
+        // Keeps the memory, so recording the next frame doesn't have to allocate.
+        void Clear();
+        void Reserve( size_t _bytes );
+
+        [[ nodiscard ]] auto GetSize () const { return m_size_ * kAlignment; }
+        [[ nodiscard ]] auto GetCount() const { return m_count_; }
+        [[ nodiscard ]] bool IsEmpty () const { return m_count_ == 0; }
+
+    private:
+        struct alignas( kAlignment ) sBlock
+        {
+            std::byte data[ kAlignment ];
+        };
+
+        struct sHeader
+        {
+            eCommand type;
+            // Blocks the command takes up, header and payload included.
+            uint32_t blocks;
+        };
+
+        static constexpr auto blocks_for( const size_t _bytes ) -> size_t { return ( _bytes + kAlignment - 1 ) / kAlignment; }
+
+        // The header takes up the first block, the command starts at the next.
+        static constexpr size_t kHeaderBlocks = 1;
+        static_assert( sizeof( sHeader ) <= kAlignment );
+
+        // From the start of the command, payloads start at the next aligned byte after it.
+        template< class Ty >
+        static constexpr size_t kPayloadOffset = ( sizeof( Ty ) + kAlignment - 1 ) / kAlignment * kAlignment;
+
+        // Returns the command, which is followed by _payload_bytes.
+        auto push( eCommand _type, size_t _command_bytes, size_t _payload_bytes ) -> std::byte*;
+
+        std::unique_ptr< sBlock[] > m_data_;
+        size_t m_capacity_ = 0;
+        size_t m_size_     = 0;
+        size_t m_count_    = 0;
+    };
+
+    template< class Ty >
+    auto cCommand_Buffer::Push( const Ty& _command ) -> Ty&
+    {
+        static_assert( std::is_trivially_copyable_v< Ty > && alignof( Ty ) <= kAlignment, "Commands have to be plain data." );
+
+        return *std::construct_at( reinterpret_cast< Ty* >( push( Ty::kType, sizeof( Ty ), 0 ) ), _command );
+    } // Push
+
+    template< class Payload, class Ty >
+    auto cCommand_Buffer::Push( const Ty& _command, const size_t _count ) -> std::span< Payload >
+    {
+        static_assert( std::is_trivially_copyable_v< Ty > && alignof( Ty ) <= kAlignment, "Commands have to be plain data." );
+        static_assert( std::is_trivially_copyable_v< Payload > && alignof( Payload ) <= kAlignment, "Payloads have to be plain data." );
+
+        const auto data = push( Ty::kType, kPayloadOffset< Ty >, sizeof( Payload ) * _count );
+        std::construct_at( reinterpret_cast< Ty* >( data ), _command );
+
+        const auto payload = reinterpret_cast< Payload* >( data + kPayloadOffset< Ty > );
+        return { payload, _count };
+    } // Push
+
+    template< class Payload, class Ty >
+    auto cCommand_Buffer::GetPayload( const Ty& _command, const size_t _count ) -> std::span< const Payload >
+    {
+        const auto data = reinterpret_cast< const std::byte* >( &_command ) + kPayloadOffset< Ty >;
+        return { reinterpret_cast< const Payload* >( data ), _count };
+    } // GetPayload
+
+    template< class Fn >
+    void cCommand_Buffer::Replay( Fn&& _visitor ) const
+    {
+        for( size_t block = 0; block < m_size_; )
+        {
+            const auto& header  = *reinterpret_cast< const sHeader* >( &m_data_[ block ] );
+            const auto  command = &m_data_[ block + kHeaderBlocks ];
+
+            switch( header.type )
+            {
+            case eCommand::kUseMaterial:   _visitor( *reinterpret_cast< const Commands::sUse_Material*   >( command ) ); break;
+            case eCommand::kBindMesh:      _visitor( *reinterpret_cast< const Commands::sBind_Mesh*      >( command ) ); break;
+            case eCommand::kDraw:          _visitor( *reinterpret_cast< const Commands::sDraw*           >( command ) ); break;
+            case eCommand::kDrawInstanced: _visitor( *reinterpret_cast< const Commands::sDraw_Instanced* >( command ) ); break;
+            }
+
+            block += header.blocks;
+        }
+    } // Replay
+} // sk::Graphics::Utils
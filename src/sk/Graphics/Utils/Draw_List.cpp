@@ -0,0 +1,117 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Draw_List.h"
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+namespace sk::Graphics::Utils
+{
+    namespace
+    {
+        constexpr auto mask( const uint32_t _bits ){ return ( uint64_t{ 1 } << _bits ) - 1; }
+
+        constexpr uint32_t kDigitBits   = 8;
+        constexpr uint32_t kDigitCount  = 64 / kDigitBits;
+        constexpr uint32_t kBucketCount = 1u << kDigitBits;
+
+        constexpr auto digit( const uint64_t _key, const uint32_t _digit ){ return static_cast< uint32_t >( ( _key >> ( _digit * kDigitBits ) ) & ( kBucketCount - 1 ) ); }
+    } // ::
+
+    auto cDraw_List::MakeKey( const uint32_t _pass, const uint32_t _program, const uint32_t _material, const uint32_t _mesh, const uint32_t _lod, const float _depth ) -> uint64_t
+    {
+        const auto depth = static_cast< uint64_t >( std::clamp( _depth, 0.0f, 1.0f ) * static_cast< float >( mask( kDepthBits ) ) );
+
+        uint64_t key = _pass & mask( kPassBits );
+        key = ( key << kProgramBits  ) | ( _program  & mask( kProgramBits ) );
+        key = ( key << kMaterialBits ) | ( _material & mask( kMaterialBits ) );
+        key = ( key << kMeshBits     ) | ( _mesh     & mask( kMeshBits ) );
+        key = ( key << kLodBits      ) | ( _lod      & mask( kLodBits ) );
+        key = ( key << kDepthBits    ) | depth;
+
+        return key;
+    } // MakeKey
+
+    auto cDraw_List::GetProgramId( const uint32_t _program ) -> uint32_t
+    {
+        return get_id( m_program_ids_, _program );
+    } // GetProgramId
+
+    auto cDraw_List::GetMaterialId( const Assets::cMaterial* _material ) -> uint32_t
+    {
+        return get_id( m_material_ids_, reinterpret_cast< uintptr_t >( _material ) );
+    } // GetMaterialId
+
+    auto cDraw_List::GetMeshId( const Assets::cMesh* _mesh ) -> uint32_t
+    {
+        return get_id( m_mesh_ids_, reinterpret_cast< uintptr_t >( _mesh ) );
+    } // GetMeshId
+
+    void cDraw_List::Add( const uint64_t _key, const sDraw& _draw )
+    {
+        m_entries_.emplace_back( sEntry{ _key, static_cast< uint32_t >( m_draws_.size() ) } );
+        m_draws_  .emplace_back( _draw );
+    } // Add
+
+    void cDraw_List::Sort()
+    {
+        const auto count = m_entries_.size();
+        if( count < 2 )
+            return;
+
+        // All histograms are built in a single read of the keys.
+        std::array< std::array< uint32_t, kBucketCount >, kDigitCount > histograms{};
+        for( const auto& entry : m_entries_ )
+        {
+            for( uint32_t i = 0; i < kDigitCount; i++ )
+                histograms[ i ][ digit( entry.key, i ) ]++;
+        }
+
+        m_scratch_.resize( count );
+
+        for( uint32_t i = 0; i < kDigitCount; i++ )
+        {
+            auto& histogram = histograms[ i ];
+
+            // Every key shares this digit, which is the case for most of the high ones, so the pass wouldn't move anything.
+            if( histogram[ digit( m_entries_.front().key, i ) ] == count )
+                continue;
+
+            uint32_t offset = 0;
+            for( auto& bucket : histogram )
+                offset += std::exchange( bucket, offset );
+
+            for( const auto& entry : m_entries_ )
+                m_scratch_[ histogram[ digit( entry.key, i ) ]++ ] = entry;
+
+            m_entries_.swap( m_scratch_ );
+        }
+    } // Sort
+
+    void cDraw_List::Clear()
+    {
+        m_draws_  .clear();
+        m_entries_.clear();
+
+        m_program_ids_ .clear();
+        m_material_ids_.clear();
+        m_mesh_ids_    .clear();
+    } // Clear
+
+    void cDraw_List::Reserve( const size_t _count )
+    {
+        m_draws_  .reserve( _count );
+        m_entries_.reserve( _count );
+        m_scratch_.reserve( _count );
+    } // Reserve
+
+    auto cDraw_List::get_id( std::unordered_map< uintptr_t, uint32_t >& _ids, const uintptr_t _resource ) -> uint32_t
+    {
+        return _ids.try_emplace( _resource, static_cast< uint32_t >( _ids.size() ) ).first->second;
+    } // get_id
+} // sk::Graphics::Utils
@@ -0,0 +1,102 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace sk
+{
+    class cTransform;
+} // sk::
+
+namespace sk::Assets
+{
+    class cMaterial;
+    class cMesh;
+} // sk::Assets::
+
+namespace sk::Graphics::Utils
+{
+    // State changes made while submitting a draw list.
+    struct sDraw_Stats
+    {
+        size_t draws            = 0;
+        size_t instances        = 0;
+        size_t program_changes  = 0;
+        size_t material_changes = 0;
+        size_t mesh_changes     = 0;
+        size_t index_changes    = 0;
+    };
+
+    // Draws recorded together with a 64 bit sort key, and sorted so draws sharing state end up next to each other.
+    // The list doesn't touch the graphics api, it's recorded through Utils::RecordDrawList.
+    class cDraw_List
+    {
+    public:
+        // From the most significant bits: pass, shader program, material, mesh, lod and depth.
+        static constexpr uint32_t kPassBits     = 4;
+        static constexpr uint32_t kProgramBits  = 12;
+        static constexpr uint32_t kMaterialBits = 16;
+        static constexpr uint32_t kMeshBits     = 16;
+        static constexpr uint32_t kLodBits      = 4;
+        static constexpr uint32_t kDepthBits    = 12;
+
+        static_assert( kPassBits + kProgramBits + kMaterialBits + kMeshBits + kLodBits + kDepthBits == 64, "The key has to fill 64 bits." );
+
+        struct sDraw
+        {
+            Assets::cMaterial* material;
+            Assets::cMesh*     mesh;
+            const cTransform*  transform;
+            size_t             lod;
+        };
+
+        struct sEntry
+        {
+            uint64_t key;
+            uint32_t draw;
+        };
+
+        /**
+         * Packs a sort key, fields wider than their bits are wrapped which only costs some grouping.
+         * @param _depth Normalized depth, draws closer to 0 come first.
+         */
+        [[ nodiscard ]] static auto MakeKey( uint32_t _pass, uint32_t _program, uint32_t _material, uint32_t _mesh, uint32_t _lod, float _depth ) -> uint64_t;
+
+        // Small ids for the key, handed out in the order the resources are first seen since the last Clear.
+        [[ nodiscard ]] auto GetProgramId ( uint32_t _program ) -> uint32_t;
+        [[ nodiscard ]] auto GetMaterialId( const Assets::cMaterial* _material ) -> uint32_t;
+        [[ nodiscard ]] auto GetMeshId    ( const Assets::cMesh* _mesh ) -> uint32_t;
+
+        void Add( uint64_t _key, const sDraw& _draw );
+
+        // Radix sorts the entries by key. Draws with equal keys keep the order they were added in.
+        void Sort();
+        void Clear();
+        void Reserve( size_t _count );
+
+        [[ nodiscard ]] auto GetSize() const { return m_entries_.size(); }
+        // In sorted order once Sort has been called.
+        [[ nodiscard ]] auto GetEntries() const { return std::span( m_entries_ ); }
+        [[ nodiscard ]] auto& GetDraw( const uint32_t _draw ) const { return m_draws_[ _draw ]; }
+
+    private:
+        static auto get_id( std::unordered_map< uintptr_t, uint32_t >& _ids, uintptr_t _resource ) -> uint32_t;
+
+        std::vector< sDraw >  m_draws_;
+        std::vector< sEntry > m_entries_;
+        // Kept between frames to avoid reallocating.
+        std::vector< sEntry > m_scratch_;
+
+        std::unordered_map< uintptr_t, uint32_t > m_program_ids_;
+        std::unordered_map< uintptr_t, uint32_t > m_material_ids_;
+        std::unordered_map< uintptr_t, uint32_t > m_mesh_ids_;
+    };
+} // sk::Graphics::Utils
@@ -0,0 +1,121 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Frustum_Culling.h"
+
+#include <sk/Math/Simd.h>
+
+#include <bit>
+#include <limits>
+
+namespace sk::Graphics::Utils
+{
+    void sPacked_Bounds::Add( const cAABBf& _bounds )
+    {
+        // Empty boxes belong to something without any bounds, so they're made infinite to never be culled.
+        constexpr auto kInfinity = std::numeric_limits< float >::infinity();
+
+        const auto center  = _bounds.IsValid() ? _bounds.GetCenter()  : cVector3f( 0.0f );
+        const auto extents = _bounds.IsValid() ? _bounds.GetExtents() : cVector3f( kInfinity );
+
+        center_x.emplace_back( center.x );
+        center_y.emplace_back( center.y );
+        center_z.emplace_back( center.z );
+        extent_x.emplace_back( extents.x );
+        extent_y.emplace_back( extents.y );
+        extent_z.emplace_back( extents.z );
+    } // Add
+
+    void sPacked_Bounds::Clear()
+    {
+        center_x.clear(); center_y.clear(); center_z.clear();
+        extent_x.clear(); extent_y.clear(); extent_z.clear();
+    } // Clear
+
+    void sPacked_Bounds::Reserve( const size_t _count )
+    {
+        center_x.reserve( _count ); center_y.reserve( _count ); center_z.reserve( _count );
+        extent_x.reserve( _count ); extent_y.reserve( _count ); extent_z.reserve( _count );
+    } // Reserve
+
+    auto CullBounds( const sPacked_Bounds& _bounds, const cFrustumf& _frustum, std::vector< uint32_t >& _out_visible ) -> size_t
+    {
+        using namespace Math::Simd;
+
+        struct sPlane
+        {
+            sFloat4 x, y, z, w;
+            sFloat4 abs_x, abs_y, abs_z;
+        };
+
+        sPlane planes[ cFrustumf::kCount ];
+        for( size_t i = 0; i < cFrustumf::kCount; i++ )
+        {
+            const auto& plane = _frustum.GetPlanes()[ i ];
+            planes[ i ] = {
+                Splat( plane.x ), Splat( plane.y ), Splat( plane.z ), Splat( plane.w ),
+                Splat( Math::abs( plane.x ) ), Splat( Math::abs( plane.y ) ), Splat( Math::abs( plane.z ) ),
+            };
+        }
+
+        const auto zero  = Zero();
+        const auto size  = _bounds.GetSize();
+        const auto first = _out_visible.size();
+
+        // A box is outside if it's fully behind any of the planes, same as cFrustum::Intersects.
+        const auto cull = [ & ]( const float* _cx, const float* _cy, const float* _cz, const float* _ex, const float* _ey, const float* _ez ) -> uint32_t
+        {
+            const auto cx = Load( _cx ), cy = Load( _cy ), cz = Load( _cz );
+            const auto ex = Load( _ex ), ey = Load( _ey ), ez = Load( _ez );
+
+            uint32_t outside = 0;
+            for( auto& plane : planes )
+            {
+                const auto distance = MulAdd( plane.x, cx, MulAdd( plane.y, cy, MulAdd( plane.z, cz, plane.w ) ) );
+                const auto radius   = MulAdd( plane.abs_x, ex, MulAdd( plane.abs_y, ey, plane.abs_z * ez ) );
+                outside |= LessMask( distance + radius, zero );
+            }
+
+            return ~outside & 0xF;
+        };
+
+        const auto append = [ & ]( const size_t _first, uint32_t _visible )
+        {
+            while( _visible != 0 )
+            {
+                _out_visible.emplace_back( static_cast< uint32_t >( _first + std::countr_zero( _visible ) ) );
+                _visible &= _visible - 1;
+            }
+        };
+
+        size_t i = 0;
+        for( ; i + 4 <= size; i += 4 )
+        {
+            append( i, cull( &_bounds.center_x[ i ], &_bounds.center_y[ i ], &_bounds.center_z[ i ],
+                &_bounds.extent_x[ i ], &_bounds.extent_y[ i ], &_bounds.extent_z[ i ] ) );
+        }
+
+        // The remaining boxes are copied into a full group, and the unused lanes are masked out.
+        if( i < size )
+        {
+            float tail[ 6 ][ 4 ] = {};
+            for( size_t lane = 0; lane < size - i; lane++ )
+            {
+                tail[ 0 ][ lane ] = _bounds.center_x[ i + lane ];
+                tail[ 1 ][ lane ] = _bounds.center_y[ i + lane ];
+                tail[ 2 ][ lane ] = _bounds.center_z[ i + lane ];
+                tail[ 3 ][ lane ] = _bounds.extent_x[ i + lane ];
+                tail[ 4 ][ lane ] = _bounds.extent_y[ i + lane ];
+                tail[ 5 ][ lane ] = _bounds.extent_z[ i + lane ];
+            }
+
+            const auto used = ( 1u << ( size - i ) ) - 1;
+            append( i, cull( tail[ 0 ], tail[ 1 ], tail[ 2 ], tail[ 3 ], tail[ 4 ], tail[ 5 ] ) & used );
+        }
+
+        return _out_visible.size() - first;
+    } // CullBounds
+} // sk::Graphics::Utils
@@ -0,0 +1,38 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include <sk/Math/AABB.h>
+#include <sk/Math/Frustum.h>
+
+#include <vector>
+
+namespace sk::Graphics::Utils
+{
+    // World space boxes stored as separate center and extent arrays, so four of them can be tested at a time.
+    struct sPacked_Bounds
+    {
+        std::vector< float > center_x, center_y, center_z;
+        std::vector< float > extent_x, extent_y, extent_z;
+
+        void Add( const cAABBf& _bounds );
+        void Clear();
+        void Reserve( size_t _count );
+
+        [[ nodiscard ]] auto GetSize() const { return center_x.size(); }
+    };
+
+    /**
+     * Culls packed boxes against a frustum, four at a time.
+     *
+     * @param _bounds      The boxes to cull, in the same space as the frustum.
+     * @param _frustum     The frustum to test against.
+     * @param _out_visible Gets the index of every box intersecting the frustum appended to it, in order.
+     * @return The amount of boxes that survived.
+     */
+    auto CullBounds( const sPacked_Bounds& _bounds, const cFrustumf& _frustum, std::vector< uint32_t >& _out_visible ) -> size_t;
+} // sk::Graphics::Utils
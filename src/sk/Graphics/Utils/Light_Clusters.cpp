@@ -0,0 +1,308 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Light_Clusters.h"
+
+#include <sk/Assets/Management/Asset_Job_Manager.h>
+#include <sk/Math/Simd.h>
+#include <sk/Misc/Future.h>
+#include <sk/Misc/Task.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <functional>
+
+namespace sk::Graphics::Utils
+{
+    namespace
+    {
+        // Below this many lights handing the slices out to the workers costs more than assigning them in place.
+        constexpr size_t kMinLightsForWorkers = 256;
+
+        auto assign_on_worker( const std::function< void() > _assign ) -> cTask<>
+        {
+            co_await Assets::Jobs::cAsset_Job_Manager::ResumeOnWorker();
+
+            _assign();
+        }
+    } // ::
+
+    void sPacked_Lights::AddPoint( const cVector3f& _position, const float _radius )
+    {
+        x.emplace_back( _position.x );
+        y.emplace_back( _position.y );
+        z.emplace_back( _position.z );
+        radius.emplace_back( _radius );
+
+        dir_x.emplace_back( 0.0f );
+        dir_y.emplace_back( 0.0f );
+        dir_z.emplace_back( 0.0f );
+        cone_cos.emplace_back( -1.0f );
+        cone_sin.emplace_back( 0.0f );
+    } // AddPoint
+
+    void sPacked_Lights::AddSpot( const cVector3f& _position, const cVector3f& _direction, const float _radius, const float _angle )
+    {
+        x.emplace_back( _position.x );
+        y.emplace_back( _position.y );
+        z.emplace_back( _position.z );
+        radius.emplace_back( _radius );
+
+        dir_x.emplace_back( _direction.x );
+        dir_y.emplace_back( _direction.y );
+        dir_z.emplace_back( _direction.z );
+        cone_cos.emplace_back( Math::cos( _angle ) );
+        cone_sin.emplace_back( Math::sin( _angle ) );
+    } // AddSpot
+
+    void sPacked_Lights::Clear()
+    {
+        x.clear(); y.clear(); z.clear(); radius.clear();
+        dir_x.clear(); dir_y.clear(); dir_z.clear(); cone_cos.clear(); cone_sin.clear();
+    } // Clear
+
+    void sPacked_Lights::Reserve( const size_t _count )
+    {
+        x.reserve( _count ); y.reserve( _count ); z.reserve( _count ); radius.reserve( _count );
+        dir_x.reserve( _count ); dir_y.reserve( _count ); dir_z.reserve( _count ); cone_cos.reserve( _count ); cone_sin.reserve( _count );
+    } // Reserve
+
+    void cLight_Clusters::Build( const sCluster_Grid& _grid, const float _fov, const float _aspect, const float _near, const float _far )
+    {
+        m_grid_        = _grid;
+        m_near_        = _near;
+        m_far_         = _far;
+        m_tan_y_       = Math::tan( Math::degToRad( _fov / 2.0f ) );
+        m_tan_x_       = m_tan_y_ * _aspect;
+        m_slice_scale_ = static_cast< float >( _grid.z ) / std::log( _far / _near );
+
+        m_depths_.resize( _grid.z + 1 );
+        for( uint32_t z = 0; z <= _grid.z; z++ )
+            m_depths_[ z ] = _near * Math::pow( _far / _near, static_cast< float >( z ) / _grid.z );
+
+        m_bounds_.Clear();
+        m_bounds_.Reserve( _grid.GetCount() + 3 );
+
+        for( uint32_t z = 0; z < _grid.z; z++ )
+        {
+            const auto z_near = m_depths_[ z ];
+            const auto z_far  = m_depths_[ z + 1 ];
+
+            for( uint32_t y = 0; y < _grid.y; y++ )
+            {
+                const auto bottom = -1.0f + 2.0f * static_cast< float >( y )     / _grid.y;
+                const auto top    = -1.0f + 2.0f * static_cast< float >( y + 1 ) / _grid.y;
+
+                for( uint32_t x = 0; x < _grid.x; x++ )
+                {
+                    const auto left  = -1.0f + 2.0f * static_cast< float >( x )     / _grid.x;
+                    const auto right = -1.0f + 2.0f * static_cast< float >( x + 1 ) / _grid.x;
+
+                    // The sides of a froxel lean outwards, so the box has to cover both its near and far face.
+                    const auto min = cVector3f{
+                        std::min( left * z_near, left * z_far ) * m_tan_x_,
+                        std::min( bottom * z_near, bottom * z_far ) * m_tan_y_,
+                        z_near
+                    };
+                    const auto max = cVector3f{
+                        std::max( right * z_near, right * z_far ) * m_tan_x_,
+                        std::max( top * z_near, top * z_far ) * m_tan_y_,
+                        z_far
+                    };
+
+                    m_bounds_.center_x.emplace_back( ( min.x + max.x ) * 0.5f );
+                    m_bounds_.center_y.emplace_back( ( min.y + max.y ) * 0.5f );
+                    m_bounds_.center_z.emplace_back( ( min.z + max.z ) * 0.5f );
+                    m_bounds_.extent_x.emplace_back( ( max.x - min.x ) * 0.5f );
+                    m_bounds_.extent_y.emplace_back( ( max.y - min.y ) * 0.5f );
+                    m_bounds_.extent_z.emplace_back( ( max.z - min.z ) * 0.5f );
+                }
+            }
+        }
+
+        // The last group of a row can read up to three clusters past the end, those lanes are masked out.
+        for( size_t i = 0; i < 3; i++ )
+            m_bounds_.Add( cAABBf{} );
+
+        m_lists_.resize( _grid.GetCount() );
+        m_clusters_.assign( _grid.GetCount(), sCluster{ 0, 0 } );
+        m_indices_.clear();
+    } // Build
+
+    void cLight_Clusters::Assign( const sPacked_Lights& _lights )
+    {
+        for( auto& list : m_lists_ )
+            list.clear();
+
+        find_ranges( _lights );
+
+        const auto worker_count = std::min< size_t >( Assets::Jobs::cAsset_Job_Manager::get().GetWorkerCount(), m_grid_.z );
+        if( _lights.GetSize() < kMinLightsForWorkers || worker_count <= 1 )
+        {
+            assign_slices( _lights, 0, 1 );
+            compact();
+            return;
+        }
+
+        // Slices are interleaved, as the ones close to the camera tend to hold more lights.
+        std::vector< cFuture< void > > workers;
+        workers.reserve( worker_count - 1 );
+
+        const auto step = static_cast< uint32_t >( worker_count );
+        for( uint32_t first = 1; first < step; first++ )
+            workers.emplace_back( assign_on_worker( [ this, &_lights, first, step ]{ assign_slices( _lights, first, step ); } ).Start() );
+
+        // Only the workers run queued jobs, so the calling thread takes a share itself instead of idling.
+        assign_slices( _lights, 0, step );
+
+        for( const auto& worker : workers )
+            worker.Wait();
+
+        compact();
+    } // Assign
+
+    auto cLight_Clusters::GetSlice( const float _view_z ) const -> uint32_t
+    {
+        if( _view_z <= m_near_ )
+            return 0;
+
+        const auto slice = static_cast< int64_t >( std::log( _view_z / m_near_ ) * m_slice_scale_ );
+        return static_cast< uint32_t >( std::clamp< int64_t >( slice, 0, m_grid_.z - 1 ) );
+    } // GetSlice
+
+    auto cLight_Clusters::GetLights( const size_t _cluster ) const -> std::span< const uint32_t >
+    {
+        const auto& cluster = m_clusters_[ _cluster ];
+        return std::span( m_indices_ ).subspan( cluster.offset, cluster.count );
+    } // GetLights
+
+    void cLight_Clusters::find_ranges( const sPacked_Lights& _lights )
+    {
+        m_ranges_.resize( _lights.GetSize() );
+
+        for( size_t i = 0; i < _lights.GetSize(); i++ )
+        {
+            auto& range = m_ranges_[ i ];
+
+            const auto z_near = std::max( _lights.z[ i ] - _lights.radius[ i ], m_near_ );
+            const auto z_far  = std::min( _lights.z[ i ] + _lights.radius[ i ], m_far_ );
+
+            range.visible = z_near <= z_far;
+            range.z0      = GetSlice( z_near );
+            range.z1      = GetSlice( z_far );
+        }
+    } // find_ranges
+
+    bool cLight_Clusters::find_tiles( const float _min, const float _max, const uint32_t _slice, const float _tan, const uint32_t _tiles,
+        uint32_t& _first, uint32_t& _last ) const
+    {
+        // The boxes lean outwards, so their outer side is at the far end of the slice and their inner side at the near end.
+        const auto z_near  = m_depths_[ _slice ];
+        const auto z_far   = m_depths_[ _slice + 1 ];
+        const auto ndc_min = _min / ( _tan * ( _min >= 0.0f ? z_far : z_near ) );
+        const auto ndc_max = _max / ( _tan * ( _max <= 0.0f ? z_far : z_near ) );
+        if( ndc_max < -1.0f || ndc_min > 1.0f )
+            return false;
+
+        const auto to_tile = [ & ]( const float _ndc )
+        {
+            const auto tile = static_cast< int64_t >( std::floor( ( _ndc + 1.0f ) * 0.5f * static_cast< float >( _tiles ) ) );
+            return static_cast< uint32_t >( std::clamp< int64_t >( tile, 0, _tiles - 1 ) );
+        };
+
+        _first = to_tile( ndc_min );
+        _last  = to_tile( ndc_max );
+        return true;
+    } // find_tiles
+
+    void cLight_Clusters::assign_slices( const sPacked_Lights& _lights, const uint32_t _first, const uint32_t _step )
+    {
+        using namespace Math::Simd;
+
+        const auto zero = Zero();
+
+        for( uint32_t light = 0; light < _lights.GetSize(); light++ )
+        {
+            const auto& range = m_ranges_[ light ];
+            if( !range.visible )
+                continue;
+
+            const auto light_x = _lights.x[ light ];
+            const auto light_y = _lights.y[ light ];
+            const auto light_r = _lights.radius[ light ];
+
+            const auto lx = Splat( _lights.x[ light ] ), ly = Splat( _lights.y[ light ] ), lz = Splat( _lights.z[ light ] );
+            const auto radius    = Splat( _lights.radius[ light ] );
+            const auto radius_sq = radius * radius;
+
+            const bool is_cone = _lights.cone_cos[ light ] > -1.0f;
+            const auto dx = Splat( _lights.dir_x[ light ] ), dy = Splat( _lights.dir_y[ light ] ), dz = Splat( _lights.dir_z[ light ] );
+            const auto cone_cos = Splat( _lights.cone_cos[ light ] );
+            const auto cone_sin = Splat( _lights.cone_sin[ light ] );
+
+            // The first slice of this light that belongs to this call.
+            auto z = range.z0 + ( _first + _step - range.z0 % _step ) % _step;
+            for( ; z <= range.z1; z += _step )
+            {
+                uint32_t x0, x1, y0, y1;
+                if( !find_tiles( light_x - light_r, light_x + light_r, z, m_tan_x_, m_grid_.x, x0, x1 ) ||
+                    !find_tiles( light_y - light_r, light_y + light_r, z, m_tan_y_, m_grid_.y, y0, y1 ) )
+                    continue;
+
+                for( uint32_t y = y0; y <= y1; y++ )
+                {
+                    for( uint32_t x = x0; x <= x1; x += 4 )
+                    {
+                        const auto first = GetIndex( x, y, z );
+
+                        const auto cx = Load( &m_bounds_.center_x[ first ] ), cy = Load( &m_bounds_.center_y[ first ] ), cz = Load( &m_bounds_.center_z[ first ] );
+                        const auto ex = Load( &m_bounds_.extent_x[ first ] ), ey = Load( &m_bounds_.extent_y[ first ] ), ez = Load( &m_bounds_.extent_z[ first ] );
+
+                        // Distance from the light to the closest point of each box.
+                        const auto ox = Max( Max( cx - lx, lx - cx ) - ex, zero );
+                        const auto oy = Max( Max( cy - ly, ly - cy ) - ey, zero );
+                        const auto oz = Max( Max( cz - lz, lz - cz ) - ez, zero );
+                        const auto distance_sq = MulAdd( ox, ox, MulAdd( oy, oy, oz * oz ) );
+
+                        const auto lanes = std::min< uint32_t >( 4, x1 - x + 1 );
+                        auto hits = ~LessMask( radius_sq, distance_sq ) & ( ( 1u << lanes ) - 1 );
+
+                        // Spot lights also cull boxes whose bounding spheres are fully outside the cone.
+                        if( is_cone && hits != 0 )
+                        {
+                            const auto bounds_radius = Sqrt( MulAdd( ex, ex, MulAdd( ey, ey, ez * ez ) ) );
+                            const auto vx = cx - lx, vy = cy - ly, vz = cz - lz;
+                            const auto length_sq = MulAdd( vx, vx, MulAdd( vy, vy, vz * vz ) );
+                            const auto along     = MulAdd( vx, dx, MulAdd( vy, dy, vz * dz ) );
+                            const auto closest   = cone_cos * Sqrt( Max( length_sq - along * along, zero ) ) - along * cone_sin;
+
+                            const auto outside = LessMask( bounds_radius, closest )
+                                | LessMask( bounds_radius + radius, along )
+                                | LessMask( along, zero - bounds_radius );
+                            hits &= ~outside;
+                        }
+
+                        for( ; hits != 0; hits &= hits - 1 )
+                            m_lists_[ first + std::countr_zero( hits ) ].emplace_back( light );
+                    }
+                }
+            }
+        }
+    } // assign_slices
+
+    void cLight_Clusters::compact()
+    {
+        m_indices_.clear();
+
+        for( size_t i = 0; i < m_lists_.size(); i++ )
+        {
+            const auto& list = m_lists_[ i ];
+            m_clusters_[ i ] = sCluster{ .offset = static_cast< uint32_t >( m_indices_.size() ), .count = static_cast< uint32_t >( list.size() ) };
+            m_indices_.insert( m_indices_.end(), list.begin(), list.end() );
+        }
+    } // compact
+} // sk::Graphics::Utils
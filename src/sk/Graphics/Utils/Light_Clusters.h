@@ -0,0 +1,111 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include <sk/Graphics/Utils/Frustum_Culling.h>
+#include <sk/Math/Vector3.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace sk::Graphics::Utils
+{
+    // View space spheres, with a cone for spot lights, stored as separate arrays like sPacked_Bounds.
+    struct sPacked_Lights
+    {
+        std::vector< float > x, y, z, radius;
+        // Point lights have a cosine of -1, and are only tested as spheres.
+        std::vector< float > dir_x, dir_y, dir_z, cone_cos, cone_sin;
+
+        void AddPoint( const cVector3f& _position, float _radius );
+        // _angle is the angle between the direction and the edge of the cone, in radians.
+        void AddSpot ( const cVector3f& _position, const cVector3f& _direction, float _radius, float _angle );
+        void Clear();
+        void Reserve( size_t _count );
+
+        [[ nodiscard ]] auto GetSize() const { return x.size(); }
+    };
+
+    struct sCluster_Grid
+    {
+        uint32_t x = 16;
+        uint32_t y = 9;
+        uint32_t z = 24;
+
+        [[ nodiscard ]] auto GetCount() const { return static_cast< size_t >( x ) * y * z; }
+
+        bool operator==( const sCluster_Grid& ) const = default;
+    };
+
+    // Where the lights of a cluster start in the index list, matches an std430 uvec2.
+    struct sCluster
+    {
+        uint32_t offset;
+        uint32_t count;
+    };
+
+    /**
+     * Splits the view frustum into froxels and lists the lights touching each of them.
+     * Tiles are counted from the bottom left of the screen like gl_FragCoord, and slice k starts at near * ( far / near )^( k / z ).
+     * The index of a cluster is ( z * grid.y + y ) * grid.x + x, and lights are listed in the order they were packed.
+     */
+    class cLight_Clusters
+    {
+    public:
+        // Has to be called again whenever the projection or the grid changes. _fov is vertical and in degrees, like the camera.
+        void Build( const sCluster_Grid& _grid, float _fov, float _aspect, float _near, float _far );
+
+        // Spreads the slices over the asset workers when there are enough lights to be worth it.
+        void Assign( const sPacked_Lights& _lights );
+
+        [[ nodiscard ]] auto GetSlice( float _view_z ) const -> uint32_t;
+        [[ nodiscard ]] auto GetIndex( const uint32_t _x, const uint32_t _y, const uint32_t _z ) const
+        {
+            return ( static_cast< size_t >( _z ) * m_grid_.y + _y ) * m_grid_.x + _x;
+        }
+
+        [[ nodiscard ]] auto& GetGrid    () const { return m_grid_; }
+        [[ nodiscard ]] auto& GetBounds  () const { return m_bounds_; }
+        [[ nodiscard ]] auto& GetClusters() const { return m_clusters_; }
+        [[ nodiscard ]] auto& GetIndices () const { return m_indices_; }
+        [[ nodiscard ]] auto  GetLights  ( size_t _cluster ) const -> std::span< const uint32_t >;
+
+    private:
+        // The slices a light's bounds can touch, inclusive.
+        struct sRange
+        {
+            uint32_t z0, z1;
+            bool     visible;
+        };
+
+        void find_ranges( const sPacked_Lights& _lights );
+        // The tiles along one axis whose boxes in _slice overlap the span from _min to _max, inclusive.
+        bool find_tiles( float _min, float _max, uint32_t _slice, float _tan, uint32_t _tiles, uint32_t& _first, uint32_t& _last ) const;
+        // Assigns every light to the slices starting at _first, stepping by _step. Only touches the lists of those slices.
+        void assign_slices( const sPacked_Lights& _lights, uint32_t _first, uint32_t _step );
+        void compact();
+
+        sCluster_Grid m_grid_;
+        float m_near_      = 0.1f;
+        float m_far_       = 1.0f;
+        float m_tan_x_     = 1.0f;
+        float m_tan_y_     = 1.0f;
+        // Slices per unit of log( depth / near ).
+        float m_slice_scale_ = 0.0f;
+
+        // Where each slice starts, with the far plane last.
+        std::vector< float > m_depths_;
+        // One box per cluster in view space, followed by padding so rows can be read four at a time.
+        sPacked_Bounds m_bounds_;
+
+        std::vector< sRange >                  m_ranges_;
+        std::vector< std::vector< uint32_t > > m_lists_;
+        std::vector< sCluster >                m_clusters_;
+        std::vector< uint32_t >                m_indices_;
+    };
+} // sk::Graphics::Utils
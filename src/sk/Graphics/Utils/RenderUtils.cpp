@@ -10,9 +10,14 @@
 #include <sk/Assets/Mesh.h>
 #include <sk/Graphics/Renderer.h>
 #include <sk/Graphics/Rendering/Frame_Buffer.h>
+#include <sk/Graphics/Utils/Draw_List.h>
 #include <sk/Graphics/Utils/Shader_Reflection.h>
+#include <sk/Math/Transform.h>
 #include <sk/Scene/Components/CameraComponent.h>
 
+#include <algorithm>
+#include <utility>
+
 using namespace sk::Graphics;
 
 namespace
@@ -22,8 +27,9 @@ namespace
     using namespace sk;
     
     // Blocks
-    constexpr cStringID kObjectBlock = "_Object";
-    constexpr cStringID kCameraBlock = "_Camera";
+    constexpr cStringID kObjectBlock     = "_Object";
+    constexpr cStringID kCameraBlock     = "_Camera";
+    constexpr cStringID kInstancingBlock = "_Instancing";
     
     // Object Uniforms
     constexpr cStringID kWorldUniform        = "world";
@@ -31,6 +37,14 @@ namespace
     
     // Camera Uniforms
     constexpr cStringID kViewProjUniform = "view_proj";
+    
+    // Instancing Uniforms
+    constexpr cStringID kFirstInstanceUniform = "first_instance";
+    
+    bool has_instancing_block( const Assets::cMaterial* _material )
+    {
+        return _material->GetBlocks().contains( kInstancingBlock );
+    }
 } // ::
 
 void Utils::InitUtils()
@@ -44,7 +58,7 @@ void Utils::ShutdownUtils()
 }
 
 bool Utils::RenderMesh( const Object::Components::cCameraComponent& _camera, Rendering::cFrame_Buffer& _frame_buffer,
-    Assets::cMaterial& _material, const cMatrix4x4f& _world_matrix, Assets::cMesh& _mesh )
+    Assets::cMaterial& _material, const cTransform& _transform, Assets::cMesh& _mesh )
 {
     const auto& link = const_cast< cShader_Link& >( _material.GetShaderLink() );
     SK_ERR_IFN( link.IsReady(),
@@ -62,16 +76,17 @@ bool Utils::RenderMesh( const Object::Components::cCameraComponent& _camera, Ren
     _mesh.GetMeta()->LockAsset();
     _material.GetMeta()->LockAsset();
     
+    object_block->SetPerDraw( true );
+    
     // Object uniforms
-    object_block->SetUniform( kWorldUniform,        _world_matrix );
-    object_block->SetUniform( kInverseWorldUniform, _world_matrix.inversed() );
+    object_block->SetUniform( kWorldUniform,        _transform.GetWorld() );
+    object_block->SetUniform( kInverseWorldUniform, _transform.GetInverseWorld() );
     
     // Camera uniforms
     camera_block->SetUniform( kViewProjUniform, _camera.getViewProjInv() );
     
-    _material.Update();
-    
     _frame_buffer.UseMaterial( _material );
+    _frame_buffer.UploadBlocks( _material );
     
     auto& attributes     = link.GetReflection()->GetAttributes();
     auto& vertex_buffers = _mesh.GetVertexBuffers();
@@ -84,7 +99,7 @@ bool Utils::RenderMesh( const Object::Components::cCameraComponent& _camera, Ren
             _frame_buffer.BindVertexBuffer( attribute.index, nullptr );
     }
     
-    _frame_buffer.BindIndexBuffer( *_mesh.GetIndexBuffer() );
+    _frame_buffer.BindIndexBuffer( *_mesh.GetIndexBuffer( _mesh.SelectLod( _camera, _transform.GetWorld() ) ) );
 
     const bool res = _frame_buffer.DrawIndexed();
     if( !res )
@@ -99,3 +114,290 @@ bool Utils::RenderMesh( const Object::Components::cCameraComponent& _camera, Ren
     
     return res;
 }
+
+void Utils::RecordDrawList( const cDraw_List& _list, const size_t _begin, const size_t _end, cCommand_Buffer& _commands )
+{
+    RecordDrawList( _list, _begin, _end, _commands, &has_instancing_block );
+}
+
+void Utils::RecordDrawList( const cDraw_List& _list, const size_t _begin, const size_t _end, cCommand_Buffer& _commands,
+    const is_instanced_t _is_instanced )
+{
+    const auto entries = _list.GetEntries();
+    
+    const Assets::cMaterial* material     = nullptr;
+    const Assets::cMesh*     mesh         = nullptr;
+    size_t                   lod          = 0;
+    bool                     is_instanced = false;
+    
+    for( size_t i = _begin; i < _end; )
+    {
+        const auto& draw = _list.GetDraw( entries[ i ].draw );
+        
+        if( draw.material != material )
+        {
+            material     = draw.material;
+            is_instanced = _is_instanced( material );
+            mesh         = nullptr;
+            
+            _commands.Push( Commands::sUse_Material{ .material = draw.material } );
+        }
+        
+        if( draw.mesh != mesh || draw.lod != lod )
+        {
+            mesh = draw.mesh;
+            lod  = draw.lod;
+            
+            _commands.Push( Commands::sBind_Mesh{ .mesh = draw.mesh, .lod = static_cast< uint32_t >( draw.lod ) } );
+        }
+        
+        if( !is_instanced )
+        {
+            _commands.Push( Commands::sDraw{ .world = draw.transform->GetWorld(), .inverse_world = draw.transform->GetInverseWorld() } );
+            i++;
+            continue;
+        }
+        
+        // The list is sorted by material and mesh, so the draws sharing them are next to each other.
+        size_t count = 1;
+        for( ; i + count < _end; count++ )
+        {
+            const auto& next = _list.GetDraw( entries[ i + count ].draw );
+            if( next.material != draw.material || next.mesh != draw.mesh || next.lod != draw.lod )
+                break;
+        }
+        
+        const auto instances = _commands.Push< sInstance_Data >( Commands::sDraw_Instanced{ .count = static_cast< uint32_t >( count ) }, count );
+        for( size_t j = 0; j < count; j++ )
+        {
+            const auto& transform = *_list.GetDraw( entries[ i + j ].draw ).transform;
+            instances[ j ] = { transform.GetWorld(), transform.GetInverseWorld() };
+        }
+        
+        i += count;
+    }
+}
+
+namespace
+{
+    // Replays commands into a frame buffer, keeping whatever state carries over from one command buffer to the next.
+    struct sSubmitter
+    {
+        // The handle type is up to the graphics plugin.
+        using program_t = decltype( std::declval< const Utils::cShader_Link& >().get_program() );
+        
+        const Object::Components::cCameraComponent& camera;
+        Rendering::cFrame_Buffer&                   frame_buffer;
+        
+        Utils::sDraw_Stats stats = {};
+        bool               res   = true;
+        
+        // Null while the draws of an invalid material are skipped.
+        Assets::cMaterial*     material     = nullptr;
+        Assets::cMaterial*     skipped      = nullptr;
+        Assets::cMesh*         mesh         = nullptr;
+        const cDynamic_Buffer* index_buffer = nullptr;
+        program_t              program      = {};
+        size_t                 instance     = 0;
+        
+        Assets::cMaterial::cBlock* object_block     = nullptr;
+        Assets::cMaterial::cBlock* instancing_block = nullptr;
+        
+        void operator()( const Utils::Commands::sUse_Material& _command )
+        {
+            if( _command.material == material || _command.material == skipped )
+                return;
+            
+            release( false );
+            skipped = nullptr;
+            
+            const auto& link = _command.material->GetShaderLink();
+            SK_ERR_IFN( link.IsReady(),
+                "Error: Link isn't ready yet, make sure to only record materials once Material.IsReady() returns true." )
+            
+            const auto& blocks = _command.material->GetBlocks();
+            object_block     = blocks.contains( kObjectBlock )     ? _command.material->GetBlock( kObjectBlock )     : nullptr;
+            instancing_block = blocks.contains( kInstancingBlock ) ? _command.material->GetBlock( kInstancingBlock ) : nullptr;
+            const auto camera_block = blocks.contains( kCameraBlock ) ? _command.material->GetBlock( kCameraBlock ) : nullptr;
+            
+            if( camera_block == nullptr || ( object_block == nullptr && instancing_block == nullptr ) )
+            {
+                SK_WARNING( sk::Severity::kGraphics,
+                    "Currently you NEED a \"Camera\" block and either an \"Object\" or \"Instancing\" block for this utility function to work." )
+                
+                skipped = _command.material;
+                res     = false;
+                return;
+            }
+            
+            material = _command.material;
+            material->GetMeta()->LockAsset();
+            
+            // Both are written for every draw, so they go straight to the uniform ring.
+            if( object_block )
+                object_block->SetPerDraw( true );
+            if( instancing_block )
+                instancing_block->SetPerDraw( true );
+            
+            // The camera is the same for every buffer, so it only has to be set along with the material.
+            camera_block->SetUniform( kViewProjUniform, camera.getViewProjInv() );
+            
+            frame_buffer.UseMaterial( *material );
+            
+            stats.material_changes++;
+            if( link.get_program() != program )
+            {
+                program = link.get_program();
+                stats.program_changes++;
+            }
+        }
+        
+        void operator()( const Utils::Commands::sBind_Mesh& _command )
+        {
+            if( material == nullptr )
+                return;
+            
+            if( _command.mesh != mesh )
+            {
+                if( mesh )
+                    mesh->GetMeta()->UnlockAsset();
+                
+                mesh = _command.mesh;
+                mesh->GetMeta()->LockAsset();
+                
+                auto& attributes     = material->GetShaderLink().GetReflection()->GetAttributes();
+                auto& vertex_buffers = mesh->GetVertexBuffers();
+                
+                for( auto& attribute : attributes )
+                {
+                    if( auto itr = vertex_buffers.find( attribute.name ); itr != vertex_buffers.end() )
+                        frame_buffer.BindVertexBuffer( attribute.index, itr->second.get() );
+                    else
+                        frame_buffer.BindVertexBuffer( attribute.index, nullptr );
+                }
+                
+                stats.mesh_changes++;
+            }
+            
+            if( const auto& indices = *mesh->GetIndexBuffer( _command.lod ); &indices != index_buffer )
+            {
+                index_buffer = &indices;
+                frame_buffer.BindIndexBuffer( indices );
+                
+                stats.index_changes++;
+            }
+        }
+        
+        void operator()( const Utils::Commands::sDraw& _command )
+        {
+            if( material == nullptr )
+                return;
+            
+            // The object block belongs to the material, so it still has to be written for every draw.
+            object_block->SetUniform( kWorldUniform,        _command.world );
+            object_block->SetUniform( kInverseWorldUniform, _command.inverse_world );
+            
+            draw( 1 );
+        }
+        
+        void operator()( const Utils::Commands::sDraw_Instanced& _command )
+        {
+            // The instance data was written for every instanced draw, skipped or not.
+            const auto first = instance;
+            instance += _command.count;
+            
+            if( material == nullptr )
+                return;
+            
+            instancing_block->SetUniform( kFirstInstanceUniform, static_cast< uint32_t >( first ) );
+            
+            draw( _command.count );
+        }
+        
+        void draw( const size_t _count )
+        {
+            // The per draw blocks get their own range of the uniform ring for every upload, so draws in flight keep the values they were recorded with.
+            frame_buffer.UploadBlocks( *material );
+            
+            if( !frame_buffer.DrawIndexedInstanced( _count ) )
+            {
+                SK_BREAK;
+                res = false;
+            }
+            
+            stats.draws++;
+            stats.instances += _count;
+        }
+        
+        // The state is only reset once every buffer is done, the frame buffer skips whatever the next material has in common with the last.
+        void release( const bool _reset )
+        {
+            if( mesh )
+                mesh->GetMeta()->UnlockAsset();
+            
+            if( material )
+                material->GetMeta()->UnlockAsset();
+            
+            if( _reset )
+            {
+                frame_buffer.UnbindIndexBuffer();
+                frame_buffer.UnbindVertexBuffers();
+                frame_buffer.ResetMaterial();
+            }
+            
+            material     = nullptr;
+            mesh         = nullptr;
+            index_buffer = nullptr;
+        }
+    };
+} // ::
+
+bool Utils::SubmitCommands( const Object::Components::cCameraComponent& _camera, Rendering::cFrame_Buffer& _frame_buffer,
+    const std::span< const cCommand_Buffer > _buffers, instance_buffer_t& _instances, sDraw_Stats* _stats )
+{
+    // The instance data is gathered up front in submission order, so it can be uploaded once.
+    size_t instance_count = 0;
+    for( const auto& buffer : _buffers )
+    {
+        buffer.Replay( [ & ]< class Ty >( const Ty& _command )
+        {
+            if constexpr( std::is_same_v< Ty, Commands::sDraw_Instanced > )
+            {
+                if( instance_count + _command.count > _instances.Size() )
+                    _instances.Resize( std::max< size_t >( { 64, instance_count + _command.count, _instances.Size() * 2 } ) );
+                
+                const auto instances = cCommand_Buffer::GetPayload< sInstance_Data >( _command, _command.count );
+                for( const auto& data : instances )
+                    _instances[ instance_count++ ] = data;
+            }
+        } );
+    }
+    
+    if( instance_count > 0 )
+    {
+        _instances.Upload( true );
+        _frame_buffer.BindStorageBuffer( kInstanceBinding, _instances.GetBuffer() );
+    }
+    
+    sSubmitter submitter{ .camera = _camera, .frame_buffer = _frame_buffer };
+    for( const auto& buffer : _buffers )
+        buffer.Replay( submitter );
+    
+    submitter.release( true );
+    
+    if( instance_count > 0 )
+        _frame_buffer.UnbindStorageBuffers();
+    
+    if( _stats )
+    {
+        const auto& stats = submitter.stats;
+        _stats->draws            += stats.draws;
+        _stats->instances        += stats.instances;
+        _stats->program_changes  += stats.program_changes;
+        _stats->material_changes += stats.material_changes;
+        _stats->mesh_changes     += stats.mesh_changes;
+        _stats->index_changes    += stats.index_changes;
+    }
+    
+    return submitter.res;
+}
@@ -6,8 +6,17 @@
 
 #pragma once
 
+#include <sk/Graphics/Buffer/Buffer.h>
+#include <sk/Graphics/Utils/Command_Buffer.h>
 #include <sk/Math/Matrix4x4.h>
 
+#include <span>
+
+namespace sk
+{
+    class cTransform;
+} // sk::
+
 namespace sk::Object::Components
 {
     class cCameraComponent;
@@ -26,9 +35,43 @@ namespace sk::Assets
 
 namespace sk::Graphics::Utils
 {
+    class  cDraw_List;
+    struct sDraw_Stats;
+
+    using instance_buffer_t = cStructured_Buffer< sInstance_Data >;
+    
+    // The shader storage binding the instance data is bound to.
+    constexpr size_t kInstanceBinding = 0;
+    
     void InitUtils();
     void ShutdownUtils();
     
+    // Uses the inverse world matrix cached in the transform, so the transform has to be up to date.
     bool RenderMesh( const Object::Components::cCameraComponent& _camera, Rendering::cFrame_Buffer &_frame_buffer, Assets::cMaterial &_material,
-        const cMatrix4x4f &_world_matrix, Assets::cMesh &_mesh );
+        const cTransform &_transform, Assets::cMesh &_mesh );
+
+    /**
+     * Records the draws in [ _begin, _end ) of a sorted draw list, doesn't touch the graphics api.
+     * Safe to call from any thread while the list isn't changing, as long as every thread records into its own buffer.
+     * Materials with an "_Instancing" block have the draws sharing mesh and lod recorded as a single instanced draw,
+     * their shader reads the instance data from kInstanceBinding at first_instance + gl_InstanceID.
+     */
+    void RecordDrawList( const cDraw_List& _list, size_t _begin, size_t _end, cCommand_Buffer& _commands );
+
+    // Decides which materials have their draws instanced, called once every time the material changes.
+    using is_instanced_t = bool( * )( const Assets::cMaterial* _material );
+
+    // Same as above, but with _is_instanced deciding which materials are instanced instead of their blocks. The materials are never touched otherwise.
+    void RecordDrawList( const cDraw_List& _list, size_t _begin, size_t _end, cCommand_Buffer& _commands, is_instanced_t _is_instanced );
+
+    /**
+     * Replays the buffers in order. Materials, vertex buffers and index buffers are only rebound when they change between draws,
+     * including from the end of one buffer to the start of the next.
+     *
+     * @param _instances Gets the instance data written to it, kept by the caller to avoid reallocating.
+     * @param _stats     Has the state changes added to it, can be nullptr.
+     * @return False if any of the draws failed.
+     */
+    bool SubmitCommands( const Object::Components::cCameraComponent& _camera, Rendering::cFrame_Buffer& _frame_buffer,
+        std::span< const cCommand_Buffer > _buffers, instance_buffer_t& _instances, sDraw_Stats* _stats = nullptr );
 } // sk::Graphics::Utils
@@ -0,0 +1,267 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Shadow_Atlas.h"
+
+#include <sk/Debugging/Macros/Assert.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <ranges>
+
+namespace sk::Graphics::Utils
+{
+    namespace
+    {
+        // How far past the current size, in halvings, the importance has to move before the size changes.
+        constexpr float kHysteresis = 0.75f;
+
+        // Nodes are numbered along a Z curve, so every other bit is the x or y of the tile.
+        auto compact_bits( uint32_t _bits ) -> uint32_t
+        {
+            _bits &= 0x55555555;
+            _bits = ( _bits | ( _bits >> 1 ) ) & 0x33333333;
+            _bits = ( _bits | ( _bits >> 2 ) ) & 0x0F0F0F0F;
+            _bits = ( _bits | ( _bits >> 4 ) ) & 0x00FF00FF;
+            _bits = ( _bits | ( _bits >> 8 ) ) & 0x0000FFFF;
+            return _bits;
+        } // compact_bits
+    } // ::
+
+    cShadow_Atlas::cShadow_Atlas( const uint32_t _size, const uint32_t _min_tile, const uint32_t _max_tile )
+    : m_size_( _size )
+    , m_min_tile_( _min_tile )
+    , m_max_tile_( _max_tile )
+    {
+        SK_ERR_IF( !std::has_single_bit( _size ) || !std::has_single_bit( _min_tile ) || !std::has_single_bit( _max_tile ),
+            "Error: The shadow atlas and its tiles have to be a power of two in size." )
+        SK_ERR_IF( _min_tile > _max_tile || _max_tile > _size,
+            "Error: The shadow atlas tiles have to be between the smallest tile and the size of the atlas." )
+
+        m_free_.resize( get_level( m_min_tile_ ) + 1 );
+        m_free_.front().insert( 0 );
+    } // cShadow_Atlas
+
+    auto cShadow_Atlas::PickSize( const float _importance, const uint32_t _current ) const -> uint32_t
+    {
+        const auto max_level = get_level( m_max_tile_ );
+        const auto levels    = static_cast< float >( get_level( m_min_tile_ ) - max_level );
+
+        // How many times the largest tile has to be halved, fractional so it can be compared against the current size.
+        const auto exact = _importance > 0.0f ? std::clamp( -std::log2( _importance ), 0.0f, levels ) : levels;
+
+        if( _current != 0 )
+        {
+            const auto current       = std::clamp( std::bit_floor( _current ), m_min_tile_, m_max_tile_ );
+            const auto current_level = static_cast< float >( get_level( current ) - max_level );
+            if( std::abs( exact - current_level ) < kHysteresis )
+                return current;
+        }
+
+        return m_max_tile_ >> static_cast< uint32_t >( std::round( exact ) );
+    } // PickSize
+
+    void cShadow_Atlas::Begin()
+    {
+        for( auto& entry : m_entries_ | std::views::values )
+            entry.used = false;
+    } // Begin
+
+    void cShadow_Atlas::Request( const cUUID& _caster, const float _importance )
+    {
+        auto& entry = m_entries_[ _caster ];
+        entry.requested = PickSize( _importance, entry.requested );
+        entry.used      = true;
+    } // Request
+
+    void cShadow_Atlas::End()
+    {
+        m_stats_ = {};
+
+        for( auto itr = m_entries_.begin(); itr != m_entries_.end(); )
+        {
+            if( auto& entry = itr->second; !entry.used )
+            {
+                if( entry.node != kNoNode )
+                    release( entry.level, entry.node );
+
+                itr = m_entries_.erase( itr );
+            }
+            else
+                ++itr;
+        }
+
+        // Halves the largest tiles until everything fits, the smallest casters keep their size for longer that way.
+        const auto atlas_area = static_cast< uint64_t >( m_size_ ) * m_size_;
+        auto       area       = atlas_area + 1;
+        for( m_stats_.max_tile = m_max_tile_ * 2; area > atlas_area && m_stats_.max_tile > m_min_tile_; )
+        {
+            m_stats_.max_tile /= 2;
+            area = 0;
+            for( const auto& entry : m_entries_ | std::views::values )
+            {
+                const auto size = std::min( entry.requested, m_stats_.max_tile );
+                area += static_cast< uint64_t >( size ) * size;
+            }
+        }
+
+        std::vector< sEntry* > pending;
+        for( auto& entry : m_entries_ | std::views::values )
+        {
+            // Casters which changed size, or didn't get the size they asked for last time, try again.
+            if( entry.node != kNoNode && entry.level != get_target( entry ) )
+            {
+                release( entry.level, entry.node );
+                entry.node = kNoNode;
+            }
+
+            if( entry.node == kNoNode )
+                pending.emplace_back( &entry );
+        }
+
+        // Largest first, so the small tiles don't split up the space the large ones need.
+        std::ranges::stable_sort( pending, std::ranges::less{}, [ this ]( const sEntry* _entry ){ return get_target( *_entry ); } );
+
+        bool fragmented = false;
+        for( const auto entry : pending )
+        {
+            fragmented |= !place( *entry ) || entry->level != get_target( *entry );
+            m_stats_.allocated++;
+        }
+
+        // Power of two tiles placed from scratch, largest first, always fit as long as their area does.
+        if( fragmented && area <= atlas_area )
+            repack();
+
+        m_stats_.casters = m_entries_.size();
+        for( const auto& entry : m_entries_ | std::views::values )
+        {
+            if( entry.node == kNoNode )
+            {
+                m_stats_.failed++;
+                continue;
+            }
+
+            if( entry.level != get_level( entry.requested ) )
+                m_stats_.downsized++;
+
+            const auto size = m_size_ >> entry.level;
+            m_stats_.used_area += static_cast< uint64_t >( size ) * size;
+        }
+    } // End
+
+    auto cShadow_Atlas::GetTile( const cUUID& _caster ) const -> sTile
+    {
+        const auto itr = m_entries_.find( _caster );
+        if( itr == m_entries_.end() || itr->second.node == kNoNode )
+            return {};
+
+        return get_tile( itr->second.level, itr->second.node );
+    } // GetTile
+
+    auto cShadow_Atlas::get_level( const uint32_t _size ) const -> uint32_t
+    {
+        return static_cast< uint32_t >( std::countr_zero( m_size_ ) - std::countr_zero( _size ) );
+    } // get_level
+
+    auto cShadow_Atlas::get_target( const sEntry& _entry ) const -> uint32_t
+    {
+        return get_level( std::min( _entry.requested, m_stats_.max_tile ) );
+    } // get_target
+
+    auto cShadow_Atlas::get_tile( const uint32_t _level, const uint32_t _node ) const -> sTile
+    {
+        const auto size = m_size_ >> _level;
+        return { .x = compact_bits( _node ) * size, .y = compact_bits( _node >> 1 ) * size, .size = size };
+    } // get_tile
+
+    auto cShadow_Atlas::allocate( const uint32_t _level ) -> uint32_t
+    {
+        // The lowest node first, which keeps the used tiles together in one corner.
+        if( auto& free = m_free_[ _level ]; !free.empty() )
+        {
+            const auto node = *free.begin();
+            free.erase( free.begin() );
+            return node;
+        }
+
+        if( _level == 0 )
+            return kNoNode;
+
+        const auto parent = allocate( _level - 1 );
+        if( parent == kNoNode )
+            return kNoNode;
+
+        const auto first = parent * 4;
+        m_free_[ _level ].insert( { first + 1, first + 2, first + 3 } );
+
+        return first;
+    } // allocate
+
+    void cShadow_Atlas::release( uint32_t _level, uint32_t _node )
+    {
+        for( ; _level > 0; --_level, _node /= 4 )
+        {
+            auto&      free  = m_free_[ _level ];
+            const auto first = _node & ~3u;
+
+            bool siblings_free = true;
+            for( uint32_t i = first; i < first + 4 && siblings_free; i++ )
+                siblings_free = i == _node || free.contains( i );
+
+            if( !siblings_free )
+                break;
+
+            for( uint32_t i = first; i < first + 4; i++ )
+                free.erase( i );
+        }
+
+        m_free_[ _level ].insert( _node );
+    } // release
+
+    bool cShadow_Atlas::place( sEntry& _entry )
+    {
+        for( auto level = get_target( _entry ); level < m_free_.size(); level++ )
+        {
+            if( const auto node = allocate( level ); node != kNoNode )
+            {
+                _entry.level = level;
+                _entry.node  = node;
+                return true;
+            }
+        }
+
+        _entry.node = kNoNode;
+        return false;
+    } // place
+
+    void cShadow_Atlas::repack()
+    {
+        std::vector< std::pair< sEntry*, sTile > > entries;
+        entries.reserve( m_entries_.size() );
+
+        for( auto& entry : m_entries_ | std::views::values )
+        {
+            entries.emplace_back( &entry, entry.node != kNoNode ? get_tile( entry.level, entry.node ) : sTile{} );
+            entry.node = kNoNode;
+        }
+
+        for( auto& free : m_free_ )
+            free.clear();
+        m_free_.front().insert( 0 );
+
+        std::ranges::stable_sort( entries, std::ranges::less{}, [ this ]( const auto& _pair ){ return get_target( *_pair.first ); } );
+
+        for( auto& [ entry, previous ] : entries )
+        {
+            if( place( *entry ) && previous.IsValid() && previous != get_tile( entry->level, entry->node ) )
+                m_stats_.moved++;
+        }
+
+        m_stats_.repacked = true;
+    } // repack
+} // sk::Graphics::Utils
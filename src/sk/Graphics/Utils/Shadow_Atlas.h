@@ -0,0 +1,113 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include <sk/Misc/UUID.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace sk::Graphics::Utils
+{
+    /**
+     * Hands out square power of two tiles of a shadow atlas, split as a quadtree so freed tiles merge back together.
+     * Casters ask for their tiles every frame between Begin and End. A caster keeps its tile for as long as it asks for the same size,
+     * the tiles of casters which stopped asking are freed, and the atlas is only repacked when it's too fragmented to fit the rest.
+     * When the atlas can't fit every caster, the largest tiles are shrunk first.
+     */
+    class cShadow_Atlas
+    {
+    public:
+        // In pixels.
+        struct sTile
+        {
+            uint32_t x    = 0;
+            uint32_t y    = 0;
+            uint32_t size = 0;
+
+            [[ nodiscard ]] bool IsValid() const { return size != 0; }
+            bool operator==( const sTile& ) const = default;
+        };
+
+        struct sStats
+        {
+            size_t   casters   = 0;
+            // Casters given a new tile, because they're new or changed size.
+            size_t   allocated = 0;
+            // Casters which kept their size, but got moved by a repack.
+            size_t   moved     = 0;
+            // Casters given a smaller tile than they asked for, or none at all.
+            size_t   downsized = 0;
+            size_t   failed    = 0;
+            // The largest tile handed out, lowered when every caster wouldn't fit otherwise.
+            uint32_t max_tile  = 0;
+            uint64_t used_area = 0;
+            bool     repacked  = false;
+        };
+
+        // Every size has to be a power of two.
+        cShadow_Atlas( uint32_t _size, uint32_t _min_tile, uint32_t _max_tile );
+
+        /**
+         * Picks the tile size of a caster from how much of the screen it covers.
+         * @param _importance Roughly how much of the screens height the caster covers, 1 and above gets the largest tiles.
+         * @param _current The size the caster asked for last time. Kept until the importance has moved well past it, so the resolution doesn't flicker.
+         */
+        [[ nodiscard ]] auto PickSize( float _importance, uint32_t _current = 0 ) const -> uint32_t;
+
+        void Begin();
+        // Asks for a tile of the size PickSize gives the importance.
+        void Request( const cUUID& _caster, float _importance );
+        void End();
+
+        // Invalid if the caster didn't fit, or didn't ask for a tile.
+        [[ nodiscard ]] auto GetTile( const cUUID& _caster ) const -> sTile;
+
+        [[ nodiscard ]] auto  GetSize   () const { return m_size_; }
+        [[ nodiscard ]] auto  GetMinTile() const { return m_min_tile_; }
+        [[ nodiscard ]] auto  GetMaxTile() const { return m_max_tile_; }
+        [[ nodiscard ]] auto& GetStats  () const { return m_stats_; }
+
+    private:
+        static constexpr uint32_t kNoNode = ~0u;
+
+        struct sEntry
+        {
+            uint32_t requested = 0;
+            // The level and index of the node in the quadtree, see get_tile.
+            uint32_t level     = 0;
+            uint32_t node      = kNoNode;
+            bool     used      = false;
+        };
+
+        [[ nodiscard ]] auto get_level ( uint32_t _size ) const -> uint32_t;
+        // The level the caster should be on, after limiting it to the largest tile of this frame.
+        [[ nodiscard ]] auto get_target( const sEntry& _entry ) const -> uint32_t;
+        [[ nodiscard ]] auto get_tile  ( uint32_t _level, uint32_t _node ) const -> sTile;
+
+        // Splits larger nodes when there's no free node on the level.
+        auto allocate( uint32_t _level ) -> uint32_t;
+        // Merges the node with its siblings for as long as all four are free.
+        void release ( uint32_t _level, uint32_t _node );
+        // Tries the target size first, then every smaller one.
+        bool place   ( sEntry& _entry );
+        void repack  ();
+
+        uint32_t m_size_;
+        uint32_t m_min_tile_;
+        uint32_t m_max_tile_;
+
+        // The free nodes of every level, level 0 being the whole atlas. The children of node i are 4i to 4i + 3.
+        std::vector< std::set< uint32_t > > m_free_;
+        std::map< cUUID, sEntry >           m_entries_;
+
+        sStats m_stats_;
+    };
+} // sk::Graphics::Utils
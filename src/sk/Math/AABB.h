@@ -0,0 +1,153 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include "Matrix4x4.h"
+
+#include <limits>
+
+namespace sk::Math
+{
+	// Axis aligned bounding box. A default constructed box is empty and becomes valid once something is merged into it.
+	template< class T >
+	class cAABB
+	{
+	public:
+		constexpr cAABB( void ) = default;
+		constexpr cAABB( const cVector3< T >& _min, const cVector3< T >& _max )
+		: m_min_( _min )
+		, m_max_( _max )
+		{}
+
+		[[ nodiscard ]] static constexpr auto FromCenterExtents( const cVector3< T >& _center, const cVector3< T >& _extents ) -> cAABB
+		{
+			return { _center - _extents, _center + _extents };
+		}
+
+		[[ nodiscard ]] constexpr auto& GetMin( void ) const { return m_min_; }
+		[[ nodiscard ]] constexpr auto& GetMax( void ) const { return m_max_; }
+
+		[[ nodiscard ]] constexpr bool IsValid( void ) const { return m_min_.x <= m_max_.x && m_min_.y <= m_max_.y && m_min_.z <= m_max_.z; }
+
+		[[ nodiscard ]] constexpr auto GetCenter ( void ) const { return ( m_min_ + m_max_ ) * T( 0.5 ); }
+		[[ nodiscard ]] constexpr auto GetExtents( void ) const { return ( m_max_ - m_min_ ) * T( 0.5 ); }
+		[[ nodiscard ]] constexpr auto GetSize   ( void ) const { return m_max_ - m_min_; }
+
+		// Used as the cost metric when building trees, an empty box has no area.
+		[[ nodiscard ]] constexpr auto GetSurfaceArea( void ) const -> T
+		{
+			if( !IsValid() )
+				return T( 0 );
+
+			const auto size = GetSize();
+			return T( 2 ) * ( size.x * size.y + size.y * size.z + size.z * size.x );
+		}
+
+		constexpr auto& Merge( const cVector3< T >& _point )
+		{
+			m_min_ = { Math::min( m_min_.x, _point.x ), Math::min( m_min_.y, _point.y ), Math::min( m_min_.z, _point.z ) };
+			m_max_ = { Math::max( m_max_.x, _point.x ), Math::max( m_max_.y, _point.y ), Math::max( m_max_.z, _point.z ) };
+			return *this;
+		}
+
+		constexpr auto& Merge( const cAABB& _other )
+		{
+			m_min_ = { Math::min( m_min_.x, _other.m_min_.x ), Math::min( m_min_.y, _other.m_min_.y ), Math::min( m_min_.z, _other.m_min_.z ) };
+			m_max_ = { Math::max( m_max_.x, _other.m_max_.x ), Math::max( m_max_.y, _other.m_max_.y ), Math::max( m_max_.z, _other.m_max_.z ) };
+			return *this;
+		}
+
+		[[ nodiscard ]] constexpr auto Merged( const cAABB& _other ) const { return cAABB( *this ).Merge( _other ); }
+
+		[[ nodiscard ]] constexpr bool Intersects( const cAABB& _other ) const
+		{
+			return m_min_.x <= _other.m_max_.x && m_max_.x >= _other.m_min_.x
+				&& m_min_.y <= _other.m_max_.y && m_max_.y >= _other.m_min_.y
+				&& m_min_.z <= _other.m_max_.z && m_max_.z >= _other.m_min_.z;
+		}
+
+		[[ nodiscard ]] constexpr bool Intersects( const cVector3< T >& _center, const T _radius ) const
+		{
+			const auto distance = [ & ]( const T _value, const T _min, const T _max )
+			{
+				return _value < _min ? _min - _value : _value > _max ? _value - _max : T( 0 );
+			};
+
+			const auto dx = distance( _center.x, m_min_.x, m_max_.x );
+			const auto dy = distance( _center.y, m_min_.y, m_max_.y );
+			const auto dz = distance( _center.z, m_min_.z, m_max_.z );
+			return dx * dx + dy * dy + dz * dz <= _radius * _radius;
+		}
+
+		// Slab test, _inverse_direction is 1 / direction per axis. _distance is set to where the ray enters the box.
+		[[ nodiscard ]] bool Intersects( const cVector3< T >& _origin, const cVector3< T >& _inverse_direction, const T _max_distance, T& _distance ) const
+		{
+			T enter = T( 0 );
+			T exit  = _max_distance;
+			for( size_t i = 0; i < 3; i++ )
+			{
+				auto t0 = ( m_min_[ i ] - _origin[ i ] ) * _inverse_direction[ i ];
+				auto t1 = ( m_max_[ i ] - _origin[ i ] ) * _inverse_direction[ i ];
+				if( t0 > t1 )
+					std::swap( t0, t1 );
+
+				enter = Math::max( enter, t0 );
+				exit  = Math::min( exit, t1 );
+			}
+
+			_distance = enter;
+			return enter <= exit;
+		}
+
+		[[ nodiscard ]] constexpr bool Contains( const cVector3< T >& _point ) const
+		{
+			return _point.x >= m_min_.x && _point.x <= m_max_.x
+				&& _point.y >= m_min_.y && _point.y <= m_max_.y
+				&& _point.z >= m_min_.z && _point.z <= m_max_.z;
+		}
+
+		[[ nodiscard ]] constexpr bool Contains( const cAABB& _other ) const
+		{
+			return Contains( _other.m_min_ ) && Contains( _other.m_max_ );
+		}
+
+		// Returns the box enclosing this box after being transformed by _matrix.
+		[[ nodiscard ]] constexpr auto Transformed( const cMatrix4x4< T >& _matrix ) const -> cAABB
+		{
+			if( !IsValid() )
+				return {};
+
+			// Arvo's method, the extents are projected onto the absolute basis vectors.
+			const auto center  = GetCenter();
+			const auto extents = GetExtents();
+
+			cVector3< T > new_center  = { _matrix.w.x, _matrix.w.y, _matrix.w.z };
+			cVector3< T > new_extents = cVector3< T >( T( 0 ) );
+			const cVector4< T >* rows[ 3 ] = { &_matrix.x, &_matrix.y, &_matrix.z };
+			for( size_t r = 0; r < 3; r++ )
+			{
+				for( size_t c = 0; c < 3; c++ )
+				{
+					new_center [ c ] += ( *rows[ r ] )[ c ] * center[ r ];
+					new_extents[ c ] += Math::abs( ( *rows[ r ] )[ c ] ) * extents[ r ];
+				}
+			}
+
+			return FromCenterExtents( new_center, new_extents );
+		}
+
+	private:
+		cVector3< T > m_min_ = cVector3< T >( std::numeric_limits< T >::max() );
+		cVector3< T > m_max_ = cVector3< T >( std::numeric_limits< T >::lowest() );
+	};
+} // sk::Math::
+
+namespace sk
+{
+	using cAABBf = Math::cAABB< float >;
+	using cAABBd = Math::cAABB< double >;
+} // sk::
@@ -0,0 +1,544 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Bounding_Volume_Hierarchy.h"
+
+#include <sk/Debugging/Debugging.h>
+
+#include <algorithm>
+
+using namespace sk;
+
+auto cBounding_Volume_Hierarchy::Insert( const cAABBf& _bounds, void* _user_data ) -> proxy_t
+{
+    proxy_t proxy;
+    if( m_free_proxies_.empty() )
+    {
+        proxy = static_cast< proxy_t >( m_proxies_.size() );
+        m_proxies_.emplace_back();
+    }
+    else
+    {
+        proxy = m_free_proxies_.back();
+        m_free_proxies_.pop_back();
+    }
+
+    m_proxies_[ proxy ] = sProxy{ .bounds = _bounds, .user_data = _user_data, .leaf = kNoNode, .alive = true };
+    m_size_++;
+
+    if( m_nodes_.empty() )
+    {
+        const auto root = add_node( sNode{ .bounds = {}, .first = add_block(), .count = 1, .parent = kNoNode } );
+        m_leaf_proxies_[ m_nodes_[ root ].first ] = proxy;
+        m_proxies_[ proxy ].leaf = root;
+        set_bounds( root, _bounds );
+        return proxy;
+    }
+
+    const auto leaf = find_leaf( _bounds );
+    if( auto& node = m_nodes_[ leaf ]; node.count < kMaxLeafSize )
+    {
+        const auto area = get_area( node );
+        m_leaf_proxies_[ node.first + node.count++ ] = proxy;
+        m_area_sum_ += get_area( node ) - area;
+
+        m_proxies_[ proxy ].leaf = leaf;
+        set_bounds( leaf, node.bounds.Merged( _bounds ) );
+    }
+    else
+        split_leaf( leaf, proxy );
+
+    grow_ancestors( leaf, _bounds );
+
+    return proxy;
+}
+
+void cBounding_Volume_Hierarchy::Remove( const proxy_t _proxy )
+{
+    SK_BREAK_RET_IFN( sk::Severity::kEngine, IsValid( _proxy ),
+        "Error: Trying to remove an invalid proxy." )
+
+    auto& proxy = m_proxies_[ _proxy ];
+    if( proxy.leaf != kNoNode )
+    {
+        auto&      leaf  = m_nodes_[ proxy.leaf ];
+        const auto area  = get_area( leaf );
+        const auto begin = m_leaf_proxies_.begin() + leaf.first;
+
+        // The order within a leaf doesn't matter, so the last proxy takes its place.
+        std::iter_swap( std::find( begin, begin + leaf.count, _proxy ), begin + leaf.count - 1 );
+        leaf.count--;
+        m_area_sum_ += get_area( leaf ) - area;
+
+        if( leaf.count == 0 )
+            collapse( proxy.leaf );
+        else
+            refit_ancestors( proxy.leaf );
+    }
+
+    proxy.alive     = false;
+    proxy.user_data = nullptr;
+    proxy.leaf      = kNoNode;
+    m_free_proxies_.emplace_back( _proxy );
+
+    m_size_--;
+}
+
+void cBounding_Volume_Hierarchy::Move( const proxy_t _proxy, const cAABBf& _bounds )
+{
+    SK_BREAK_RET_IFN( sk::Severity::kEngine, IsValid( _proxy ),
+        "Error: Trying to move an invalid proxy." )
+
+    auto& proxy = m_proxies_[ _proxy ];
+    proxy.bounds = _bounds;
+
+    if( proxy.leaf == kNoNode )
+        return;
+
+    m_dirty_nodes_[ proxy.leaf ] = 1;
+    m_needs_refit_ = true;
+}
+
+bool cBounding_Volume_Hierarchy::IsValid( const proxy_t _proxy ) const
+{
+    return _proxy < m_proxies_.size() && m_proxies_[ _proxy ].alive;
+}
+
+void cBounding_Volume_Hierarchy::Update()
+{
+    if( m_needs_refit_ )
+        Refit();
+
+    // The cost also grows with every insert, so a tree mostly made by inserting one at a time gets rebuilt as well.
+    const bool is_loose  = GetCost() > m_built_cost_ * m_rebuild_threshold_;
+    const bool is_sparse = m_dead_nodes_ * 2 > m_nodes_.size();
+
+    if( is_loose || is_sparse )
+        Rebuild();
+}
+
+void cBounding_Volume_Hierarchy::Rebuild()
+{
+    m_nodes_       .clear();
+    m_leaf_proxies_.clear();
+    m_free_blocks_ .clear();
+    m_leaf_proxies_.reserve( m_size_ );
+
+    for( proxy_t i = 0; i < m_proxies_.size(); i++ )
+    {
+        if( m_proxies_[ i ].alive )
+            m_leaf_proxies_.emplace_back( i );
+    }
+
+    m_area_sum_    = 0.0f;
+    m_dead_nodes_  = 0;
+    m_needs_refit_ = false;
+
+    if( m_leaf_proxies_.empty() )
+    {
+        m_dirty_nodes_.clear();
+        m_built_cost_ = 0.0f;
+        return;
+    }
+
+    // A binary tree with n leaves never has more than 2n - 1 nodes.
+    m_nodes_.reserve( m_leaf_proxies_.size() * 2 );
+    m_nodes_.emplace_back( sNode{ .bounds = {}, .first = 0, .count = static_cast< uint32_t >( m_leaf_proxies_.size() ), .parent = kNoNode } );
+
+    split( 0 );
+
+    // The leaves are built packed together, then spread out into blocks so later inserts have room.
+    const auto packed = std::move( m_leaf_proxies_ );
+    m_leaf_proxies_.clear();
+    for( auto& node : m_nodes_ )
+    {
+        if( node.count == 0 )
+            continue;
+
+        const auto block = add_block();
+        std::copy_n( packed.begin() + node.first, node.count, m_leaf_proxies_.begin() + block );
+        node.first = block;
+    }
+
+    m_dirty_nodes_.assign( m_nodes_.size(), 0 );
+    m_built_cost_ = GetCost();
+}
+
+void cBounding_Volume_Hierarchy::split( const uint32_t _root )
+{
+    struct sPending
+    {
+        uint32_t node;
+        uint32_t depth;
+    };
+
+    std::vector< sPending > pending = { { _root, 0 } };
+
+    while( !pending.empty() )
+    {
+        const auto [ index, depth ] = pending.back();
+        pending.pop_back();
+
+        const auto node = m_nodes_[ index ];
+
+        cAABBf bounds, centroids;
+        for( uint32_t i = node.first; i < node.first + node.count; i++ )
+        {
+            const auto& proxy_bounds = m_proxies_[ m_leaf_proxies_[ i ] ].bounds;
+            bounds   .Merge( proxy_bounds );
+            centroids.Merge( proxy_bounds.GetCenter() );
+        }
+
+        m_nodes_[ index ].bounds = bounds;
+        if( node.count > 1 )
+            m_area_sum_ += bounds.GetSurfaceArea();
+
+        const auto make_leaf = [ & ]
+        {
+            for( uint32_t i = node.first; i < node.first + node.count; i++ )
+                m_proxies_[ m_leaf_proxies_[ i ] ].leaf = index;
+        };
+
+        // _left is the amount of proxies going into the left child.
+        const auto make_children = [ & ]( const uint32_t _left )
+        {
+            const auto first = static_cast< uint32_t >( m_nodes_.size() );
+            m_nodes_.emplace_back( sNode{ .bounds = {}, .first = node.first, .count = _left, .parent = index } );
+            m_nodes_.emplace_back( sNode{ .bounds = {}, .first = node.first + _left, .count = node.count - _left, .parent = index } );
+            m_nodes_[ index ].first = first;
+            m_nodes_[ index ].count = 0;
+
+            pending.emplace_back( first + 1, depth + 1 );
+            pending.emplace_back( first, depth + 1 );
+        };
+
+        if( node.count <= 1 )
+        {
+            make_leaf();
+            continue;
+        }
+
+        // Splits along the axis where the centroids are the most spread out.
+        const auto size = centroids.GetSize();
+        const auto axis = size.x >= size.y && size.x >= size.z ? 0 : size.y >= size.z ? 1 : 2;
+        const auto min  = centroids.GetMin()[ axis ];
+        const auto span = size[ axis ];
+
+        // Either every centroid is in the same place, or the tree is getting too deep for the query stack.
+        // Splitting in the middle keeps the leaves small and the remaining depth logarithmic.
+        if( span <= 0.0f || depth >= kMaxSahDepth )
+        {
+            if( node.count <= kMaxLeafSize )
+                make_leaf();
+            else
+            {
+                const auto begin = m_leaf_proxies_.begin() + node.first;
+                std::nth_element( begin, begin + node.count / 2, begin + node.count, [ & ]( const proxy_t _a, const proxy_t _b )
+                {
+                    return m_proxies_[ _a ].bounds.GetCenter()[ axis ] < m_proxies_[ _b ].bounds.GetCenter()[ axis ];
+                } );
+                make_children( node.count / 2 );
+            }
+            continue;
+        }
+
+        const auto bin_of = [ & ]( const cAABBf& _bounds )
+        {
+            const auto bin = static_cast< uint32_t >( ( _bounds.GetCenter()[ axis ] - min ) / span * kBinCount );
+            return std::min( bin, kBinCount - 1 );
+        };
+
+        struct sBin
+        {
+            cAABBf   bounds;
+            uint32_t count = 0;
+        };
+
+        sBin bins[ kBinCount ];
+        for( uint32_t i = node.first; i < node.first + node.count; i++ )
+        {
+            const auto& proxy_bounds = m_proxies_[ m_leaf_proxies_[ i ] ].bounds;
+            auto& bin = bins[ bin_of( proxy_bounds ) ];
+            bin.bounds.Merge( proxy_bounds );
+            bin.count++;
+        }
+
+        // Sweeps from the right first so the left sweep can evaluate every split directly.
+        float    right_areas [ kBinCount - 1 ];
+        uint32_t right_counts[ kBinCount - 1 ];
+        cAABBf   right_bounds;
+        uint32_t right_count = 0;
+        for( uint32_t i = kBinCount - 1; i > 0; i-- )
+        {
+            right_bounds.Merge( bins[ i ].bounds );
+            right_count += bins[ i ].count;
+            right_areas [ i - 1 ] = right_bounds.GetSurfaceArea();
+            right_counts[ i - 1 ] = right_count;
+        }
+
+        float    best_cost  = std::numeric_limits< float >::max();
+        uint32_t best_split = 0;
+        cAABBf   left_bounds;
+        uint32_t left_count = 0;
+        for( uint32_t i = 0; i < kBinCount - 1; i++ )
+        {
+            left_bounds.Merge( bins[ i ].bounds );
+            left_count += bins[ i ].count;
+
+            if( left_count == 0 || right_counts[ i ] == 0 )
+                continue;
+
+            const auto cost = left_bounds.GetSurfaceArea() * static_cast< float >( left_count ) + right_areas[ i ] * static_cast< float >( right_counts[ i ] );
+            if( cost < best_cost )
+            {
+                best_cost  = cost;
+                best_split = i;
+            }
+        }
+
+        // Traversing a node is assumed to cost about as much as testing a single box.
+        const auto area = bounds.GetSurfaceArea();
+        if( node.count <= kMaxLeafSize && best_cost + area >= area * static_cast< float >( node.count ) )
+        {
+            make_leaf();
+            continue;
+        }
+
+        const auto begin  = m_leaf_proxies_.begin() + node.first;
+        const auto middle = std::partition( begin, begin + node.count, [ & ]( const proxy_t _proxy )
+        {
+            return bin_of( m_proxies_[ _proxy ].bounds ) <= best_split;
+        } );
+
+        make_children( static_cast< uint32_t >( middle - begin ) );
+    }
+}
+
+void cBounding_Volume_Hierarchy::Refit()
+{
+    // Children are always placed after their parent, so going backwards updates them first.
+    for( size_t i = m_nodes_.size(); i > 0; i-- )
+    {
+        const auto index = static_cast< uint32_t >( i - 1 );
+        if( !m_dirty_nodes_[ index ] )
+            continue;
+
+        const auto& node = m_nodes_[ index ];
+
+        cAABBf bounds;
+        if( node.count == 0 )
+            bounds = m_nodes_[ node.first ].bounds.Merged( m_nodes_[ node.first + 1 ].bounds );
+        else
+        {
+            for( uint32_t p = node.first; p < node.first + node.count; p++ )
+                bounds.Merge( m_proxies_[ m_leaf_proxies_[ p ] ].bounds );
+        }
+
+        set_bounds( index, bounds );
+        m_dirty_nodes_[ index ] = 0;
+
+        if( node.parent != kNoNode )
+            m_dirty_nodes_[ node.parent ] = 1;
+    }
+
+    m_needs_refit_ = false;
+}
+
+auto cBounding_Volume_Hierarchy::GetCost() const -> float
+{
+    if( m_nodes_.empty() )
+        return 0.0f;
+
+    const auto root_area = m_nodes_.front().bounds.GetSurfaceArea();
+    return root_area > 0.0f ? m_area_sum_ / root_area : 0.0f;
+}
+
+auto cBounding_Volume_Hierarchy::get_area( const sNode& _node ) const -> float
+{
+    return _node.count != 1 ? _node.bounds.GetSurfaceArea() : 0.0f;
+}
+
+void cBounding_Volume_Hierarchy::set_bounds( const uint32_t _node, const cAABBf& _bounds )
+{
+    auto& node = m_nodes_[ _node ];
+    const auto area = get_area( node );
+    node.bounds  = _bounds;
+    m_area_sum_ += get_area( node ) - area;
+}
+
+auto cBounding_Volume_Hierarchy::add_node( const sNode& _node ) -> uint32_t
+{
+    m_nodes_      .emplace_back( _node );
+    m_dirty_nodes_.emplace_back( 0 );
+    return static_cast< uint32_t >( m_nodes_.size() - 1 );
+}
+
+auto cBounding_Volume_Hierarchy::add_block() -> uint32_t
+{
+    if( !m_free_blocks_.empty() )
+    {
+        const auto block = m_free_blocks_.back();
+        m_free_blocks_.pop_back();
+        return block;
+    }
+
+    const auto block = static_cast< uint32_t >( m_leaf_proxies_.size() );
+    m_leaf_proxies_.resize( m_leaf_proxies_.size() + kMaxLeafSize, kInvalid );
+    return block;
+}
+
+auto cBounding_Volume_Hierarchy::find_leaf( const cAABBf& _bounds ) const -> uint32_t
+{
+    uint32_t index = 0;
+    while( m_nodes_[ index ].count == 0 )
+    {
+        const auto first = m_nodes_[ index ].first;
+
+        const auto growth = [ & ]( const uint32_t _child )
+        {
+            const auto& bounds = m_nodes_[ _child ].bounds;
+            return bounds.Merged( _bounds ).GetSurfaceArea() - bounds.GetSurfaceArea();
+        };
+
+        const auto left  = growth( first );
+        const auto right = growth( first + 1 );
+
+        // Ties go to the smaller child, which keeps the tree from leaning to one side.
+        if( left != right )
+            index = left < right ? first : first + 1;
+        else
+            index = m_nodes_[ first ].bounds.GetSurfaceArea() <= m_nodes_[ first + 1 ].bounds.GetSurfaceArea() ? first : first + 1;
+    }
+
+    return index;
+}
+
+void cBounding_Volume_Hierarchy::split_leaf( const uint32_t _leaf, const proxy_t _proxy )
+{
+    proxy_t proxies[ kMaxLeafSize + 1 ];
+    std::copy_n( m_leaf_proxies_.begin() + m_nodes_[ _leaf ].first, kMaxLeafSize, proxies );
+    proxies[ kMaxLeafSize ] = _proxy;
+
+    cAABBf bounds, centroids;
+    for( const auto proxy : proxies )
+    {
+        bounds   .Merge( m_proxies_[ proxy ].bounds );
+        centroids.Merge( m_proxies_[ proxy ].bounds.GetCenter() );
+    }
+
+    // Halved along the axis where the centroids are the most spread out, like the middle split of a rebuild.
+    const auto size = centroids.GetSize();
+    const auto axis = size.x >= size.y && size.x >= size.z ? 0 : size.y >= size.z ? 1 : 2;
+    std::ranges::sort( proxies, std::ranges::less{}, [ & ]( const proxy_t _proxy ){ return m_proxies_[ _proxy ].bounds.GetCenter()[ axis ]; } );
+
+    constexpr uint32_t left_count = ( kMaxLeafSize + 1 ) / 2;
+
+    // The old block goes to the left child, so only the right one needs a new block.
+    const auto block = m_nodes_[ _leaf ].first;
+    const auto left  = add_node( sNode{ .bounds = {}, .first = block,       .count = left_count,                    .parent = _leaf } );
+    const auto right = add_node( sNode{ .bounds = {}, .first = add_block(), .count = kMaxLeafSize + 1 - left_count, .parent = _leaf } );
+
+    for( const auto child : { left, right } )
+    {
+        const auto& node = m_nodes_[ child ];
+        const auto  from = child == left ? 0u : left_count;
+
+        cAABBf child_bounds;
+        for( uint32_t i = 0; i < node.count; i++ )
+        {
+            const auto proxy = proxies[ from + i ];
+            m_leaf_proxies_[ node.first + i ] = proxy;
+            m_proxies_[ proxy ].leaf = child;
+            child_bounds.Merge( m_proxies_[ proxy ].bounds );
+        }
+
+        set_bounds( child, child_bounds );
+    }
+
+    // Counted as a leaf until it's turned into an internal node, then as one after.
+    const auto area = get_area( m_nodes_[ _leaf ] );
+    m_nodes_[ _leaf ].first  = left;
+    m_nodes_[ _leaf ].count  = 0;
+    m_nodes_[ _leaf ].bounds = bounds;
+    m_area_sum_ += get_area( m_nodes_[ _leaf ] ) - area;
+}
+
+void cBounding_Volume_Hierarchy::collapse( const uint32_t _leaf )
+{
+    m_free_blocks_.emplace_back( m_nodes_[ _leaf ].first );
+
+    const auto parent = m_nodes_[ _leaf ].parent;
+    if( parent == kNoNode )
+    {
+        // The last proxy is gone.
+        m_nodes_       .clear();
+        m_dirty_nodes_ .clear();
+        m_leaf_proxies_.clear();
+        m_free_blocks_ .clear();
+        m_area_sum_   = 0.0f;
+        m_dead_nodes_ = 0;
+        return;
+    }
+
+    const auto first   = m_nodes_[ parent ].first;
+    const auto sibling = _leaf == first ? first + 1 : first;
+    const auto moved   = m_nodes_[ sibling ];
+
+    // The parent takes over the sibling, its children or proxies now point back to the parent instead.
+    m_area_sum_ -= get_area( m_nodes_[ parent ] ) + get_area( m_nodes_[ _leaf ] ) + get_area( moved );
+    m_nodes_[ parent ].first  = moved.first;
+    m_nodes_[ parent ].count  = moved.count;
+    m_nodes_[ parent ].bounds = moved.bounds;
+    m_area_sum_ += get_area( m_nodes_[ parent ] );
+
+    if( moved.count == 0 )
+    {
+        m_nodes_[ moved.first     ].parent = parent;
+        m_nodes_[ moved.first + 1 ].parent = parent;
+    }
+    else
+    {
+        for( uint32_t i = moved.first; i < moved.first + moved.count; i++ )
+            m_proxies_[ m_leaf_proxies_[ i ] ].leaf = parent;
+    }
+
+    m_dirty_nodes_[ parent ] |= m_dirty_nodes_[ sibling ];
+    m_dirty_nodes_[ first     ] = 0;
+    m_dirty_nodes_[ first + 1 ] = 0;
+    m_dead_nodes_ += 2;
+
+    refit_ancestors( parent );
+}
+
+void cBounding_Volume_Hierarchy::grow_ancestors( const uint32_t _node, const cAABBf& _bounds )
+{
+    for( auto index = m_nodes_[ _node ].parent; index != kNoNode; index = m_nodes_[ index ].parent )
+    {
+        if( m_nodes_[ index ].bounds.Contains( _bounds ) )
+            break;
+
+        set_bounds( index, m_nodes_[ index ].bounds.Merged( _bounds ) );
+    }
+}
+
+void cBounding_Volume_Hierarchy::refit_ancestors( const uint32_t _node )
+{
+    for( auto index = _node; index != kNoNode; index = m_nodes_[ index ].parent )
+    {
+        const auto& node = m_nodes_[ index ];
+
+        cAABBf bounds;
+        if( node.count == 0 )
+            bounds = m_nodes_[ node.first ].bounds.Merged( m_nodes_[ node.first + 1 ].bounds );
+        else
+        {
+            for( uint32_t p = node.first; p < node.first + node.count; p++ )
+                bounds.Merge( m_proxies_[ m_leaf_proxies_[ p ] ].bounds );
+        }
+
+        set_bounds( index, bounds );
+    }
+}
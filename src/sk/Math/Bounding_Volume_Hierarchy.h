@@ -0,0 +1,221 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include <sk/Math/AABB.h>
+#include <sk/Math/Frustum.h>
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace sk
+{
+	// Dynamic bounding volume hierarchy over axis aligned boxes.
+	// The tree is built with a binned surface area heuristic. Inserting and removing only changes the leaf and the nodes above it,
+	// and moving a proxy only refits them. The tree only gets rebuilt once those changes have made it too loose.
+	class cBounding_Volume_Hierarchy
+	{
+	public:
+		using proxy_t = uint32_t;
+
+		static constexpr proxy_t kInvalid = std::numeric_limits< proxy_t >::max();
+
+		static constexpr uint32_t kMaxLeafSize = 4;
+		static constexpr uint32_t kBinCount    = 12;
+
+		// Goes into the leaf which grows the least, splitting it if it's full.
+		auto Insert( const cAABBf& _bounds, void* _user_data = nullptr ) -> proxy_t;
+		// Leaves left empty are collapsed into their parent.
+		void Remove( proxy_t _proxy );
+		// Only refits the tree, so moving something far away will make it looser until the next rebuild.
+		void Move  ( proxy_t _proxy, const cAABBf& _bounds );
+
+		[[ nodiscard ]] bool IsValid( proxy_t _proxy ) const;
+
+		[[ nodiscard ]] auto& GetBounds  ( const proxy_t _proxy ) const { return m_proxies_[ _proxy ].bounds; }
+		[[ nodiscard ]] auto  GetUserData( const proxy_t _proxy ) const { return m_proxies_[ _proxy ].user_data; }
+
+		// Rebuilds or refits the tree depending on what has changed since the last update.
+		void Update();
+		void Rebuild();
+		void Refit();
+
+		// The tree gets rebuilt when its cost grows past the cost after the last build times this. Defaults to 1.5.
+		void SetRebuildThreshold( const float _threshold ){ m_rebuild_threshold_ = _threshold; }
+
+		// The queries call _function with the proxy of every box passing the test.
+		// Only valid after Update, and the tree can't be modified while querying.
+		template< class Fn >
+		void QueryAABB   ( const cAABBf& _bounds, Fn&& _function ) const;
+		template< class Fn >
+		void QuerySphere ( const cVector3f& _center, float _radius, Fn&& _function ) const;
+		template< class Fn >
+		void QueryFrustum( const cFrustumf& _frustum, Fn&& _function ) const;
+		// _function also gets the distance to where the ray enters the box.
+		template< class Fn >
+		void QueryRay    ( const cVector3f& _origin, const cVector3f& _direction, float _max_distance, Fn&& _function ) const;
+
+		[[ nodiscard ]] auto GetSize     () const { return m_size_; }
+		[[ nodiscard ]] auto GetNodeCount() const { return m_nodes_.size() - m_dead_nodes_; }
+		// Sum of the surface area of every internal node relative to the root.
+		[[ nodiscard ]] auto GetCost     () const -> float;
+
+	private:
+		struct sProxy
+		{
+			cAABBf   bounds;
+			void*    user_data;
+			uint32_t leaf;
+			bool     alive;
+		};
+
+		// Internal nodes have their children at first and first + 1, leaves own count proxies starting at first.
+		// Every leaf has a block of kMaxLeafSize proxies to itself, so proxies can be added without moving the others.
+		// Children are always placed after their parent.
+		struct sNode
+		{
+			cAABBf   bounds;
+			uint32_t first;
+			uint32_t count;
+			uint32_t parent;
+		};
+
+		static constexpr uint32_t kNoNode = std::numeric_limits< uint32_t >::max();
+		// Past this depth the nodes are split in the middle instead, which bounds the depth of the whole tree.
+		static constexpr uint32_t kMaxSahDepth   = 64;
+		// Nodes the queries keep on their own stack before spilling over onto the heap.
+		// Rebuilt trees never get that deep, but inserting one at a time can make a tree deeper than this until the next rebuild.
+		static constexpr uint32_t kMaxStackDepth = 128;
+
+		// Recursively splits the node while it's cheaper than keeping it as a leaf.
+		void split( uint32_t _node );
+
+		// Internal nodes and leaves with more than one proxy count towards the cost.
+		[[ nodiscard ]] auto get_area( const sNode& _node ) const -> float;
+		void set_bounds( uint32_t _node, const cAABBf& _bounds );
+		auto add_node  ( const sNode& _node ) -> uint32_t;
+		auto add_block () -> uint32_t;
+
+		// Picks the leaf whose bounds grow the least by going down the cheapest child every time.
+		[[ nodiscard ]] auto find_leaf( const cAABBf& _bounds ) const -> uint32_t;
+		// Turns a full leaf into two leaves, one of which gets the proxy.
+		void split_leaf( uint32_t _leaf, proxy_t _proxy );
+		// Replaces the parent of the empty leaf with its sibling.
+		void collapse  ( uint32_t _leaf );
+		// Merges the bounds into the ancestors, stopping at the first one already containing them.
+		void grow_ancestors  ( uint32_t _node, const cAABBf& _bounds );
+		// Recomputes the bounds of the node and every node above it from their children.
+		void refit_ancestors ( uint32_t _node );
+
+		template< class Test, class Fn >
+		void traverse( Test&& _test, Fn& _function ) const;
+
+		std::vector< sProxy >  m_proxies_;
+		std::vector< proxy_t > m_free_proxies_;
+
+		std::vector< sNode >    m_nodes_;
+		// The blocks of proxies owned by the leaves.
+		std::vector< proxy_t >  m_leaf_proxies_;
+		std::vector< uint32_t > m_free_blocks_;
+		std::vector< uint8_t >  m_dirty_nodes_;
+
+		size_t m_size_       = 0;
+		// Nodes no longer reachable after a collapse, they stay until the next rebuild so children keep coming after their parents.
+		size_t m_dead_nodes_ = 0;
+
+		float m_built_cost_        = 0.0f;
+		float m_rebuild_threshold_ = 1.5f;
+		float m_area_sum_          = 0.0f;
+
+		bool m_needs_refit_ = false;
+	};
+
+	template< class Test, class Fn >
+	void cBounding_Volume_Hierarchy::traverse( Test&& _test, Fn& _function ) const
+	{
+		if( m_nodes_.empty() )
+			return;
+
+		uint32_t stack[ kMaxStackDepth ];
+		size_t   stack_size = 0;
+		// Only allocates when the stack is full. The newest nodes are in here, so it's popped from first.
+		std::vector< uint32_t > overflow;
+
+		const auto push = [ & ]( const uint32_t _node )
+		{
+			if( stack_size < kMaxStackDepth )
+				stack[ stack_size++ ] = _node;
+			else
+				overflow.emplace_back( _node );
+		};
+
+		const auto pop = [ & ]
+		{
+			if( overflow.empty() )
+				return stack[ --stack_size ];
+
+			const auto node = overflow.back();
+			overflow.pop_back();
+			return node;
+		};
+
+		push( 0 );
+
+		while( stack_size > 0 )
+		{
+			const auto& node = m_nodes_[ pop() ];
+			if( !_test( node.bounds ) )
+				continue;
+
+			if( node.count == 0 )
+			{
+				push( node.first + 1 );
+				push( node.first );
+				continue;
+			}
+
+			for( uint32_t i = node.first; i < node.first + node.count; i++ )
+			{
+				const auto proxy = m_leaf_proxies_[ i ];
+				if( _test( m_proxies_[ proxy ].bounds ) )
+					_function( proxy );
+			}
+		}
+	}
+
+	template< class Fn >
+	void cBounding_Volume_Hierarchy::QueryAABB( const cAABBf& _bounds, Fn&& _function ) const
+	{
+		traverse( [ & ]( const cAABBf& _node ){ return _node.Intersects( _bounds ); }, _function );
+	}
+
+	template< class Fn >
+	void cBounding_Volume_Hierarchy::QuerySphere( const cVector3f& _center, const float _radius, Fn&& _function ) const
+	{
+		traverse( [ & ]( const cAABBf& _node ){ return _node.Intersects( _center, _radius ); }, _function );
+	}
+
+	template< class Fn >
+	void cBounding_Volume_Hierarchy::QueryFrustum( const cFrustumf& _frustum, Fn&& _function ) const
+	{
+		traverse( [ & ]( const cAABBf& _node ){ return _frustum.Intersects( _node ); }, _function );
+	}
+
+	template< class Fn >
+	void cBounding_Volume_Hierarchy::QueryRay( const cVector3f& _origin, const cVector3f& _direction, const float _max_distance, Fn&& _function ) const
+	{
+		// Zero components turn into infinities, which the slab test handles.
+		const cVector3f inverse_direction = { 1.0f / _direction.x, 1.0f / _direction.y, 1.0f / _direction.z };
+
+		float distance = 0.0f;
+		const auto test = [ & ]( const cAABBf& _node ){ return _node.Intersects( _origin, inverse_direction, _max_distance, distance ); };
+		const auto hit  = [ & ]( const proxy_t _proxy ){ _function( _proxy, distance ); };
+
+		traverse( test, hit );
+	}
+} // sk::
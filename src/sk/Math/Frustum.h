@@ -0,0 +1,98 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include "AABB.h"
+#include "Matrix4x4.h"
+
+namespace sk::Math
+{
+	template< class T >
+	class cFrustum
+	{
+	public:
+		enum ePlane : uint8_t
+		{
+			kLeft,
+			kRight,
+			kBottom,
+			kTop,
+			kNear,
+			kFar,
+			kCount,
+		};
+
+		cFrustum( void ) = default;
+
+		// Extracts the planes from a view projection matrix. The planes will be in the same space as the input of the matrix.
+		explicit cFrustum( const cMatrix4x4< T >& _view_proj )
+		{
+			const auto column = [ & ]( const size_t _c ){ return cVector4< T >{ _view_proj.x[ _c ], _view_proj.y[ _c ], _view_proj.z[ _c ], _view_proj.w[ _c ] }; };
+
+			const auto x = column( 0 );
+			const auto y = column( 1 );
+			const auto z = column( 2 );
+			const auto w = column( 3 );
+
+			m_planes_[ kLeft   ] = w + x;
+			m_planes_[ kRight  ] = w - x;
+			m_planes_[ kBottom ] = w + y;
+			m_planes_[ kTop    ] = w - y;
+			// Uses the -w to w depth range as it's the more forgiving of the two.
+			m_planes_[ kNear   ] = w + z;
+			m_planes_[ kFar    ] = w - z;
+
+			for( auto& plane : m_planes_ )
+			{
+				const auto length = Math::sqrt( plane.x * plane.x + plane.y * plane.y + plane.z * plane.z );
+				plane = plane * ( length > T( 0 ) ? T( 1 ) / length : T( 0 ) );
+			}
+		}
+
+		// The planes normals are facing inwards, w is the distance.
+		[[ nodiscard ]] auto& GetPlanes( void ) const { return m_planes_; }
+		[[ nodiscard ]] auto& GetPlane ( const ePlane _plane ) const { return m_planes_[ _plane ]; }
+
+		// Returns false if the sphere is fully outside of the frustum.
+		[[ nodiscard ]] bool Intersects( const cVector3< T >& _center, const T _radius ) const
+		{
+			for( auto& plane : m_planes_ )
+			{
+				if( plane.x * _center.x + plane.y * _center.y + plane.z * _center.z + plane.w < -_radius )
+					return false;
+			}
+
+			return true;
+		}
+
+		// Returns false if the box is fully outside of the frustum.
+		// Conservative, a box outside of the frustum near one of its corners might still pass.
+		[[ nodiscard ]] bool Intersects( const cAABB< T >& _aabb ) const
+		{
+			const auto center  = _aabb.GetCenter();
+			const auto extents = _aabb.GetExtents();
+
+			for( auto& plane : m_planes_ )
+			{
+				const auto distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+				const auto radius   = Math::abs( plane.x ) * extents.x + Math::abs( plane.y ) * extents.y + Math::abs( plane.z ) * extents.z;
+				if( distance < -radius )
+					return false;
+			}
+
+			return true;
+		}
+
+	private:
+		cVector4< T > m_planes_[ kCount ];
+	};
+} // sk::Math::
+
+namespace sk
+{
+	using cFrustumf = Math::cFrustum< float >;
+} // sk::
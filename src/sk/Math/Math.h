@@ -184,7 +184,7 @@ namespace sk
 		T acos( const T _val )
 		{
 			typedef nearest_float_t< T > type;
-			return static_cast< T >( std::cos( type( _val ) ) );
+			return static_cast< T >( std::acos( type( _val ) ) );
 		}
 
 		template< class T >
@@ -192,7 +192,7 @@ namespace sk
 		T asin( const T _val )
 		{
 			typedef nearest_float_t< T > type;
-			return static_cast< T >( std::sin( type( _val ) ) );
+			return static_cast< T >( std::asin( type( _val ) ) );
 		}
 
 		template< class T >
@@ -200,7 +200,7 @@ namespace sk
 		T atan( const T _val )
 		{
 			typedef nearest_float_t< T > type;
-			return static_cast< T >( std::tan( type( _val ) ) );
+			return static_cast< T >( std::atan( type( _val ) ) );
 		}
 
 		template< class T >
@@ -8,11 +8,11 @@
 
 #include "Matrix.h"
 
+#include "Simd.h"
 #include "Vector3.h"
 #include "Vector4.h"
 
 #include <cstdio>
-#include <xmmintrin.h>
 
 namespace sk
 {
@@ -24,6 +24,14 @@ namespace sk
 	using cMatrix4x4f = Math::cMatrix4x4< float >;
 	using cMatrix4x4d = Math::cMatrix4x4< double >;
 } // sk
+namespace sk::Math::Matrix4x4
+{
+	// SIMD implementations used by the float matrices, _out is allowed to alias the input.
+	inline void multiply_fast       ( const cMatrix4x4< float >& _a, const cMatrix4x4< float >& _b, cMatrix4x4< float >& _out );
+	inline void inversed_affine_fast( const cMatrix4x4< float >& _in, cMatrix4x4< float >& _out );
+	// Inverts up to 4 contiguous affine matrices at once, one matrix per lane.
+	inline void inversed_affine_x4  ( const cMatrix4x4< float >* _in, cMatrix4x4< float >* _out, size_t _count );
+} // sk::Math::Matrix4x4
 namespace sk::Math
 {
 	template <typename T>
@@ -55,7 +63,19 @@ namespace sk::Math
 
 		constexpr cMatrix operator+(const cMatrix& _m) const { return { _m.x + x, _m.y + y, _m.z + z, _m.w + w }; }
 		constexpr cMatrix operator-(const cMatrix& _m) const { return { _m.x - x, _m.y - y, _m.z - z, _m.w - w }; }
-		constexpr cMatrix operator*(const cMatrix& _m) const { return { (_m.x * x.x) + (_m.y * x.y) + (_m.z * x.z) + (_m.w * x.w), (_m.x * y.x) + (_m.y * y.y) + (_m.z * y.z) + (_m.w * y.w), (_m.x * z.x) + (_m.y * z.y) + (_m.z * z.z) + (_m.w * z.w), (_m.x * w.x) + (_m.y * w.y) + (_m.z * w.z) + (_m.w * w.w) }; }
+		constexpr cMatrix operator*(const cMatrix& _m) const
+		{
+			if constexpr( std::is_same_v< T, float > )
+			{
+				if !consteval
+				{
+					cMatrix result;
+					Matrix4x4::multiply_fast( *this, _m, result );
+					return result;
+				}
+			}
+			return { (_m.x * x.x) + (_m.y * x.y) + (_m.z * x.z) + (_m.w * x.w), (_m.x * y.x) + (_m.y * y.y) + (_m.z * y.z) + (_m.w * y.w), (_m.x * z.x) + (_m.y * z.y) + (_m.z * z.z) + (_m.w * z.w), (_m.x * w.x) + (_m.y * w.y) + (_m.z * w.z) + (_m.w * w.w) };
+		}
 
 		constexpr cMatrix& operator= ( const cMatrix&  _m )          = default;
 		constexpr cMatrix& operator= (       cMatrix&& _m ) noexcept = default;
@@ -65,7 +85,7 @@ namespace sk::Math
 
 		constexpr cMatrix& operator+=(const cMatrix& _m){ x += _m.x; y += _m.y; z += _m.z; w += _m.w; return *this; }
 		constexpr cMatrix& operator-=(const cMatrix& _m){ x -= _m.x; y -= _m.y; z -= _m.z; w -= _m.w; return *this; }
-		constexpr cMatrix& operator*=(const cMatrix& _m){ x = (_m.x * x.x) + (_m.y * x.y) + (_m.z * x.z) + (_m.w * x.w); y = (_m.x * y.x) + (_m.y * y.y) + (_m.z * y.z) + (_m.w * y.w); z = (_m.x * z.x) + (_m.y * z.y) + (_m.z * z.z) + (_m.w * z.w); w = (_m.x * w.x) + (_m.y * w.y) + (_m.z * w.z) + (_m.w * w.w); return *this; }
+		constexpr cMatrix& operator*=(const cMatrix& _m){ return *this = *this * _m; }
 
 		constexpr auto& transpose( void ) const
 		{
@@ -110,18 +130,15 @@ namespace sk::Math
 
 		static void transposed_fast( const cMatrix& _in, cMatrix& _out )
 		{
-			const auto in  = reinterpret_cast< float* >( &_in );
-			const auto out = reinterpret_cast< float* >( &_out );
-
-			__m128 row0 = _mm_load_ps( in );
-			__m128 row1 = _mm_load_ps( in + 1 );
-			__m128 row2 = _mm_load_ps( in + 2 );
-			__m128 row3 = _mm_load_ps( in + 3 );
-			_MM_TRANSPOSE4_PS( row0, row1, row2, row3 );
-			_mm_store_ps( out,     row0 );
-			_mm_store_ps( out + 1, row1 );
-			_mm_store_ps( out + 2, row2 );
-			_mm_store_ps( out + 3, row3 );
+			auto row0 = Simd::Load( _in.x );
+			auto row1 = Simd::Load( _in.y );
+			auto row2 = Simd::Load( _in.z );
+			auto row3 = Simd::Load( _in.w );
+			Simd::Transpose( row0, row1, row2, row3 );
+			Simd::Store( _out.x, row0 );
+			Simd::Store( _out.y, row1 );
+			Simd::Store( _out.z, row2 );
+			Simd::Store( _out.w, row3 );
 		} // transpose
 		
 		
@@ -187,6 +204,45 @@ namespace sk::Math
 			return out;
 		} // inversed
 
+		// Only valid for matrices where the last column is 0, 0, 0, 1. Like any combination of scale, rotation and translation.
+		// Considerably cheaper than a full inverse.
+		constexpr void inversed_affine( cMatrix& _out ) const
+		{
+			if constexpr( std::is_same_v< T, float > )
+			{
+				if !consteval
+				{
+					Matrix4x4::inversed_affine_fast( *this, _out );
+					return;
+				}
+			}
+
+			// The rows of the inverse are the columns made from the cross products of the rows, divided by the determinant.
+			const cVector3< T > r0 = x, r1 = y, r2 = z;
+			const auto c0 = Vector3::Cross( r1, r2 );
+			const auto c1 = Vector3::Cross( r2, r0 );
+			const auto c2 = Vector3::Cross( r0, r1 );
+			const auto inv_det = T( 1 ) / Vector3::Dot( r0, c0 );
+
+			const cVector4< T > i0{ c0.x * inv_det, c1.x * inv_det, c2.x * inv_det, T( 0 ) };
+			const cVector4< T > i1{ c0.y * inv_det, c1.y * inv_det, c2.y * inv_det, T( 0 ) };
+			const cVector4< T > i2{ c0.z * inv_det, c1.z * inv_det, c2.z * inv_det, T( 0 ) };
+			const cVector4< T > i3{
+				-( w.x * i0.x + w.y * i1.x + w.z * i2.x ),
+				-( w.x * i0.y + w.y * i1.y + w.z * i2.y ),
+				-( w.x * i0.z + w.y * i1.z + w.z * i2.z ),
+				T( 1 ) };
+
+			_out = cMatrix{ i0, i1, i2, i3 };
+		} // inversed_affine
+
+		constexpr auto inversed_affine() const
+		{
+			cMatrix out;
+			inversed_affine( out );
+			return out;
+		} // inversed_affine
+
 		auto& inverse_fast( void )
 		{
 			if constexpr( std::is_same_v< T, float > )
@@ -227,6 +283,9 @@ namespace sk::Math
 		static void inversed_fast( const cMatrix< 4, 4, float >& _in, cMatrix< 4, 4, float >& _out )
 		{
 			// TODO: Fix the math. Turns out the inversed fast doesn't fully work.
+#if !defined( SK_SIMD_SSE )
+			_out = _in.inversed();
+#else
 			const auto as_m  = reinterpret_cast< const __m64* >( &_in );
 			__m64*     out_m = reinterpret_cast<       __m64* >( &_out );
 
@@ -344,9 +403,122 @@ namespace sk::Math
 			minor3 = _mm_mul_ps( det, minor3 );
 			_mm_storel_pi( out_m + 6, minor3 );
 			_mm_storeh_pi( out_m + 7, minor3 );
+#endif
 		} // inverse_fast
 	};
 
+	namespace Matrix4x4
+	{
+		inline void multiply_fast( const cMatrix4x4< float >& _a, const cMatrix4x4< float >& _b, cMatrix4x4< float >& _out )
+		{
+			const auto b0 = Simd::Load( _b.x );
+			const auto b1 = Simd::Load( _b.y );
+			const auto b2 = Simd::Load( _b.z );
+			const auto b3 = Simd::Load( _b.w );
+
+			Simd::sFloat4 rows[ 4 ];
+			for( size_t r = 0; r < 4; r++ )
+			{
+				const auto a = Simd::Load( _a[ r ] );
+				auto row = Simd::Mul( Simd::Broadcast< 0 >( a ), b0 );
+				row = Simd::MulAdd( Simd::Broadcast< 1 >( a ), b1, row );
+				row = Simd::MulAdd( Simd::Broadcast< 2 >( a ), b2, row );
+				rows[ r ] = Simd::MulAdd( Simd::Broadcast< 3 >( a ), b3, row );
+			}
+
+			for( size_t r = 0; r < 4; r++ )
+				Simd::Store( _out[ r ], rows[ r ] );
+		} // multiply_fast
+
+		inline void inversed_affine_fast( const cMatrix4x4< float >& _in, cMatrix4x4< float >& _out )
+		{
+			const auto r0 = Simd::Load( _in.x );
+			const auto r1 = Simd::Load( _in.y );
+			const auto r2 = Simd::Load( _in.z );
+			const auto t  = Simd::Load( _in.w );
+
+			auto c0 = Simd::Cross3( r1, r2 );
+			auto c1 = Simd::Cross3( r2, r0 );
+			auto c2 = Simd::Cross3( r0, r1 );
+			auto c3 = Simd::Zero();
+
+			const auto inv_det = Simd::Div( Simd::Splat( 1.0f ), Simd::Dot3( r0, c0 ) );
+
+			// Turns the cross products into the rows of the inverse.
+			Simd::Transpose( c0, c1, c2, c3 );
+			c0 = Simd::Mul( c0, inv_det );
+			c1 = Simd::Mul( c1, inv_det );
+			c2 = Simd::Mul( c2, inv_det );
+
+			auto translation = Simd::Mul( Simd::Broadcast< 0 >( t ), c0 );
+			translation = Simd::MulAdd( Simd::Broadcast< 1 >( t ), c1, translation );
+			translation = Simd::MulAdd( Simd::Broadcast< 2 >( t ), c2, translation );
+			translation = Simd::Sub( Simd::Set( 0.0f, 0.0f, 0.0f, 1.0f ), translation );
+
+			Simd::Store( _out.x, c0 );
+			Simd::Store( _out.y, c1 );
+			Simd::Store( _out.z, c2 );
+			Simd::Store( _out.w, translation );
+		} // inversed_affine_fast
+
+		inline void inversed_affine_x4( const cMatrix4x4< float >* _in, cMatrix4x4< float >* _out, const size_t _count )
+		{
+			using namespace Simd;
+
+			// Missing lanes are filled with identities so the determinant never hits zero.
+			const cMatrix4x4< float > identity = {};
+			const auto get = [ & ]( const size_t _lane ) -> auto& { return _lane < _count ? _in[ _lane ] : identity; };
+
+			// One register per element, with one matrix in each lane.
+			sFloat4 m[ 4 ][ 4 ];
+			for( size_t r = 0; r < 4; r++ )
+			{
+				m[ r ][ 0 ] = Load( get( 0 )[ r ] );
+				m[ r ][ 1 ] = Load( get( 1 )[ r ] );
+				m[ r ][ 2 ] = Load( get( 2 )[ r ] );
+				m[ r ][ 3 ] = Load( get( 3 )[ r ] );
+				Transpose( m[ r ][ 0 ], m[ r ][ 1 ], m[ r ][ 2 ], m[ r ][ 3 ] );
+			}
+
+			const auto cross = [ & ]( const size_t _a, const size_t _b, sFloat4 ( &_result )[ 3 ] )
+			{
+				_result[ 0 ] = m[ _a ][ 1 ] * m[ _b ][ 2 ] - m[ _a ][ 2 ] * m[ _b ][ 1 ];
+				_result[ 1 ] = m[ _a ][ 2 ] * m[ _b ][ 0 ] - m[ _a ][ 0 ] * m[ _b ][ 2 ];
+				_result[ 2 ] = m[ _a ][ 0 ] * m[ _b ][ 1 ] - m[ _a ][ 1 ] * m[ _b ][ 0 ];
+			};
+
+			sFloat4 c0[ 3 ], c1[ 3 ], c2[ 3 ];
+			cross( 1, 2, c0 );
+			cross( 2, 0, c1 );
+			cross( 0, 1, c2 );
+
+			const auto det     = m[ 0 ][ 0 ] * c0[ 0 ] + m[ 0 ][ 1 ] * c0[ 1 ] + m[ 0 ][ 2 ] * c0[ 2 ];
+			const auto inv_det = Splat( 1.0f ) / det;
+
+			// Row i of the inverse is ( c0[ i ], c1[ i ], c2[ i ] ) / det.
+			sFloat4 inv[ 4 ][ 4 ];
+			for( size_t i = 0; i < 3; i++ )
+			{
+				inv[ i ][ 0 ] = c0[ i ] * inv_det;
+				inv[ i ][ 1 ] = c1[ i ] * inv_det;
+				inv[ i ][ 2 ] = c2[ i ] * inv_det;
+				inv[ i ][ 3 ] = Zero();
+			}
+
+			for( size_t c = 0; c < 3; c++ )
+				inv[ 3 ][ c ] = Zero() - ( m[ 3 ][ 0 ] * inv[ 0 ][ c ] + m[ 3 ][ 1 ] * inv[ 1 ][ c ] + m[ 3 ][ 2 ] * inv[ 2 ][ c ] );
+			inv[ 3 ][ 3 ] = Splat( 1.0f );
+
+			// Back to one matrix per lane.
+			for( size_t r = 0; r < 4; r++ )
+			{
+				Transpose( inv[ r ][ 0 ], inv[ r ][ 1 ], inv[ r ][ 2 ], inv[ r ][ 3 ] );
+				for( size_t lane = 0; lane < _count; lane++ )
+					Store( _out[ lane ][ r ], inv[ r ][ lane ] );
+			}
+		} // inversed_affine_x4
+	} // Matrix4x4
+
 	namespace Matrix4x4
 	{
 		template <typename T> constexpr cMatrix4x4<T> rotateX(const float& _a)
@@ -0,0 +1,294 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include "Math.h"
+#include "Matrix4x4.h"
+#include "Simd.h"
+#include "Vector3.h"
+#include "Vector4.h"
+
+#include <cmath>
+
+namespace sk
+{
+	namespace Math
+	{
+		template< class T >
+		class cQuaternion;
+	} // Math
+
+	using cQuaternionf = Math::cQuaternion< float >;
+	using cQuaterniond = Math::cQuaternion< double >;
+} // sk
+
+namespace sk::Math
+{
+	// Rotations are composed the same way as the matrices: a * b applies a first, then b.
+	// The rotation matrix matches Matrix4x4::scale_rotate_translate with the same euler angles.
+	template< class T >
+	class cQuaternion
+	{
+	public:
+		T x = T( 0 );
+		T y = T( 0 );
+		T z = T( 0 );
+		T w = T( 1 );
+
+		constexpr cQuaternion() = default;
+		constexpr cQuaternion( const T _x, const T _y, const T _z, const T _w ) : x( _x ), y( _y ), z( _z ), w( _w ) {}
+
+		// Euler angles in radians, same order as Matrix4x4::scale_rotate_translate.
+		static auto FromEuler( const cVector3< T >& _euler ) -> cQuaternion;
+		// The axis has to be normalized.
+		static auto FromAxisAngle( const cVector3< T >& _axis, T _angle ) -> cQuaternion;
+		// The rows have to be orthonormal.
+		static auto FromBasis( const cVector3< T >& _right, const cVector3< T >& _up, const cVector3< T >& _front ) -> cQuaternion;
+		// Rotation with the front facing _forward, the up will be kept as close to _up as possible.
+		static auto LookRotation( const cVector3< T >& _forward, const cVector3< T >& _up = cVector3< T >( kUp ) ) -> cQuaternion;
+
+		// Euler angles in radians.
+		[[ nodiscard ]] auto ToEuler () const -> cVector3< T >;
+		[[ nodiscard ]] auto ToMatrix() const -> cMatrix4x4< T >;
+
+		[[ nodiscard ]] constexpr auto Dot( const cQuaternion& _other ) const { return x * _other.x + y * _other.y + z * _other.z + w * _other.w; }
+		[[ nodiscard ]] auto Length() const { return Math::sqrt( Dot( *this ) ); }
+
+		[[ nodiscard ]] constexpr auto Conjugate() const { return cQuaternion( -x, -y, -z, w ); }
+		// Same as the conjugate for normalized quaternions.
+		[[ nodiscard ]] constexpr auto Inverse  () const { return Conjugate() * ( T( 1 ) / Dot( *this ) ); }
+
+		auto Normalize() -> cQuaternion&;
+		[[ nodiscard ]] auto Normalized() const { return cQuaternion( *this ).Normalize(); }
+
+		// Rotates a vector the same way the rotation matrix would.
+		[[ nodiscard ]] auto Rotate( const cVector3< T >& _vector ) const -> cVector3< T >;
+
+		auto operator*( const cQuaternion& _other ) const -> cQuaternion;
+		auto operator*=( const cQuaternion& _other ) -> cQuaternion& { return *this = *this * _other; }
+
+		constexpr auto operator*( const T _scalar ) const { return cQuaternion( x * _scalar, y * _scalar, z * _scalar, w * _scalar ); }
+		constexpr auto operator+( const cQuaternion& _other ) const { return cQuaternion( x + _other.x, y + _other.y, z + _other.z, w + _other.w ); }
+		constexpr auto operator-() const { return cQuaternion( -x, -y, -z, -w ); }
+
+		constexpr bool operator==( const cQuaternion& _other ) const = default;
+	};
+
+	namespace Quaternion
+	{
+		// Normalized linear interpolation, cheap but the angular speed isn't constant.
+		template< class T >
+		auto Nlerp( const cQuaternion< T >& _from, const cQuaternion< T >& _to, T _t ) -> cQuaternion< T >;
+		// Spherical linear interpolation, always takes the shortest path.
+		template< class T >
+		auto Slerp( const cQuaternion< T >& _from, const cQuaternion< T >& _to, T _t ) -> cQuaternion< T >;
+	} // Quaternion
+
+	template< class T >
+	auto cQuaternion< T >::FromEuler( const cVector3< T >& _euler ) -> cQuaternion
+	{
+		const auto hx = _euler.x * T( 0.5 );
+		const auto hy = _euler.y * T( 0.5 );
+		const auto hz = _euler.z * T( 0.5 );
+
+		const auto sx = Math::sin( hx ), cx = Math::cos( hx );
+		const auto sy = Math::sin( hy ), cy = Math::cos( hy );
+		const auto sz = Math::sin( hz ), cz = Math::cos( hz );
+
+		// X * Y * Z expanded.
+		return cQuaternion(
+			sx * cy * cz + cx * sy * sz,
+			cx * sy * cz - sx * cy * sz,
+			cx * cy * sz + sx * sy * cz,
+			cx * cy * cz - sx * sy * sz );
+	}
+
+	template< class T >
+	auto cQuaternion< T >::FromAxisAngle( const cVector3< T >& _axis, const T _angle ) -> cQuaternion
+	{
+		const auto s = Math::sin( _angle * T( 0.5 ) );
+		return cQuaternion( _axis.x * s, _axis.y * s, _axis.z * s, Math::cos( _angle * T( 0.5 ) ) );
+	}
+
+	template< class T >
+	auto cQuaternion< T >::FromBasis( const cVector3< T >& _right, const cVector3< T >& _up, const cVector3< T >& _front ) -> cQuaternion
+	{
+		// Source: https://www.euclideanspace.com/maths/geometry/rotations/conversions/matrixToQuaternion/
+		// The rows are used as is, as the matrix layout matches ToMatrix.
+		const auto m00 = _right.x, m01 = _right.y, m02 = _right.z;
+		const auto m10 = _up.x,    m11 = _up.y,    m12 = _up.z;
+		const auto m20 = _front.x, m21 = _front.y, m22 = _front.z;
+
+		cQuaternion result;
+		if( const auto trace = m00 + m11 + m22; trace > T( 0 ) )
+		{
+			const auto s = Math::sqrt( trace + T( 1 ) ) * T( 2 );
+			result = { ( m21 - m12 ) / s, ( m02 - m20 ) / s, ( m10 - m01 ) / s, s * T( 0.25 ) };
+		}
+		else if( m00 > m11 && m00 > m22 )
+		{
+			const auto s = Math::sqrt( T( 1 ) + m00 - m11 - m22 ) * T( 2 );
+			result = { s * T( 0.25 ), ( m01 + m10 ) / s, ( m02 + m20 ) / s, ( m21 - m12 ) / s };
+		}
+		else if( m11 > m22 )
+		{
+			const auto s = Math::sqrt( T( 1 ) + m11 - m00 - m22 ) * T( 2 );
+			result = { ( m01 + m10 ) / s, s * T( 0.25 ), ( m12 + m21 ) / s, ( m02 - m20 ) / s };
+		}
+		else
+		{
+			const auto s = Math::sqrt( T( 1 ) + m22 - m00 - m11 ) * T( 2 );
+			result = { ( m02 + m20 ) / s, ( m12 + m21 ) / s, s * T( 0.25 ), ( m10 - m01 ) / s };
+		}
+
+		return result.Normalize();
+	}
+
+	template< class T >
+	auto cQuaternion< T >::LookRotation( const cVector3< T >& _forward, const cVector3< T >& _up ) -> cQuaternion
+	{
+		auto front = cVector3< T >( _forward ).normalized();
+		auto right = Vector3::Cross( _up, front );
+
+		// Forward and up are parallel, so any right will do.
+		if( right.dot() < T( 1e-12 ) )
+			right = Vector3::Cross( Math::abs( front.x ) < T( 0.9 ) ? cVector3< T >( kRight ) : cVector3< T >( kUp ), front );
+
+		right.normalize();
+		const auto up = Vector3::Cross( front, right );
+
+		return FromBasis( right, up, front );
+	}
+
+	template< class T >
+	auto cQuaternion< T >::ToEuler() const -> cVector3< T >
+	{
+		const auto m = ToMatrix();
+
+		// Clamped as precision errors might push it slightly outside of asins range.
+		const auto sy = std::clamp( m.x.z, T( -1 ), T( 1 ) );
+		const auto ry = static_cast< T >( std::asin( sy ) );
+
+		// Gimbal lock, the x and z rotations share the same axis so everything is put into x.
+		if( Math::abs( sy ) > T( 0.9999 ) )
+			return { static_cast< T >( std::atan2( m.z.y, m.y.y ) ), ry, T( 0 ) };
+
+		return {
+			static_cast< T >( std::atan2( -m.y.z, m.z.z ) ),
+			ry,
+			static_cast< T >( std::atan2( -m.x.y, m.x.x ) ),
+		};
+	}
+
+	template< class T >
+	auto cQuaternion< T >::ToMatrix() const -> cMatrix4x4< T >
+	{
+		const auto xx = x * x, yy = y * y, zz = z * z;
+		const auto xy = x * y, xz = x * z, yz = y * z;
+		const auto wx = w * x, wy = w * y, wz = w * z;
+
+		return cMatrix4x4< T >(
+			cVector3< T >{ T( 1 ) - T( 2 ) * ( yy + zz ), T( 2 ) * ( xy - wz ), T( 2 ) * ( xz + wy ) },
+			cVector3< T >{ T( 2 ) * ( xy + wz ), T( 1 ) - T( 2 ) * ( xx + zz ), T( 2 ) * ( yz - wx ) },
+			cVector3< T >{ T( 2 ) * ( xz - wy ), T( 2 ) * ( yz + wx ), T( 1 ) - T( 2 ) * ( xx + yy ) },
+			cVector3< T >{ T( 0 ), T( 0 ), T( 0 ) } );
+	}
+
+	template< class T >
+	auto cQuaternion< T >::Normalize() -> cQuaternion&
+	{
+		const auto length = Length();
+		if( length <= T( 0 ) )
+			return *this = cQuaternion{};
+
+		const auto inverse = T( 1 ) / length;
+		x *= inverse; y *= inverse; z *= inverse; w *= inverse;
+		return *this;
+	}
+
+	template< class T >
+	auto cQuaternion< T >::Rotate( const cVector3< T >& _vector ) const -> cVector3< T >
+	{
+		// Row vector convention means rotating by the conjugate.
+		const cVector3< T > u{ -x, -y, -z };
+		const auto t = Vector3::Cross( u, _vector ) * T( 2 );
+		return _vector + t * w + Vector3::Cross( u, t );
+	}
+
+	template< class T >
+	auto cQuaternion< T >::operator*( const cQuaternion& _other ) const -> cQuaternion
+	{
+#if !defined( SK_SIMD_SCALAR )
+		if constexpr( std::is_same_v< T, float > )
+		{
+			using namespace Simd;
+			const auto b = Load( &_other.x );
+
+			// Every term of the hamilton product is a component of this times a shuffled and sign flipped other.
+			const auto wb = Splat( w ) * b;
+			const auto xb = Splat( x ) * Shuffle< 3, 2, 1, 0 >( b ) * Set(  1.0f, -1.0f,  1.0f, -1.0f );
+			const auto yb = Splat( y ) * Shuffle< 2, 3, 0, 1 >( b ) * Set(  1.0f,  1.0f, -1.0f, -1.0f );
+			const auto zb = Splat( z ) * Shuffle< 1, 0, 3, 2 >( b ) * Set( -1.0f,  1.0f,  1.0f, -1.0f );
+
+			cQuaternion result;
+			Store( &result.x, ( wb + xb ) + ( yb + zb ) );
+			return result;
+		}
+		else
+#endif
+		return cQuaternion(
+			w * _other.x + x * _other.w + y * _other.z - z * _other.y,
+			w * _other.y - x * _other.z + y * _other.w + z * _other.x,
+			w * _other.z + x * _other.y - y * _other.x + z * _other.w,
+			w * _other.w - x * _other.x - y * _other.y - z * _other.z );
+	}
+
+	template< class T >
+	auto Quaternion::Nlerp( const cQuaternion< T >& _from, const cQuaternion< T >& _to, const T _t ) -> cQuaternion< T >
+	{
+		const auto to = _from.Dot( _to ) < T( 0 ) ? -_to : _to;
+		return ( _from * ( T( 1 ) - _t ) + to * _t ).Normalize();
+	}
+
+	template< class T >
+	auto Quaternion::Slerp( const cQuaternion< T >& _from, const cQuaternion< T >& _to, const T _t ) -> cQuaternion< T >
+	{
+		auto cos_theta = _from.Dot( _to );
+		auto to        = _to;
+		if( cos_theta < T( 0 ) )
+		{
+			cos_theta = -cos_theta;
+			to        = -to;
+		}
+
+		// Too close for the sine to be stable.
+		if( cos_theta > T( 0.9995 ) )
+			return Nlerp( _from, to, _t );
+
+		const auto theta     = Math::acos( cos_theta );
+		const auto sin_theta = Math::sin( theta );
+
+		const auto from_weight = Math::sin( ( T( 1 ) - _t ) * theta ) / sin_theta;
+		const auto to_weight   = Math::sin( _t * theta ) / sin_theta;
+
+		return _from * from_weight + to * to_weight;
+	}
+
+	namespace Matrix4x4
+	{
+		template< class T >
+		auto scale_rotate_translate( const cVector3< T >& _scale, const cQuaternion< T >& _rotation, const cVector3< T >& _location ) -> cMatrix4x4< T >
+		{
+			auto result = _rotation.ToMatrix();
+			result.x = result.x * _scale.x;
+			result.y = result.y * _scale.y;
+			result.z = result.z * _scale.z;
+			result.w  = cVector4< T >( _location, T( 1 ) );
+			return result;
+		}
+	} // Matrix4x4
+} // sk::Math::
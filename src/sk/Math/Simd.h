@@ -0,0 +1,296 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include "Vector3.h"
+#include "Vector4.h"
+
+// The backend is picked at compile time from what the target supports.
+// Every backend works on 128 bit registers, wider AVX registers aren't used. FMA is a separate extension from AVX2,
+// so it's detected on its own.
+// Define SK_SIMD_FORCE_SCALAR to use the scalar fallback everywhere, useful when comparing results.
+#if defined( SK_SIMD_FORCE_SCALAR )
+#define SK_SIMD_SCALAR 1
+#elif defined( __SSE4_1__ ) || defined( __AVX__ )
+#define SK_SIMD_SSE4 1
+#define SK_SIMD_SSE  1
+#elif defined( __SSE__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 1 )
+#define SK_SIMD_SSE 1
+#elif defined( __ARM_NEON ) || defined( _M_ARM64 )
+#define SK_SIMD_NEON 1
+#else
+#define SK_SIMD_SCALAR 1
+#endif
+
+#if defined( SK_SIMD_SSE ) && defined( __FMA__ )
+#define SK_SIMD_FMA 1
+#endif
+
+#if defined( SK_SIMD_FMA )
+#include <immintrin.h>
+#elif defined( SK_SIMD_SSE4 )
+#include <smmintrin.h>
+#elif defined( SK_SIMD_SSE )
+#include <xmmintrin.h>
+#elif defined( SK_SIMD_NEON )
+#include <arm_neon.h>
+#endif
+
+namespace sk::Math::Simd
+{
+#if defined( SK_SIMD_SSE4 ) && defined( SK_SIMD_FMA )
+	constexpr auto kBackend = "SSE4 + FMA";
+#elif defined( SK_SIMD_SSE4 )
+	constexpr auto kBackend = "SSE4";
+#elif defined( SK_SIMD_SSE ) && defined( SK_SIMD_FMA )
+	constexpr auto kBackend = "SSE + FMA";
+#elif defined( SK_SIMD_SSE )
+	constexpr auto kBackend = "SSE";
+#elif defined( SK_SIMD_NEON )
+	constexpr auto kBackend = "NEON";
+#else
+	constexpr auto kBackend = "Scalar";
+#endif
+
+	// Four floats in a register, or an array when there's no SIMD support.
+	struct sFloat4
+	{
+#if defined( SK_SIMD_SSE )
+		__m128 v;
+#elif defined( SK_SIMD_NEON )
+		float32x4_t v;
+#else
+		float v[ 4 ];
+#endif
+	};
+
+	// None of the loads or stores require any alignment.
+	[[ nodiscard ]] inline auto Load( const float* _values ) -> sFloat4
+	{
+#if defined( SK_SIMD_SSE )
+		return { _mm_loadu_ps( _values ) };
+#elif defined( SK_SIMD_NEON )
+		return { vld1q_f32( _values ) };
+#else
+		return { { _values[ 0 ], _values[ 1 ], _values[ 2 ], _values[ 3 ] } };
+#endif
+	}
+
+	inline void Store( float* _out, const sFloat4 _value )
+	{
+#if defined( SK_SIMD_SSE )
+		_mm_storeu_ps( _out, _value.v );
+#elif defined( SK_SIMD_NEON )
+		vst1q_f32( _out, _value.v );
+#else
+		for( int i = 0; i < 4; i++ )
+			_out[ i ] = _value.v[ i ];
+#endif
+	}
+
+	[[ nodiscard ]] inline auto Load ( const cVector4< float >& _vector ) -> sFloat4 { return Load( &_vector.x ); }
+	inline void                 Store( cVector4< float >& _out, const sFloat4 _value ){ Store( &_out.x, _value ); }
+
+	[[ nodiscard ]] inline auto Set( const float _x, const float _y, const float _z, const float _w ) -> sFloat4
+	{
+#if defined( SK_SIMD_SSE )
+		return { _mm_setr_ps( _x, _y, _z, _w ) };
+#else
+		const float values[ 4 ] = { _x, _y, _z, _w };
+		return Load( values );
+#endif
+	}
+
+	[[ nodiscard ]] inline auto Splat( const float _value ) -> sFloat4
+	{
+#if defined( SK_SIMD_SSE )
+		return { _mm_set1_ps( _value ) };
+#elif defined( SK_SIMD_NEON )
+		return { vdupq_n_f32( _value ) };
+#else
+		return { { _value, _value, _value, _value } };
+#endif
+	}
+
+	[[ nodiscard ]] inline auto Zero() -> sFloat4 { return Splat( 0.0f ); }
+
+	[[ nodiscard ]] inline auto GetX( const sFloat4 _value ) -> float
+	{
+#if defined( SK_SIMD_SSE )
+		return _mm_cvtss_f32( _value.v );
+#elif defined( SK_SIMD_NEON )
+		return vgetq_lane_f32( _value.v, 0 );
+#else
+		return _value.v[ 0 ];
+#endif
+	}
+
+#if defined( SK_SIMD_SSE )
+#define SK_SIMD_BINARY( Name, Sse, Neon, Op ) \
+	[[ nodiscard ]] inline auto Name( const sFloat4 _a, const sFloat4 _b ) -> sFloat4 { return { Sse( _a.v, _b.v ) }; }
+#elif defined( SK_SIMD_NEON )
+#define SK_SIMD_BINARY( Name, Sse, Neon, Op ) \
+	[[ nodiscard ]] inline auto Name( const sFloat4 _a, const sFloat4 _b ) -> sFloat4 { return { Neon( _a.v, _b.v ) }; }
+#else
+#define SK_SIMD_BINARY( Name, Sse, Neon, Op ) \
+	[[ nodiscard ]] inline auto Name( const sFloat4 _a, const sFloat4 _b ) -> sFloat4 \
+	{ \
+		sFloat4 result; \
+		for( int i = 0; i < 4; i++ ) \
+			result.v[ i ] = Op( _a.v[ i ], _b.v[ i ] ); \
+		return result; \
+	}
+#endif
+
+	namespace Scalar
+	{
+		constexpr float add( const float _a, const float _b ){ return _a + _b; }
+		constexpr float sub( const float _a, const float _b ){ return _a - _b; }
+		constexpr float mul( const float _a, const float _b ){ return _a * _b; }
+		constexpr float div( const float _a, const float _b ){ return _a / _b; }
+		constexpr float min( const float _a, const float _b ){ return _a < _b ? _a : _b; }
+		constexpr float max( const float _a, const float _b ){ return _a > _b ? _a : _b; }
+	} // Scalar
+
+	SK_SIMD_BINARY( Add, _mm_add_ps, vaddq_f32, Scalar::add )
+	SK_SIMD_BINARY( Sub, _mm_sub_ps, vsubq_f32, Scalar::sub )
+	SK_SIMD_BINARY( Mul, _mm_mul_ps, vmulq_f32, Scalar::mul )
+	SK_SIMD_BINARY( Div, _mm_div_ps, vdivq_f32, Scalar::div )
+	SK_SIMD_BINARY( Min, _mm_min_ps, vminq_f32, Scalar::min )
+	SK_SIMD_BINARY( Max, _mm_max_ps, vmaxq_f32, Scalar::max )
+
+#undef SK_SIMD_BINARY
+
+	// _a * _b + _c, fused where the hardware supports it.
+	[[ nodiscard ]] inline auto MulAdd( const sFloat4 _a, const sFloat4 _b, const sFloat4 _c ) -> sFloat4
+	{
+#if defined( SK_SIMD_FMA )
+		return { _mm_fmadd_ps( _a.v, _b.v, _c.v ) };
+#elif defined( SK_SIMD_NEON )
+		return { vfmaq_f32( _c.v, _a.v, _b.v ) };
+#else
+		return Add( Mul( _a, _b ), _c );
+#endif
+	}
+
+	[[ nodiscard ]] inline auto Sqrt( const sFloat4 _value ) -> sFloat4
+	{
+#if defined( SK_SIMD_SSE )
+		return { _mm_sqrt_ps( _value.v ) };
+#elif defined( SK_SIMD_NEON )
+		return { vsqrtq_f32( _value.v ) };
+#else
+		sFloat4 result;
+		for( int i = 0; i < 4; i++ )
+			result.v[ i ] = Math::sqrt( _value.v[ i ] );
+		return result;
+#endif
+	}
+
+	// One bit per lane where _a < _b, lane 0 being the lowest bit.
+	[[ nodiscard ]] inline auto LessMask( const sFloat4 _a, const sFloat4 _b ) -> uint32_t
+	{
+#if defined( SK_SIMD_SSE )
+		return static_cast< uint32_t >( _mm_movemask_ps( _mm_cmplt_ps( _a.v, _b.v ) ) );
+#elif defined( SK_SIMD_NEON )
+		static constexpr uint32_t kBits[ 4 ] = { 1, 2, 4, 8 };
+		return vaddvq_u32( vandq_u32( vcltq_f32( _a.v, _b.v ), vld1q_u32( kBits ) ) );
+#else
+		uint32_t mask = 0;
+		for( int i = 0; i < 4; i++ )
+			mask |= ( _a.v[ i ] < _b.v[ i ] ? 1u : 0u ) << i;
+		return mask;
+#endif
+	}
+
+	// Picks a lane from _value for every lane of the result.
+	template< int X, int Y, int Z, int W >
+	[[ nodiscard ]] inline auto Shuffle( const sFloat4 _value ) -> sFloat4
+	{
+#if defined( SK_SIMD_SSE )
+		return { _mm_shuffle_ps( _value.v, _value.v, _MM_SHUFFLE( W, Z, Y, X ) ) };
+#else
+		alignas( 16 ) float values[ 4 ];
+		Store( values, _value );
+		return Set( values[ X ], values[ Y ], values[ Z ], values[ W ] );
+#endif
+	}
+
+	template< int Lane >
+	[[ nodiscard ]] inline auto Broadcast( const sFloat4 _value ) -> sFloat4
+	{
+#if defined( SK_SIMD_NEON )
+		return { vdupq_laneq_f32( _value.v, Lane ) };
+#else
+		return Shuffle< Lane, Lane, Lane, Lane >( _value );
+#endif
+	}
+
+	// Dot product of all four lanes, broadcast to every lane.
+	[[ nodiscard ]] inline auto Dot4( const sFloat4 _a, const sFloat4 _b ) -> sFloat4
+	{
+#if defined( SK_SIMD_SSE4 )
+		return { _mm_dp_ps( _a.v, _b.v, 0xFF ) };
+#elif defined( SK_SIMD_NEON )
+		return Splat( vaddvq_f32( vmulq_f32( _a.v, _b.v ) ) );
+#else
+		const auto product = Mul( _a, _b );
+		const auto pairs   = Add( product, Shuffle< 1, 0, 3, 2 >( product ) );
+		return Add( pairs, Shuffle< 2, 3, 0, 1 >( pairs ) );
+#endif
+	}
+
+	// Dot product of xyz, broadcast to every lane.
+	[[ nodiscard ]] inline auto Dot3( const sFloat4 _a, const sFloat4 _b ) -> sFloat4
+	{
+#if defined( SK_SIMD_SSE4 )
+		return { _mm_dp_ps( _a.v, _b.v, 0x7F ) };
+#else
+		return Dot4( Mul( _a, _b ), Set( 1.0f, 1.0f, 1.0f, 0.0f ) );
+#endif
+	}
+
+	// Cross product of xyz, w becomes 0 as long as both w are finite.
+	[[ nodiscard ]] inline auto Cross3( const sFloat4 _a, const sFloat4 _b ) -> sFloat4
+	{
+		const auto a_yzx = Shuffle< 1, 2, 0, 3 >( _a );
+		const auto b_yzx = Shuffle< 1, 2, 0, 3 >( _b );
+		const auto c     = Sub( Mul( _a, b_yzx ), Mul( a_yzx, _b ) );
+		return Shuffle< 1, 2, 0, 3 >( c );
+	}
+
+	inline void Transpose( sFloat4& _r0, sFloat4& _r1, sFloat4& _r2, sFloat4& _r3 )
+	{
+#if defined( SK_SIMD_SSE )
+		_MM_TRANSPOSE4_PS( _r0.v, _r1.v, _r2.v, _r3.v );
+#elif defined( SK_SIMD_NEON )
+		const auto t01 = vtrnq_f32( _r0.v, _r1.v );
+		const auto t23 = vtrnq_f32( _r2.v, _r3.v );
+		_r0.v = vcombine_f32( vget_low_f32 ( t01.val[ 0 ] ), vget_low_f32 ( t23.val[ 0 ] ) );
+		_r1.v = vcombine_f32( vget_low_f32 ( t01.val[ 1 ] ), vget_low_f32 ( t23.val[ 1 ] ) );
+		_r2.v = vcombine_f32( vget_high_f32( t01.val[ 0 ] ), vget_high_f32( t23.val[ 0 ] ) );
+		_r3.v = vcombine_f32( vget_high_f32( t01.val[ 1 ] ), vget_high_f32( t23.val[ 1 ] ) );
+#else
+		for( int r = 0; r < 4; r++ )
+		{
+			for( int c = r + 1; c < 4; c++ )
+			{
+				auto& a = ( r == 0 ? _r0 : r == 1 ? _r1 : r == 2 ? _r2 : _r3 ).v[ c ];
+				auto& b = ( c == 0 ? _r0 : c == 1 ? _r1 : c == 2 ? _r2 : _r3 ).v[ r ];
+				const auto temp = a;
+				a = b;
+				b = temp;
+			}
+		}
+#endif
+	}
+
+	inline auto operator+( const sFloat4 _a, const sFloat4 _b ){ return Add( _a, _b ); }
+	inline auto operator-( const sFloat4 _a, const sFloat4 _b ){ return Sub( _a, _b ); }
+	inline auto operator*( const sFloat4 _a, const sFloat4 _b ){ return Mul( _a, _b ); }
+	inline auto operator/( const sFloat4 _a, const sFloat4 _b ){ return Div( _a, _b ); }
+} // sk::Math::Simd::
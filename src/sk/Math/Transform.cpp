@@ -10,13 +10,36 @@ void cTransform::SetPosition( const cVector3f& _position )
     MarkDirty();
 }
 
-void cTransform::SetRotation( const cVector3f& _rotation )
+void cTransform::SetRotation( const cQuaternionf& _rotation )
 {
     m_rotation_ = _rotation;
     
     MarkDirty();
 }
 
+void cTransform::SetRotation( const cVector3f& _rotation )
+{
+    SetRotation( cQuaternionf::FromEuler( _rotation * Math::kDegToRad< float > ) );
+}
+
+auto cTransform::GetEulerRotation() const -> cVector3f
+{
+    return m_rotation_.ToEuler() * Math::kRadToDeg< float >;
+}
+
+void cTransform::Rotate( const cQuaternionf& _rotation )
+{
+    // Normalized every time to keep the error from building up when rotating every frame.
+    m_rotation_ = ( _rotation * m_rotation_ ).Normalize();
+    
+    MarkDirty();
+}
+
+void cTransform::Rotate( const cVector3f& _rotation )
+{
+    Rotate( cQuaternionf::FromEuler( _rotation * Math::kDegToRad< float > ) );
+}
+
 void cTransform::SetScale( const cVector3f& _scale )
 {
     m_scale_ = _scale;
@@ -24,63 +47,108 @@ void cTransform::SetScale( const cVector3f& _scale )
     MarkDirty();
 }
 
+void cTransform::SetLocalBounds( const cAABBf& _bounds )
+{
+    m_local_bounds_ = _bounds;
+    m_world_bounds_ = _bounds.Transformed( m_world_ );
+
+    m_version_++;
+}
+
 void cTransform::SetParent( const cWeak_Ptr< cTransform >& _parent )
 {
+    if( IsAttached() )
+    {
+        auto parent = cTransform_Hierarchy::kInvalid;
+        if( _parent.is_valid() )
+        {
+            _parent->Attach();
+            parent = _parent->m_handle_;
+        }
+
+        if( !cTransform_Hierarchy::get().set_parent( m_handle_, parent ) )
+            return;
+    }
+
     m_parent_ = _parent;
     
     MarkDirty();
 }
 
-bool cTransform::IsDirty( const bool _recursive ) const
+void cTransform::Attach()
 {
-    // Should we keep this function const, even if we cache the result using const cast?
-    // To the user this should act and look as a getter.
-    // But caching will make it significantly more efficient as we skip the recursion.
+    if( IsAttached() )
+        return;
 
-    if( m_is_dirty_ )
-        return true;
+    const auto hierarchy = cTransform_Hierarchy::getPtr();
+    if( hierarchy == nullptr )
+        return;
 
-    // TODO: Figure out if we can skip the recursive check,
-    // maybe have a forced transform update during render instead of update
-    // and during that time we allow it to be locked as dirty without checking recursively multiple times
-    
-    if( _recursive && m_parent_.is_valid() )
+    auto parent = cTransform_Hierarchy::kInvalid;
+    if( m_parent_.is_valid() )
     {
-        // Cache the result
-        const_cast< bool& >( m_is_dirty_ ) = m_parent_->IsDirty();
-        return m_is_dirty_;
+        m_parent_->Attach();
+        parent = m_parent_->m_handle_;
     }
-    
-    return false;
+
+    // Attached transforms start out dirty, so the hierarchy computes their world matrix with the rest.
+    m_handle_ = hierarchy->attach( *this, parent );
+}
+
+cTransform::~cTransform()
+{
+    if( !IsAttached() )
+        return;
+
+    if( const auto hierarchy = cTransform_Hierarchy::getPtr() )
+        hierarchy->detach( m_handle_ );
+}
+
+bool cTransform::IsDirty() const
+{
+    if( IsAttached() )
+        return cTransform_Hierarchy::get().is_dirty( m_handle_ );
+
+    return m_is_dirty_;
 }
 
 void cTransform::MarkDirty()
 {
-    m_is_dirty_ = true;
+    if( IsAttached() )
+        cTransform_Hierarchy::get().mark_dirty( m_handle_ );
+    else
+        m_is_dirty_ = true;
 }
 
 void cTransform::Update( const bool _force )
 {
-    // We skip the IsDirty call on this object as we will reset m_is_dirty_ in the end anyway.
-    // This method will be slightly more efficient.
-    
-    const bool parent_dirty = m_parent_.is_valid() && m_parent_->IsDirty();
-    
-    // Already up to date
-    if( !_force && !m_is_dirty_ && !parent_dirty )
-        return;
-    
-    const auto local = Math::Matrix4x4::scale_rotate_translate(
-        m_scale_, m_rotation_ * Math::kDegToRad< float >, m_position_ );
-
-    if( m_parent_.is_valid() )
+    // The hierarchy owns the attached transforms, updating one of them here would skip its children.
+    if( IsAttached() )
     {
-        if( parent_dirty )
-            m_parent_->Update();
-        m_world_ = local * m_parent_->GetWorld();
+        if( _force )
+            MarkDirty();
+        return;
     }
-    else
-        m_world_ = local;
+
+    if( !_force && !m_is_dirty_ )
+        return;
     
+    auto world = Math::Matrix4x4::scale_rotate_translate( m_scale_, m_rotation_, m_position_ );
+    if( m_parent_.is_valid() )
+        world = world * m_parent_->GetWorld();
+
+    cMatrix4x4f inverse_world;
+    world.inversed_affine( inverse_world );
+    set_world( world, inverse_world );
+
     m_is_dirty_ = false;
 }
+
+void cTransform::set_world( const cMatrix4x4f& _world, const cMatrix4x4f& _inverse_world )
+{
+    m_world_         = _world;
+    m_inverse_world_ = _inverse_world;
+    m_world_bounds_  = m_local_bounds_.Transformed( m_world_ );
+    
+    m_version_++;
+}
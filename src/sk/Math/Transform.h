@@ -6,25 +6,39 @@
 
 #pragma once
 
+#include <sk/Math/AABB.h>
 #include <sk/Math/Matrix4x4.h>
+#include <sk/Math/Quaternion.h>
+#include <sk/Math/Transform_Hierarchy.h>
 #include <sk/Misc/Smart_Ptrs.h>
+#include <sk/Reflection/Types.h>
 
 namespace sk
 {
-	// TODO: Add setter functions and provide a way to update the transforms children.
+	// Transforms attached to the cTransform_Hierarchy are updated along with their children once per frame.
 	class cTransform
 	{
+		friend class cTransform_Hierarchy;
 	public:
-		cTransform( cVector3f _position = kZero, cVector3f _rotation = kZero, cVector3f _scale = kOne )
+		// The rotation is in euler degrees.
+		cTransform( cVector3f _position = kZero, const cVector3f& _rotation = kZero, cVector3f _scale = kOne )
+		: cTransform( std::move( _position ), cQuaternionf::FromEuler( _rotation * Math::kDegToRad< float > ), std::move( _scale ) )
+		{}
+		cTransform( cVector3f _position, const cQuaternionf& _rotation, cVector3f _scale = kOne )
 		: m_position_( std::move( _position ) )
-		, m_rotation_( std::move( _rotation ) )
+		, m_rotation_( _rotation )
 		, m_scale_   ( std::move( _scale ) )
 		{
 			Update();
 		}
+
+		cTransform( const cTransform& ) = delete;
+
+		~cTransform();
 		
-		// TODO: Add some way to detect changes.
-		// Something like a last_change being set to the current frame.
+		// Incremented every time the world matrix or bounds change, compare against a stored version to detect changes.
+		[[ nodiscard ]]
+		auto GetVersion() const { return m_version_; }
 
 		// You need to manually mark the transform as dirty when calling this.
 		[[ nodiscard ]]
@@ -38,7 +52,16 @@ namespace sk
 		auto& GetRotation()       { return m_rotation_; }
 		[[ nodiscard ]]
 		auto& GetRotation() const { return m_rotation_; }
+		void  SetRotation( const cQuaternionf& _rotation );
+		// Euler degrees.
 		void  SetRotation( const cVector3f& _rotation );
+		[[ nodiscard ]]
+		auto  GetEulerRotation() const -> cVector3f;
+
+		// Applies the rotation in local space, before the current one.
+		void Rotate( const cQuaternionf& _rotation );
+		// Euler degrees.
+		void Rotate( const cVector3f& _rotation );
 
 		// You need to manually mark the transform as dirty when calling this.
 		[[ nodiscard ]]
@@ -49,6 +72,16 @@ namespace sk
 
 		[[ nodiscard ]]
 		constexpr auto& GetWorld() const { return m_world_; }
+		// Cached alongside the world matrix, only recomputed when the transform is updated.
+		[[ nodiscard ]]
+		constexpr auto& GetInverseWorld() const { return m_inverse_world_; }
+
+		// Optional object space bounds, moved into world space along with the world matrix.
+		void  SetLocalBounds( const cAABBf& _bounds );
+		[[ nodiscard ]]
+		auto& GetLocalBounds() const { return m_local_bounds_; }
+		[[ nodiscard ]]
+		auto& GetWorldBounds() const { return m_world_bounds_; }
 
 		[[ nodiscard ]]
 		auto& GetWorldFront() const { return reinterpret_cast< const cVector3f& >( m_world_.z ); }
@@ -59,25 +92,44 @@ namespace sk
 		[[ nodiscard ]]
 		auto& GetWorldPosition() const { return reinterpret_cast< const cVector3f& >( m_world_.w ); }
 
+		// Attaches the parent as well if this transform is attached. Fails if the parent is one of its children.
 		void SetParent( const cWeak_Ptr< cTransform >& _parent );
 
-		// Note: It will set itself to dirty if any of its parents are marked as dirty.
+		// Adds the transform and its parents to the hierarchy, from then on it's updated by cTransform_Hierarchy::Update. Main thread only.
+		void Attach();
+		[[ nodiscard ]]
+		bool IsAttached() const { return m_handle_ != cTransform_Hierarchy::kInvalid; }
+
+		// Only whether the transform itself has changed, changes to the parents show up as a new version once the hierarchy is updated.
 		[[ nodiscard ]]
-		bool IsDirty( bool _recursive = true ) const;
+		bool IsDirty() const;
 		void MarkDirty();
 
+		// For transforms outside of the hierarchy, like the ones being staged. Uses the world matrix of the parent as it is.
 		void Update( bool _force = false );
 
 	private:
+		void set_world( const cMatrix4x4f& _world, const cMatrix4x4f& _inverse_world );
+
 		cWeak_Ptr< cTransform > m_parent_ = nullptr;
 
 		cMatrix4x4f m_world_;
+		cMatrix4x4f m_inverse_world_;
+
+		cAABBf m_local_bounds_;
+		cAABBf m_world_bounds_;
 		
-		cVector3f m_position_;
-		cVector3f m_rotation_;
-		cVector3f m_scale_;
+		cVector3f    m_position_;
+		cQuaternionf m_rotation_;
+		cVector3f    m_scale_;
 		
-		bool m_is_dirty_ = true;
+		cTransform_Hierarchy::handle_t m_handle_ = cTransform_Hierarchy::kInvalid;
+
+		uint32_t m_version_  = 0;
+		// Only used while detached, the hierarchy keeps track of it otherwise.
+		bool     m_is_dirty_ = true;
 	};
 } // sk::
 
+// Stored in the archetypes of the objects, which need an id for it.
+REGISTER_TYPE( sk::cTransform, "Transform" )
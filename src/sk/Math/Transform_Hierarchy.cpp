@@ -0,0 +1,321 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Transform_Hierarchy.h"
+
+#include <sk/Debugging/Debugging.h>
+#include <sk/Math/Transform.h>
+
+#include <algorithm>
+#include <ranges>
+
+using namespace sk;
+
+cTransform_Hierarchy::~cTransform_Hierarchy()
+{
+    for( const auto transform : m_transforms_ )
+        transform->m_handle_ = kInvalid;
+}
+
+auto cTransform_Hierarchy::attach( cTransform& _transform, const handle_t _parent ) -> handle_t
+{
+    handle_t handle;
+    if( m_free_handles_.empty() )
+    {
+        handle = static_cast< handle_t >( m_dense_.size() );
+        m_dense_           .emplace_back();
+        m_first_child_     .emplace_back( kInvalid );
+        m_next_sibling_    .emplace_back( kInvalid );
+        m_previous_sibling_.emplace_back( kInvalid );
+    }
+    else
+    {
+        handle = m_free_handles_.back();
+        m_free_handles_.pop_back();
+    }
+
+    // The parent is already attached, so appending keeps the depth order intact.
+    const auto index = static_cast< uint32_t >( m_handles_.size() );
+    m_dense_[ handle ] = index;
+
+    m_parents_   .emplace_back( _parent == kInvalid ? kNoParent : m_dense_[ _parent ] );
+    m_handles_   .emplace_back( handle );
+    m_transforms_.emplace_back( &_transform );
+    m_dirty_     .emplace_back( 1 );
+
+    if( _parent != kInvalid )
+        link( handle, _parent );
+
+    return handle;
+}
+
+void cTransform_Hierarchy::detach( const handle_t _handle )
+{
+    const auto index = m_dense_[ _handle ];
+    const auto last  = static_cast< uint32_t >( m_handles_.size() - 1 );
+
+    unlink( _handle );
+
+    // Only the children are touched, instead of going through every transform.
+    for( auto child = m_first_child_[ _handle ]; child != kInvalid; )
+    {
+        const auto next = m_next_sibling_[ child ];
+        const auto child_index = m_dense_[ child ];
+
+        m_parents_[ child_index ] = kNoParent;
+        m_dirty_  [ child_index ] = 1;
+        m_next_sibling_    [ child ] = kInvalid;
+        m_previous_sibling_[ child ] = kInvalid;
+
+        child = next;
+    }
+    m_first_child_[ _handle ] = kInvalid;
+
+    // Swap and pop, the order gets restored by the next sort.
+    if( index != last )
+    {
+        for( auto child = m_first_child_[ m_handles_[ last ] ]; child != kInvalid; child = m_next_sibling_[ child ] )
+            m_parents_[ m_dense_[ child ] ] = index;
+
+        m_parents_   [ index ] = m_parents_   [ last ];
+        m_handles_   [ index ] = m_handles_   [ last ];
+        m_transforms_[ index ] = m_transforms_[ last ];
+        m_dirty_     [ index ] = m_dirty_     [ last ];
+
+        m_dense_[ m_handles_[ index ] ] = index;
+        m_needs_sort_ = true;
+    }
+
+    m_parents_   .pop_back();
+    m_handles_   .pop_back();
+    m_transforms_.pop_back();
+    m_dirty_     .pop_back();
+
+    m_dense_[ _handle ] = kNoParent;
+    m_free_handles_.emplace_back( _handle );
+}
+
+bool cTransform_Hierarchy::set_parent( const handle_t _handle, const handle_t _parent )
+{
+    const auto index = m_dense_[ _handle ];
+
+    if( _parent != kInvalid )
+    {
+        for( auto ancestor = m_dense_[ _parent ]; ancestor != kNoParent; ancestor = m_parents_[ ancestor ] )
+        {
+            SK_BREAK_RET_IF( sk::Severity::kEngine, ancestor == index,
+                "Error: A transform can't be parented to itself or one of its children.", false )
+        }
+    }
+
+    unlink( _handle );
+
+    if( _parent == kInvalid )
+        m_parents_[ index ] = kNoParent;
+    else
+    {
+        m_parents_[ index ] = m_dense_[ _parent ];
+        link( _handle, _parent );
+    }
+
+    m_dirty_[ index ] = 1;
+    m_needs_sort_     = true;
+
+    return true;
+}
+
+void cTransform_Hierarchy::link( const handle_t _handle, const handle_t _parent )
+{
+    const auto first = m_first_child_[ _parent ];
+
+    m_previous_sibling_[ _handle ] = kInvalid;
+    m_next_sibling_    [ _handle ] = first;
+    if( first != kInvalid )
+        m_previous_sibling_[ first ] = _handle;
+
+    m_first_child_[ _parent ] = _handle;
+}
+
+void cTransform_Hierarchy::unlink( const handle_t _handle )
+{
+    const auto parent = m_parents_[ m_dense_[ _handle ] ];
+    if( parent == kNoParent )
+        return;
+
+    const auto previous = m_previous_sibling_[ _handle ];
+    const auto next     = m_next_sibling_    [ _handle ];
+
+    if( previous != kInvalid )
+        m_next_sibling_[ previous ] = next;
+    else
+        m_first_child_[ m_handles_[ parent ] ] = next;
+
+    if( next != kInvalid )
+        m_previous_sibling_[ next ] = previous;
+
+    m_previous_sibling_[ _handle ] = kInvalid;
+    m_next_sibling_    [ _handle ] = kInvalid;
+}
+
+void cTransform_Hierarchy::Update()
+{
+    if( m_needs_sort_ )
+        sort();
+
+    const auto size = m_transforms_.size();
+
+    m_updated_.clear();
+    m_update_count_++;
+
+    // Parents always come first, so a single pass is enough to reach the deepest children.
+    for( size_t i = 0; i < size; i++ )
+    {
+        if( const auto parent = m_parents_[ i ]; parent != kNoParent )
+            m_dirty_[ i ] |= m_dirty_[ parent ];
+
+        if( m_dirty_[ i ] )
+            m_updated_.emplace_back( m_transforms_[ i ] );
+    }
+
+    // Only the dirty transforms are batched, so every lane does useful work no matter where they are in the hierarchy.
+    for( size_t first = 0; first < m_updated_.size(); first += 4 )
+        update_batch( first, std::min< size_t >( 4, m_updated_.size() - first ) );
+
+    std::ranges::fill( m_dirty_, 0 );
+}
+
+void cTransform_Hierarchy::sort()
+{
+    const auto size = m_handles_.size();
+    constexpr auto kUnknown = std::numeric_limits< uint32_t >::max();
+
+    std::vector< uint32_t > depths( size, kUnknown );
+    std::vector< uint32_t > chain;
+    uint32_t max_depth = 0;
+
+    for( uint32_t i = 0; i < size; i++ )
+    {
+        chain.clear();
+        auto current = i;
+        while( current != kNoParent && depths[ current ] == kUnknown )
+        {
+            chain.emplace_back( current );
+            current = m_parents_[ current ];
+        }
+
+        auto depth = current == kNoParent ? 0u : depths[ current ] + 1;
+        for( auto& link : chain | std::views::reverse )
+            depths[ link ] = depth++;
+
+        max_depth = std::max( max_depth, depth );
+    }
+
+    // Counting sort, stable so siblings keep their relative order.
+    std::vector< uint32_t > offsets( max_depth + 1, 0 );
+    for( const auto depth : depths )
+        offsets[ depth + 1 ]++;
+    for( size_t i = 1; i < offsets.size(); i++ )
+        offsets[ i ] += offsets[ i - 1 ];
+
+    std::vector< uint32_t > new_index( size );
+    for( uint32_t i = 0; i < size; i++ )
+        new_index[ i ] = offsets[ depths[ i ] ]++;
+
+    const auto permute = [ & ]< class Ty >( std::vector< Ty >& _values )
+    {
+        std::vector< Ty > sorted( _values.size() );
+        for( size_t i = 0; i < size; i++ )
+            sorted[ new_index[ i ] ] = std::move( _values[ i ] );
+        _values.swap( sorted );
+    };
+
+    for( auto& parent : m_parents_ )
+    {
+        if( parent != kNoParent )
+            parent = new_index[ parent ];
+    }
+
+    permute( m_parents_ );
+    permute( m_handles_ );
+    permute( m_transforms_ );
+    permute( m_dirty_ );
+
+    for( uint32_t i = 0; i < size; i++ )
+        m_dense_[ m_handles_[ i ] ] = i;
+
+    m_needs_sort_ = false;
+}
+
+void cTransform_Hierarchy::update_batch( const size_t _first, const size_t _count )
+{
+    // The local matrices are built four at a time with every lane being a transform.
+    alignas( 16 ) float qx[ 4 ] = {}, qy[ 4 ] = {}, qz[ 4 ] = {}, qw[ 4 ] = {};
+    alignas( 16 ) float sx[ 4 ] = {}, sy[ 4 ] = {}, sz[ 4 ] = {};
+    alignas( 16 ) float px[ 4 ] = {}, py[ 4 ] = {}, pz[ 4 ] = {};
+
+    for( size_t lane = 0; lane < _count; lane++ )
+    {
+        const auto& transform = *m_updated_[ _first + lane ];
+        const auto& rotation  = transform.m_rotation_;
+        const auto& scale     = transform.m_scale_;
+        const auto& position  = transform.m_position_;
+
+        qx[ lane ] = rotation.x; qy[ lane ] = rotation.y; qz[ lane ] = rotation.z; qw[ lane ] = rotation.w;
+        sx[ lane ] = scale.x;    sy[ lane ] = scale.y;    sz[ lane ] = scale.z;
+        px[ lane ] = position.x; py[ lane ] = position.y; pz[ lane ] = position.z;
+    }
+
+    using namespace Math::Simd;
+
+    const auto v_x  = Load( qx ), v_y  = Load( qy ), v_z  = Load( qz ), v_w = Load( qw );
+    const auto v_sx = Load( sx ), v_sy = Load( sy ), v_sz = Load( sz );
+
+    const auto zero = Zero();
+    const auto one  = Splat( 1.0f );
+    const auto two  = Splat( 2.0f );
+
+    const auto xx = v_x * v_x, yy = v_y * v_y, zz = v_z * v_z;
+    const auto xy = v_x * v_y, xz = v_x * v_z, yz = v_y * v_z;
+    const auto wx = v_w * v_x, wy = v_w * v_y, wz = v_w * v_z;
+
+    // Same layout as cQuaternion::ToMatrix.
+    sFloat4 rows[ 4 ][ 4 ] = {
+        { ( one - two * ( yy + zz ) ) * v_sx, two * ( xy - wz ) * v_sx, two * ( xz + wy ) * v_sx, zero },
+        { two * ( xy + wz ) * v_sy, ( one - two * ( xx + zz ) ) * v_sy, two * ( yz - wx ) * v_sy, zero },
+        { two * ( xz - wy ) * v_sz, two * ( yz + wx ) * v_sz, ( one - two * ( xx + yy ) ) * v_sz, zero },
+        { Load( px ), Load( py ), Load( pz ), one },
+    };
+
+    // From one register per component to one register per transform.
+    for( auto& row : rows )
+        Transpose( row[ 0 ], row[ 1 ], row[ 2 ], row[ 3 ] );
+
+    cMatrix4x4f worlds  [ 4 ];
+    cMatrix4x4f inverses[ 4 ];
+
+    // The updated transforms are in depth order, so a parent in the same batch is written before its children read it.
+    for( size_t lane = 0; lane < _count; lane++ )
+    {
+        auto& transform = *m_updated_[ _first + lane ];
+        auto& world     = worlds[ lane ];
+
+        Store( world.x, rows[ 0 ][ lane ] );
+        Store( world.y, rows[ 1 ][ lane ] );
+        Store( world.z, rows[ 2 ][ lane ] );
+        Store( world.w, rows[ 3 ][ lane ] );
+
+        if( const auto& parent = transform.m_parent_; parent.is_valid() )
+            Math::Matrix4x4::multiply_fast( world, parent->m_world_, world );
+
+        transform.m_world_ = world;
+    }
+
+    // Every lane is dirty, so the inverses are done together instead of one scalar inverse per transform.
+    Math::Matrix4x4::inversed_affine_x4( worlds, inverses, _count );
+
+    for( size_t lane = 0; lane < _count; lane++ )
+        m_updated_[ _first + lane ]->set_world( worlds[ lane ], inverses[ lane ] );
+}
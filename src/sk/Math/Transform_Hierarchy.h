@@ -0,0 +1,88 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include <sk/Misc/Singleton.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace sk
+{
+	class cTransform;
+
+	// Flattened hierarchy of every attached cTransform.
+	// The transforms are kept in contiguous arrays sorted by their depth, so a parent always comes before its children.
+	// This lets Update resolve the dirty flags and world matrices in a single linear pass without any recursion.
+	// Main thread only, transforms built while staging are attached once their object is committed.
+	class cTransform_Hierarchy : public cSingleton< cTransform_Hierarchy >
+	{
+		friend class cTransform;
+	public:
+		using handle_t = uint32_t;
+
+		static constexpr handle_t kInvalid = std::numeric_limits< handle_t >::max();
+
+		// Detaches whatever is still attached, so it doesn't reach for the hierarchy once it's gone.
+		~cTransform_Hierarchy() override;
+
+		// Propagates the dirty flags down the hierarchy and recomputes every dirty world matrix.
+		void Update();
+
+		// The transforms which got a new world matrix in the last Update, parents before their children.
+		[[ nodiscard ]] auto& GetUpdated() const { return m_updated_; }
+		// Compare against a stored count to know if GetUpdated covers everything that has moved since then.
+		[[ nodiscard ]] auto  GetUpdateCount() const { return m_update_count_; }
+
+		[[ nodiscard ]] auto GetSize() const { return m_transforms_.size(); }
+
+	private:
+		static constexpr uint32_t kNoParent = std::numeric_limits< uint32_t >::max();
+
+		auto attach( cTransform& _transform, handle_t _parent ) -> handle_t;
+		// The children will be detached from it and become roots, keeping their local transform.
+		void detach( handle_t _handle );
+
+		// Fails if the parent is the transform itself or any of its children.
+		bool set_parent( handle_t _handle, handle_t _parent );
+
+		// Adds the transform to the front of the child list of the parent.
+		void link  ( handle_t _handle, handle_t _parent );
+		// Removes the transform from the child list of its current parent, if it has one.
+		void unlink( handle_t _handle );
+
+		void mark_dirty( const handle_t _handle ){ m_dirty_[ m_dense_[ _handle ] ] = 1; }
+		[[ nodiscard ]] bool is_dirty( const handle_t _handle ) const { return m_dirty_[ m_dense_[ _handle ] ] != 0; }
+
+		// Sorts the transforms by depth, only needed after the hierarchy has changed.
+		void sort();
+		// Computes the world and inverse world matrices of up to 4 of the updated transforms starting at _first.
+		void update_batch( size_t _first, size_t _count );
+
+		// Indexed by dense index.
+		std::vector< uint32_t >    m_parents_;
+		std::vector< handle_t >    m_handles_;
+		std::vector< cTransform* > m_transforms_;
+		std::vector< uint8_t >     m_dirty_;
+
+		// Indexed by handle.
+		std::vector< uint32_t > m_dense_;
+		std::vector< handle_t > m_free_handles_;
+
+		// The children of every transform as a linked list, indexed by handle so sorting and removing leave them alone.
+		std::vector< handle_t > m_first_child_;
+		std::vector< handle_t > m_next_sibling_;
+		std::vector< handle_t > m_previous_sibling_;
+
+		std::vector< cTransform* > m_updated_;
+		uint64_t                   m_update_count_ = 0;
+
+		bool m_needs_sort_ = false;
+	};
+} // sk::
@@ -0,0 +1,173 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include <sk/Memory/Tracker/Tracker.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace sk::Memory
+{
+	// Hands out fixed size slots for a single type from a free list.
+	// The slots are allocated in chunks that are kept for the lifetime of the program, so recycling a slot never reaches the allocator.
+	// Every thread keeps a few free slots of its own, only moving a batch of them to or from the shared list takes the lock.
+	template< class Ty, size_t ChunkSize = 256 >
+	class cPool
+	{
+		static_assert( alignof( Ty ) <= default_alignment, "The pool can't align the slots more than the default alignment." );
+
+		static constexpr size_t kBatch = std::max< size_t >( ChunkSize / 8, 1 );
+
+	public:
+		cPool( const cPool& ) = delete;
+		cPool& operator=( const cPool& ) = delete;
+
+		// The pool for the type. It's never destroyed, so instances are allowed to outlive the static destructors.
+		static auto Get( void ) -> cPool&
+		{
+			static auto* pool = ::new( ::malloc( sizeof( cPool ) ) ) cPool{};
+			return *pool;
+		} // Get
+
+		template< class... Args >
+		requires std::constructible_from< Ty, Args... >
+		auto Create( Args&&... _args ) -> Ty*
+		{
+			return std::construct_at( static_cast< Ty* >( Alloc() ), std::forward< Args >( _args )... );
+		} // Create
+
+		void Destroy( Ty* _instance )
+		{
+			if( _instance == nullptr )
+				return;
+
+			std::destroy_at( _instance );
+			Free( _instance );
+		} // Destroy
+
+		// Uninitialized memory for a single Ty.
+		[[ nodiscard ]] auto Alloc( void ) -> void*
+		{
+			auto& cache = m_cache_;
+			if( cache.free == nullptr )
+				refill( cache );
+
+			const auto slot = cache.free;
+			cache.free = slot->next;
+			cache.count--;
+
+			return slot->data;
+		} // Alloc
+
+		// The slot may be freed by another thread than the one it was allocated on.
+		void Free( void* _slot )
+		{
+			auto& cache = m_cache_;
+
+			const auto slot = static_cast< uSlot* >( _slot );
+			slot->next = cache.free;
+			cache.free = slot;
+			cache.count++;
+
+			if( cache.count > kBatch * 2 )
+				flush( cache, kBatch );
+		} // Free
+
+		// Slots handed out to the threads, which includes the ones they keep for themselves.
+		// Both are read under the lock, as other threads may be refilling or growing the pool at the same time.
+		[[ nodiscard ]] auto GetUsed    ( void ) const
+		{
+			std::scoped_lock lock( m_mutex_ );
+			return m_used_;
+		} // GetUsed
+		[[ nodiscard ]] auto GetCapacity( void ) const
+		{
+			std::scoped_lock lock( m_mutex_ );
+			return m_chunks_.size() * ChunkSize;
+		} // GetCapacity
+
+	private:
+		union uSlot
+		{
+			uSlot* next;
+			alignas( Ty ) std::byte data[ sizeof( Ty ) ];
+		};
+
+		struct sCache
+		{
+			uSlot* free  = nullptr;
+			size_t count = 0;
+
+			// Hands the slots back when the thread exits, the pool outlives every thread.
+			~sCache( void )
+			{
+				if( count > 0 )
+					Get().flush( *this, count );
+			}
+		};
+
+		cPool( void ) = default;
+
+		void refill( sCache& _cache )
+		{
+			std::scoped_lock lock( m_mutex_ );
+
+			if( m_free_ == nullptr )
+				grow();
+
+			for( ; _cache.count < kBatch && m_free_ != nullptr; _cache.count++ )
+			{
+				const auto slot = m_free_;
+				m_free_     = slot->next;
+				slot->next  = _cache.free;
+				_cache.free = slot;
+				m_used_++;
+			}
+		} // refill
+
+		void flush( sCache& _cache, const size_t _count )
+		{
+			std::scoped_lock lock( m_mutex_ );
+
+			for( size_t i = 0; i < _count; i++ )
+			{
+				const auto slot = _cache.free;
+				_cache.free = slot->next;
+				slot->next  = m_free_;
+				m_free_     = slot;
+			}
+
+			_cache.count -= _count;
+			m_used_      -= _count;
+		} // flush
+
+		void grow( void )
+		{
+			const auto chunk = static_cast< uSlot* >( alloc_fast( sizeof( uSlot ) * ChunkSize ) );
+			m_chunks_.emplace_back( chunk );
+
+			// Linked in reverse so the slots are handed out in address order.
+			for( size_t i = ChunkSize; i > 0; i-- )
+			{
+				chunk[ i - 1 ].next = m_free_;
+				m_free_ = &chunk[ i - 1 ];
+			}
+		} // grow
+
+		static inline thread_local sCache m_cache_;
+
+		std::vector< uSlot* > m_chunks_;
+		uSlot*                m_free_ = nullptr;
+		size_t                m_used_ = 0;
+		mutable std::mutex    m_mutex_;
+	};
+} // sk::Memory::
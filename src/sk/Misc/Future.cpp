@@ -0,0 +1,72 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Future.h"
+
+#include <array>
+
+namespace
+{
+	constexpr size_t kMaxHelpers = 8;
+
+	std::atomic_uint32_t signal = 0;
+	std::array< std::atomic< sk::Async::helper_t >, kMaxHelpers > helpers{};
+
+	bool help()
+	{
+		for( auto& slot : helpers )
+		{
+			if( const auto helper = slot.load(); helper != nullptr && helper() )
+				return true;
+		}
+
+		return false;
+	}
+} // ::
+
+void sk::Async::Notify()
+{
+	++signal;
+	signal.notify_all();
+} // Notify
+
+void sk::Async::AddHelper( const helper_t _helper )
+{
+	for( auto& slot : helpers )
+	{
+		helper_t expected = nullptr;
+		if( slot.compare_exchange_strong( expected, _helper ) )
+			return;
+	}
+
+	SK_BREAK_IF( sk::Severity::kEngine, true,
+		"Error: Ran out of slots for async helpers." )
+} // AddHelper
+
+void sk::Async::RemoveHelper( const helper_t _helper )
+{
+	for( auto& slot : helpers )
+	{
+		auto expected = _helper;
+		slot.compare_exchange_strong( expected, nullptr );
+	}
+} // RemoveHelper
+
+void sk::Async::WaitUntil( const std::function< bool() >& _predicate )
+{
+	while( !_predicate() )
+	{
+		// The ticket has to be taken before checking again, otherwise a notify between the check and the wait would be lost.
+		const auto ticket = signal.load();
+		if( _predicate() )
+			return;
+
+		if( help() )
+			continue;
+
+		signal.wait( ticket );
+	}
+} // WaitUntil
@@ -0,0 +1,298 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include <sk/Debugging/Debugging.h>
+#include <sk/Misc/Smart_Ptrs.h>
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <variant>
+#include <vector>
+
+namespace sk
+{
+	template< class Ty >
+	class cFuture;
+	template< class Ty >
+	class cPromise;
+	template< class Ty >
+	class cWeak_Promise;
+} // sk::
+
+namespace sk::Async
+{
+	// Runs a single piece of queued work on the calling thread. Returns false if there was nothing it could do.
+	using helper_t = bool( * )();
+
+	// Wakes up every thread blocked in WaitUntil so they can re-check their condition.
+	// Has to be called whenever something a waiting thread might care about happens, like work being queued or completed.
+	void Notify();
+
+	// Helpers are used by waiting threads to run queued work instead of idling.
+	void AddHelper   ( helper_t _helper );
+	void RemoveHelper( helper_t _helper );
+
+	// Blocks until _predicate returns true, helping out with queued work in the meantime.
+	void WaitUntil( const std::function< bool() >& _predicate );
+
+	template< class Ty >
+	struct sShared_State
+	{
+		using storage_t = std::conditional_t< std::is_void_v< Ty >, std::monostate, Ty >;
+
+		std::mutex                             mutex;
+		std::atomic_bool                       ready = false;
+		std::optional< storage_t >             value;
+		std::vector< std::function< void() > > continuations;
+	};
+} // sk::Async::
+
+namespace sk
+{
+	// Continuations run on the thread completing the promise, or directly if the future is already ready.
+	template< class Ty >
+	class cFuture
+	{
+		template< class > friend class cPromise;
+		using state_t = Async::sShared_State< Ty >;
+	public:
+		using value_t = Ty;
+
+		cFuture() = default;
+
+		[[ nodiscard ]] bool IsValid() const { return m_state_ != nullptr; }
+		[[ nodiscard ]] bool IsReady() const { return IsValid() && m_state_->ready.load(); }
+
+		// Waits while helping out with queued work on the calling thread.
+		void Wait() const;
+
+		// Waits for the value if it's not ready yet.
+		auto Get() const -> std::add_lvalue_reference_t< const Ty >;
+
+		void OnReady( const std::function< void() >& _callback ) const;
+
+		template< class Fn >
+		auto Then( Fn&& _function ) const;
+
+	private:
+		explicit cFuture( const cShared_ptr< state_t >& _state ) : m_state_( _state ) {}
+
+		cShared_ptr< state_t > m_state_ = nullptr;
+	};
+
+	template< class Ty >
+	class cPromise
+	{
+		template< class > friend class cWeak_Promise;
+		using state_t   = Async::sShared_State< Ty >;
+		using storage_t = state_t::storage_t;
+	public:
+		cPromise() : m_state_( sk::make_shared< state_t >() ) {}
+
+		[[ nodiscard ]] auto GetFuture() const -> cFuture< Ty > { return cFuture< Ty >( m_state_ ); }
+		// For listeners stored inside of the value, which would keep the state alive forever if they held on to the promise.
+		[[ nodiscard ]] auto GetWeak  () const -> cWeak_Promise< Ty >;
+
+		// Constructs the value without making it visible to the future.
+		// Useful for values that need a stable address before they're done, like asset pointers.
+		template< class... Args >
+		auto Emplace( Args&&... _args ) -> storage_t&
+		{
+			return m_state_->value.emplace( std::forward< Args >( _args )... );
+		}
+
+		// Makes the value visible and runs the continuations.
+		void SetReady() const;
+
+		template< class... Args >
+		void SetValue( Args&&... _args )
+		{
+			Emplace( std::forward< Args >( _args )... );
+			SetReady();
+		}
+
+	private:
+		explicit cPromise( const cShared_ptr< state_t >& _state ) : m_state_( _state ) {}
+
+		cShared_ptr< state_t > m_state_;
+	};
+
+	// Refers to the state of a promise without keeping it alive.
+	template< class Ty >
+	class cWeak_Promise
+	{
+		template< class > friend class cPromise;
+		using state_t = Async::sShared_State< Ty >;
+	public:
+		cWeak_Promise() = default;
+
+		// Returns false if every promise and future of the state is already gone.
+		bool SetReady() const
+		{
+			if( !m_state_.is_valid() )
+				return false;
+
+			cPromise< Ty >( m_state_.Lock() ).SetReady();
+			return true;
+		}
+
+	private:
+		explicit cWeak_Promise( const cShared_ptr< state_t >& _state ) : m_state_( _state ) {}
+
+		cWeak_Ptr< state_t > m_state_ = nullptr;
+	};
+
+	template< class Ty >
+	auto cPromise< Ty >::GetWeak() const -> cWeak_Promise< Ty >
+	{
+		return cWeak_Promise< Ty >( m_state_ );
+	}
+
+	template< class Ty >
+	void cFuture< Ty >::Wait() const
+	{
+		if( IsReady() )
+			return;
+
+		SK_BREAK_RET_IFN( sk::Severity::kEngine, IsValid(),
+			"Error: Trying to wait for an invalid future." )
+
+		Async::WaitUntil( [ this ]{ return IsReady(); } );
+	}
+
+	template< class Ty >
+	auto cFuture< Ty >::Get() const -> std::add_lvalue_reference_t< const Ty >
+	{
+		Wait();
+
+		if constexpr( !std::is_void_v< Ty > )
+			return *m_state_->value;
+	}
+
+	template< class Ty >
+	void cFuture< Ty >::OnReady( const std::function< void() >& _callback ) const
+	{
+		SK_BREAK_RET_IFN( sk::Severity::kEngine, IsValid(),
+			"Error: Trying to add a continuation to an invalid future." )
+
+		{
+			std::scoped_lock lock( m_state_->mutex );
+			if( !m_state_->ready.load() )
+			{
+				m_state_->continuations.emplace_back( _callback );
+				return;
+			}
+		}
+
+		_callback();
+	}
+
+	template< class Ty >
+	template< class Fn >
+	auto cFuture< Ty >::Then( Fn&& _function ) const
+	{
+		using result_t = std::conditional_t< std::is_void_v< Ty >, std::invoke_result< Fn >, std::invoke_result< Fn, const Ty& > >::type;
+
+		cPromise< result_t > promise;
+		auto future = promise.GetFuture();
+
+		OnReady( [ state = m_state_, promise, function = std::forward< Fn >( _function ) ]() mutable
+		{
+			if constexpr( std::is_void_v< Ty > && std::is_void_v< result_t > )
+			{
+				function();
+				promise.SetValue();
+			}
+			else if constexpr( std::is_void_v< Ty > )
+				promise.SetValue( function() );
+			else if constexpr( std::is_void_v< result_t > )
+			{
+				function( *state->value );
+				promise.SetValue();
+			}
+			else
+				promise.SetValue( function( *state->value ) );
+		} );
+
+		return future;
+	}
+
+	template< class Ty >
+	void cPromise< Ty >::SetReady() const
+	{
+		std::vector< std::function< void() > > continuations;
+		{
+			std::scoped_lock lock( m_state_->mutex );
+			SK_BREAK_RET_IF( sk::Severity::kEngine, m_state_->ready.load(),
+				"Error: Promise has already been fulfilled." )
+
+			if( !m_state_->value.has_value() )
+				m_state_->value.emplace();
+
+			m_state_->ready.store( true );
+			continuations.swap( m_state_->continuations );
+		}
+
+		for( auto& continuation : continuations )
+			continuation();
+
+		Async::Notify();
+	}
+
+	// Returns a future that becomes ready once every future provided is ready.
+	template< class Ty >
+	auto WhenAll( const std::vector< cFuture< Ty > >& _futures ) -> cFuture< void >
+	{
+		cPromise< void > promise;
+		auto future = promise.GetFuture();
+
+		if( _futures.empty() )
+		{
+			promise.SetReady();
+			return future;
+		}
+
+		auto remaining = sk::make_shared< std::atomic_size_t >( _futures.size() );
+		for( auto& to_wait : _futures )
+		{
+			to_wait.OnReady( [ remaining, promise ]
+			{
+				if( --*remaining == 0 )
+					promise.SetReady();
+			} );
+		}
+
+		return future;
+	}
+
+	template< class... Ty >
+	auto WhenAll( const cFuture< Ty >&... _futures ) -> cFuture< void >
+	{
+		cPromise< void > promise;
+		auto future = promise.GetFuture();
+
+		if constexpr( sizeof...( Ty ) == 0 )
+		{
+			promise.SetReady();
+			return future;
+		}
+
+		auto remaining = sk::make_shared< std::atomic_size_t >( sizeof...( Ty ) );
+		const auto on_ready = [ remaining, promise ]
+		{
+			if( --*remaining == 0 )
+				promise.SetReady();
+		};
+
+		( _futures.OnReady( on_ready ), ... );
+
+		return future;
+	}
+} // sk::
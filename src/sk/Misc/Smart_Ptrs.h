@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <sk/Memory/Pool.h>
 #include <sk/Memory/Tracker/Tracker.h>
 
 #include <atomic>
@@ -72,6 +73,18 @@ namespace sk
 			{
 				m_is_constructed = true;
 			}
+
+			// Lets a pool take the content back instead of it being deleted. _instance is the complete object.
+			void set_release( void( *_release )( void* ), void* _instance )
+			{
+				m_release_  = _release;
+				m_instance_ = _instance;
+			}
+
+		protected:
+			void( *m_release_ )( void* ) = nullptr;
+			void* m_instance_            = nullptr;
+
 		private:
 			std::atomic_uint32_t m_ref_count;
 			std::atomic_uint32_t m_weak_ref_count;
@@ -86,14 +99,23 @@ namespace sk
 		{
 			void deleteCont( void ) override
 			{
-				SK_DELETE( m_ptr );
+				if( m_release_ != nullptr )
+					m_release_( m_instance_ );
+				else
+					SK_DELETE( m_ptr );
 				m_ptr = nullptr;
 			}
 			void deleteSelf( void ) override
 			{
-				SK_DELETE( this );
+				Memory::cPool< cData >::Get().Destroy( this );
 			}
 		public:
+			// The control blocks are pooled as every shared pointer needs one.
+			static auto Create( Ty* _content ) -> cData*
+			{
+				return Memory::cPool< cData >::Get().Create( _content );
+			}
+
 			void* get_ptr( void ) override { return m_ptr; }
 
 			explicit cData( Ty* _content )
@@ -166,6 +188,9 @@ namespace sk
 		friend class cShared_ptr;
 		template< class Fy >
 		friend class cWeak_Ptr;
+		template< class Ty2, class ...Args >
+		requires std::constructible_from< Ty2, Args... >
+		friend auto make_pooled( Args&&... ) -> cShared_ptr< Ty2 >;
 
 		Ty* m_ptr_ = nullptr;
 	public:
@@ -173,7 +198,7 @@ namespace sk
 
 		explicit cShared_ptr( Ty* _ptr )
 		{
-			m_data_ = SK_SINGLE( Ptr_logic::cData< Ty >, _ptr );
+			m_data_ = Ptr_logic::cData< Ty >::Create( _ptr );
 			m_data_->completed();
 			m_ptr_ = _ptr;
 			inc();
@@ -349,7 +374,7 @@ namespace sk
 
 		explicit cShared_Ref( Ty* _ptr )
 		{
-			m_data_ = SK_SINGLE( Ptr_logic::cData< Ty >, _ptr );
+			m_data_ = Ptr_logic::cData< Ty >::Create( _ptr );
 			inc();
 		} // cShared_ptr
 
@@ -663,7 +688,7 @@ namespace sk
 		static auto make_unsafe( Ty* _ptr )
 		{
 			cWeak_Ptr unsafe;
-			unsafe.m_data_ = SK_SINGLE( Ptr_logic::cData< Ty >, _ptr );
+			unsafe.m_data_ = Ptr_logic::cData< Ty >::Create( _ptr );
 			unsafe.inc_weak();
 
 			return unsafe;
@@ -681,10 +706,14 @@ namespace sk
 		cPtr_base m_self_;
 		
 		void complete() const { m_self_.m_data_->completed(); }
+		void set_release( void( *_release )( void* ), void* _instance ) const { m_self_.m_data_->set_release( _release, _instance ); }
 		
 		template< class Ty2, class ...Args >
 		requires std::constructible_from< Ty2, Args... >
 		friend auto make_shared( Args&&... ) -> cShared_ptr< Ty2 >;
+		template< class Ty2, class ...Args >
+		requires std::constructible_from< Ty2, Args... >
+		friend auto make_pooled( Args&&... ) -> cShared_ptr< Ty2 >;
 	};
 	template< class Ty >
 	class cShared_from_this : public iShared_From_this
@@ -699,7 +728,7 @@ namespace sk
 
 	protected:
 		cShared_from_this()
-		: iShared_From_this( SK_SINGLE( Ptr_logic::cData< Ty >, static_cast< Ty* >( this ) ) )
+		: iShared_From_this( Ptr_logic::cData< Ty >::Create( static_cast< Ty* >( this ) ) )
 		{} // cShared_from_this
 	};
 
@@ -719,5 +748,30 @@ namespace sk
 		else
 			return cShared_ptr< Ty >( ptr );
 	}
+
+	// Same as make_shared, but the instance is constructed in a recycled slot from the pool of its type.
+	// The slot goes back to the pool once the last shared pointer is gone.
+	template< class Ty, class... Args >
+	requires std::constructible_from< Ty, Args... >
+	auto make_pooled( Args&&... _args ) -> cShared_ptr< Ty >
+	{
+		Ty* ptr = Memory::cPool< Ty >::Get().Create( std::forward< Args >( _args )... );
+
+		constexpr auto release = []( void* _instance ){ Memory::cPool< Ty >::Get().Destroy( static_cast< Ty* >( _instance ) ); };
+
+		if constexpr( std::is_base_of_v< iShared_From_this, Ty > )
+		{
+			const auto self = static_cast< iShared_From_this* >( ptr );
+			self->set_release( release, ptr );
+			self->complete();
+			return ptr->get_shared().template Cast< Ty >();
+		}
+		else
+		{
+			cShared_ptr< Ty > shared( ptr );
+			shared.m_data_->set_release( release, ptr );
+			return shared;
+		}
+	}
 } // sk::
 
@@ -71,6 +71,7 @@ void sk::cStringIDManager::cStringRegistry::dec() const
 auto sk::cStringIDManager::getRegistry( const std::string_view _str ) -> cStringRegistry
 {
     const str_hash hash = _str;
+    std::scoped_lock lock( m_registry_mtx_ );
     if( const auto itr = m_registry_lookup_.find( hash ); itr == m_registry_lookup_.end() )
     {
         size_t spot;
@@ -102,6 +103,7 @@ auto sk::cStringIDManager::getRegistry( const std::string_view _str ) -> cString
 
 auto sk::cStringIDManager::getRegistry( const str_hash& _hash )
 {
+    std::scoped_lock lock( m_registry_mtx_ );
     if( const auto itr = m_registry_lookup_.find( _hash ); itr != m_registry_lookup_.end() )
         return cStringRegistry{ itr->second };
     
@@ -110,10 +112,15 @@ auto sk::cStringIDManager::getRegistry( const str_hash& _hash )
 
 void sk::cStringIDManager::destroyRegistry( const str_hash& _registry )
 {
+    std::scoped_lock lock( m_registry_mtx_ );
     const auto itr = m_registry_lookup_.find( _registry );
     if( itr == m_registry_lookup_.end() )
         return;
 
+    // Another thread might have picked it up again before we got the lock.
+    if( itr->second->ref_count.load() != 0 )
+        return;
+
     auto& to_destroy = *itr->second;
     m_registry_lookup_.erase( itr );
 
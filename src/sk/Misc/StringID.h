@@ -6,6 +6,7 @@
 #include <sk/Misc/Singleton.h>
 
 #include <atomic>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -68,6 +69,9 @@ namespace sk
         index_vec_t    m_available_spots_;
         registry_vec_t m_registries_;
         registry_map_t m_registry_lookup_;
+
+        // String ids are created from multiple threads, like when loading asset metas in parallel.
+        std::mutex m_registry_mtx_;
     };
 
 ////////////////////////////////////////////////
@@ -0,0 +1,228 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include <sk/Debugging/Debugging.h>
+#include <sk/Misc/Future.h>
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+namespace sk
+{
+	template< class Ty = void >
+	class cTask;
+} // sk::
+
+namespace sk::Async
+{
+	struct sTask_Promise_Base
+	{
+		// Resumed once the task is done. Nothing will be resumed if the task was never awaited.
+		std::coroutine_handle<> continuation = std::noop_coroutine();
+
+		// Set by whichever comes first of the awaiter suspending and the task finishing, the second one resumes the awaiter.
+		// Tasks finishing inline return to the awaiter instead of resuming it on top of their own frame,
+		// as symmetric transfer is only a tail call in optimized builds and long chains would run out of stack otherwise.
+		std::atomic_bool handed_over = false;
+
+		struct sFinal_Awaiter
+		{
+			[[ nodiscard ]] bool await_ready() const noexcept { return false; }
+
+			template< class Promise >
+			void await_suspend( std::coroutine_handle< Promise > _handle ) const noexcept
+			{
+				// The awaiter may destroy this frame as soon as it's resumed, so nothing can be touched afterwards.
+				if( _handle.promise().handed_over.exchange( true, std::memory_order_acq_rel ) )
+					_handle.promise().continuation.resume();
+			}
+
+			void await_resume() const noexcept {}
+		};
+
+		// Tasks are lazy, they won't start until they're awaited or started.
+		[[ nodiscard ]] auto initial_suspend() const noexcept { return std::suspend_always{}; }
+		[[ nodiscard ]] auto final_suspend  () const noexcept { return sFinal_Awaiter{}; }
+
+		void unhandled_exception() const noexcept
+		{
+			SK_BREAK;
+			std::terminate();
+		}
+	};
+
+	template< class Ty >
+	struct sTask_Promise : sTask_Promise_Base
+	{
+		auto get_return_object() -> cTask< Ty >;
+
+		template< class Value >
+		void return_value( Value&& _value ){ value.emplace( std::forward< Value >( _value ) ); }
+
+		std::optional< Ty > value;
+	};
+
+	template<>
+	struct sTask_Promise< void > : sTask_Promise_Base
+	{
+		auto get_return_object() -> cTask< void >;
+
+		void return_void() const noexcept {}
+	};
+
+	// Fire and forget coroutine, the frame destroys itself when it's done.
+	struct sDetached
+	{
+		struct promise_type
+		{
+			[[ nodiscard ]] auto get_return_object() const noexcept { return sDetached{}; }
+			[[ nodiscard ]] auto initial_suspend  () const noexcept { return std::suspend_never{}; }
+			[[ nodiscard ]] auto final_suspend    () const noexcept { return std::suspend_never{}; }
+
+			void return_void() const noexcept {}
+			void unhandled_exception() const noexcept
+			{
+				SK_BREAK;
+				std::terminate();
+			}
+		};
+	};
+} // sk::Async::
+
+namespace sk
+{
+	// Lazily started coroutine. Awaiting it will start it on the current thread and resume the awaiter once it's done.
+	// Which thread it's running on is decided by what it awaits, like cAsset_Job_Manager::ResumeOnWorker.
+	template< class Ty >
+	class cTask
+	{
+	public:
+		using promise_type = Async::sTask_Promise< Ty >;
+		using handle_t     = std::coroutine_handle< promise_type >;
+		using value_t      = Ty;
+
+		cTask() = default;
+		explicit cTask( const handle_t _handle ) : m_handle_( _handle ) {}
+		cTask( cTask&& _other ) noexcept : m_handle_( std::exchange( _other.m_handle_, nullptr ) ) {}
+		cTask( const cTask& ) = delete;
+		~cTask()
+		{
+			if( m_handle_ )
+				m_handle_.destroy();
+		}
+
+		auto operator=( cTask&& _other ) noexcept -> cTask&
+		{
+			if( &_other == this )
+				return *this;
+
+			if( m_handle_ )
+				m_handle_.destroy();
+			m_handle_ = std::exchange( _other.m_handle_, nullptr );
+
+			return *this;
+		}
+		auto operator=( const cTask& ) -> cTask& = delete;
+
+		[[ nodiscard ]] bool IsValid() const { return static_cast< bool >( m_handle_ ); }
+		[[ nodiscard ]] bool IsDone () const { return !IsValid() || m_handle_.done(); }
+
+		// Starts the task on the current thread. The task will keep itself alive until it's done.
+		auto Start() && -> cFuture< Ty >;
+
+		auto operator co_await() const noexcept
+		{
+			struct sAwaiter
+			{
+				handle_t handle;
+
+				[[ nodiscard ]] bool await_ready() const noexcept { return !handle || handle.done(); }
+
+				// Runs the task until it either finishes or suspends. Returning false resumes the awaiter right away.
+				bool await_suspend( const std::coroutine_handle<> _awaiting ) const noexcept
+				{
+					handle.promise().continuation = _awaiting;
+					handle.resume();
+					return !handle.promise().handed_over.exchange( true, std::memory_order_acq_rel );
+				}
+
+				auto await_resume() const -> Ty
+				{
+					if constexpr( !std::is_void_v< Ty > )
+						return std::move( *handle.promise().value );
+				}
+			};
+
+			return sAwaiter{ m_handle_ };
+		}
+
+	private:
+		handle_t m_handle_ = nullptr;
+	};
+
+	template< class Ty >
+	auto Async::sTask_Promise< Ty >::get_return_object() -> cTask< Ty >
+	{
+		return cTask< Ty >{ cTask< Ty >::handle_t::from_promise( *this ) };
+	}
+
+	inline auto Async::sTask_Promise< void >::get_return_object() -> cTask< void >
+	{
+		return cTask< void >{ cTask< void >::handle_t::from_promise( *this ) };
+	}
+
+	namespace Async
+	{
+		template< class Ty >
+		auto run_detached( cTask< Ty > _task, cPromise< Ty > _promise ) -> sDetached
+		{
+			if constexpr( std::is_void_v< Ty > )
+			{
+				co_await _task;
+				_promise.SetReady();
+			}
+			else
+				_promise.SetValue( co_await _task );
+		}
+	} // Async::
+
+	template< class Ty >
+	auto cTask< Ty >::Start() && -> cFuture< Ty >
+	{
+		cPromise< Ty > promise;
+		auto future = promise.GetFuture();
+
+		Async::run_detached( std::move( *this ), std::move( promise ) );
+
+		return future;
+	}
+
+	// Resumes the awaiting coroutine on the thread completing the future. Doesn't suspend if it's already ready.
+	template< class Ty >
+	auto operator co_await( const cFuture< Ty >& _future )
+	{
+		struct sAwaiter
+		{
+			cFuture< Ty > future;
+
+			[[ nodiscard ]] bool await_ready() const { return future.IsReady(); }
+
+			void await_suspend( const std::coroutine_handle<> _handle ) const
+			{
+				future.OnReady( [ _handle ]{ _handle.resume(); } );
+			}
+
+			decltype( auto ) await_resume() const { return future.Get(); }
+		};
+
+		return sAwaiter{ _future };
+	}
+} // sk::
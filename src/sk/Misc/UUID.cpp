@@ -71,8 +71,9 @@ namespace sk
     
     cUUID GenerateRandomUUID()
     {
-        static std::random_device rd;
-        static std::mt19937_64    gen{ rd() };
+        // One generator per thread, as objects can be built on the asset workers.
+        thread_local std::random_device rd;
+        thread_local std::mt19937_64    gen{ rd() };
         
         const auto low  = gen();
         const auto high = gen();
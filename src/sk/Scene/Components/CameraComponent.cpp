@@ -41,16 +41,20 @@ namespace sk::Object::Components
 	{
 		Scene::cCameraManager::get().setCameraEnabled( get_shared().Cast< cCameraComponent >(), false );
 	} // disabled
-	void cCameraComponent::update( void )
-	{
-		m_transform_->Update();
-		m_transform_->GetWorld().inversed( m_view_proj_inv );
-		m_view_proj_inv = m_view_proj_inv * m_projection;
-	} // update
-
 	void cCameraComponent::calculateProjectionMatrix( void )
 	{
-		m_projection = Math::Matrix4x4::AspectPerspective( m_camera_settings.aspect, m_camera_settings.fov, m_camera_settings.near, m_camera_settings.far );
+		m_projection   = Math::Matrix4x4::AspectPerspective( m_camera_settings.aspect, m_camera_settings.fov, m_camera_settings.near, m_camera_settings.far );
+		m_view_version = std::numeric_limits< uint32_t >::max();
 	} // calculateProjectionMatrix
+
+	void cCameraComponent::refresh( void ) const
+	{
+		if( m_view_version == m_transform_->GetVersion() )
+			return;
+
+		m_view_proj_inv = m_transform_->GetInverseWorld() * m_projection;
+		m_frustum       = cFrustumf( m_view_proj_inv );
+		m_view_version  = m_transform_->GetVersion();
+	} // refresh
 } // sk::Object::Components::
 
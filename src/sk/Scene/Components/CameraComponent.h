@@ -12,6 +12,7 @@
 #include <sk/Graphics/Rendering/Render_Target.h>
 #include <sk/Graphics/Rendering/Scissor.h>
 #include <sk/Graphics/Rendering/Viewport.h>
+#include <sk/Math/Frustum.h>
 #include <sk/Math/Matrix4x4.h>
 
 namespace sk::Scene
@@ -50,15 +51,16 @@ namespace sk::Object::Components
 
 		void renderAuto( void ){ if( m_render_target ) renderTo( *m_render_target ); }
 
-		void update( void ) override;
-
 		auto& getViewport( void )       { return m_viewport; }
 		auto& getViewport( void ) const { return m_viewport; }
 		auto& getScissor ( void )       { return m_scissor;  }
 		auto& getScissor ( void ) const { return m_scissor;  }
 
-		auto& getViewProjInv( void ) const { return m_view_proj_inv; }
+		// Recomputed whenever the transform has a new version, so it's never a frame behind the hierarchy.
+		auto& getViewProjInv( void ) const { refresh(); return m_view_proj_inv; }
 		auto& getProjection ( void ) const { return m_projection; }
+		// World space, updated along with the view projection.
+		auto& GetFrustum    ( void ) const { refresh(); return m_frustum; }
 		
 		auto  GetLayers() const { return m_layers_; }
 		
@@ -67,6 +69,7 @@ namespace sk::Object::Components
 	private:
 
 		void calculateProjectionMatrix( void );
+		void refresh( void ) const;
 
 		sCameraSettings m_camera_settings;
 
@@ -77,8 +80,11 @@ namespace sk::Object::Components
 		Graphics::sScissor  m_scissor;
 
 		// TODO: Rename to view_proj as view is the inverted world.
-		cMatrix4x4f m_view_proj_inv;
-		cMatrix4x4f m_projection;
+		mutable cMatrix4x4f m_view_proj_inv;
+		cMatrix4x4f         m_projection;
+		mutable cFrustumf   m_frustum;
+		// The transform version the view projection was computed from.
+		mutable uint32_t    m_view_version = std::numeric_limits< uint32_t >::max();
 
 		eType m_type;
 		
@@ -13,6 +13,7 @@
 #include <sk/Misc/UUID.h>
 #include <sk/Reflection/RuntimeClass.h>
 #include <sk/Scene/Managers/EventManager.h>
+#include <sk/Scene/Staging.h>
 
 namespace sk::Object
 {
@@ -30,7 +31,7 @@ namespace sk::Object
 		iComponent()
 		{
 			m_self_      = get_weak();
-			m_transform_ = sk::make_shared< cTransform >();
+			m_transform_ = sk::make_pooled< cTransform >();
 		}
 	public:
 
@@ -70,6 +71,7 @@ namespace sk::Object
 		[[ nodiscard ]]
 		auto& GetRotation() const { return m_transform_->GetRotation(); }
 		void  SetRotation( const cVector3f& _rotation ){ m_transform_->SetRotation( _rotation ); }
+		void  SetRotation( const cQuaternionf& _rotation ){ m_transform_->SetRotation( _rotation ); }
 
 		[[ nodiscard ]]
 		auto& GetScale()       { return m_transform_->GetScale(); }
@@ -111,6 +113,8 @@ namespace sk::Object
 		std::vector< cShared_ptr< iComponent > > m_children_ = { }; // TODO: Add get children function
 
 	private: // TODO: Move parts to cpp, find way to make actual constexpr
+		// Staged components register their events once their object is committed.
+		virtual void register_events() = 0;
 		
 		cUUID m_uuid_     = {};
 		bool  m_enabled_  = true;
@@ -146,7 +150,8 @@ namespace sk::Object
 		// Registers all overriden events as callable events.
 		cComponent()
 		{
-			register_events();
+			if( !Scene::IsStaging() )
+				register_events();
 		} // cComponent
 	public:
 
@@ -180,20 +185,12 @@ namespace sk::Object
 		} // postEvent
 
 	private:
-		void update_internal()
+		void register_events() final
 		{
-			if constexpr( kEventMask & kUpdate )
-			{
-				update();
-			}
-			
-			if( m_transform_->IsDirty() )
-				m_transform_->Update();
-		}
-		
-		void register_events()
-		{
-			RegisterListener( kUpdate, &cComponent::update_internal );
+			// Staged transforms stay out of the hierarchy until the commit, as the worker building them might still be using them.
+			m_transform_->Attach();
+
+			if constexpr( kEventMask & kUpdate      ) RegisterListener( kUpdate,      &Ty::update       );
 			if constexpr( kEventMask & kRender      ) RegisterListener( kRender,      &Ty::render       );
 			if constexpr( kEventMask & kDebugRender ) RegisterListener( kDebugRender, &Ty::debug_render );
 		} // register_events
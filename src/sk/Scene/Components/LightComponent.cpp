@@ -32,13 +32,13 @@ cLightComponent::~cLightComponent()
     Scene::cLight_Manager::get().unregister_light( get_weak().Cast< cLightComponent >() );
 }
 
-void cLightComponent::update()
+void cLightComponent::sync_transform()
 {
-    if( m_transform_->IsDirty() )
-    {
-        m_transform_->Update();
-        update_data();
-    }
+    if( m_transform_version_ == m_transform_->GetVersion() )
+        return;
+
+    m_transform_version_ = m_transform_->GetVersion();
+    update_data();
 }
 
 auto cLightComponent::GetSettings() const -> const settings_t&
@@ -96,8 +96,6 @@ namespace sk::Object::Components
         explicit cLightComponent( const settings_t& _settings = {} );
         ~cLightComponent() override;
         
-        void update() override;
-        
         // TODO: Add more functions to get/set values inside of the settings.
         [[ nodiscard ]]
         auto GetSettings() const -> const settings_t&;
@@ -121,6 +119,8 @@ namespace sk::Object::Components
         void fix_spot_data( Scene::Light::sSpotLight& _data ) const;
         
         void update_data();
+        // Called by the light manager after the transforms are updated, as the light only has to follow its transform.
+        void sync_transform();
         
         void init_data();
         
@@ -131,6 +131,7 @@ namespace sk::Object::Components
         
         settings_t m_settings_;
         
+        uint32_t m_transform_version_ = std::numeric_limits< uint32_t >::max();
         uint32_t m_registered_index_  = std::numeric_limits< uint32_t >::max();
         uint32_t m_shadow_data_index_ = std::numeric_limits< uint32_t >::max();
         uint32_t m_data_index_        = std::numeric_limits< uint32_t >::max();
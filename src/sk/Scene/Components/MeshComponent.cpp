@@ -6,6 +6,8 @@
 
 #include "MeshComponent.h"
 
+#include <sk/Scene/Managers/Layer_Manager.h>
+
 namespace sk::Object::Components
 {
 	cMeshComponent::cMeshComponent( const cShared_ptr< cAsset_Meta >& _mesh, const cShared_ptr< cAsset_Meta >& _material )
@@ -15,6 +17,12 @@ namespace sk::Object::Components
 		m_mesh_.SetAsset( _mesh );
 		m_material_.SetAsset( _material );
 	}
+
+	cMeshComponent::~cMeshComponent()
+	{
+		if( const auto layer_manager = Scene::cLayer_Manager::getPtr() )
+			layer_manager->RemoveMesh( *this );
+	}
 	
 	void cMeshComponent::enabled()
 	{
@@ -50,10 +58,26 @@ namespace sk::Object::Components
 	void cMeshComponent::SetMesh( const cShared_ptr< cAsset_Meta >& _mesh )
 	{
 		m_mesh_.SetAsset( _mesh );
+
+		// The world bounds come from the mesh, marking the transform lets anything following it know they've changed.
+		m_transform_->MarkDirty();
 	}
 
 	void cMeshComponent::SetMaterial( const cShared_ptr< cAsset_Meta >& _material )
 	{
 		m_material_.SetAsset( _material );
 	}
+
+	auto cMeshComponent::UpdateBounds() -> const cAABBf&
+	{
+		auto& transform = GetTransform();
+
+		if( const auto mesh = GetMesh(); mesh != m_bounds_mesh_ )
+		{
+			m_bounds_mesh_ = mesh;
+			transform.SetLocalBounds( mesh != nullptr ? mesh->GetBounds() : cAABBf{} );
+		}
+
+		return transform.GetWorldBounds();
+	}
 } // sk::Object::Components
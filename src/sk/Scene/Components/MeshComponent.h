@@ -19,6 +19,7 @@ namespace sk::Assets
 namespace sk::Scene
 {
 	class cCameraManager;
+	class cLayer_Manager;
 } // sk::Scene
 
 namespace sk::Object::Components
@@ -27,7 +28,10 @@ namespace sk::Object::Components
 	{
 		SK_CLASS_BODY( MeshComponent )
 	public:
+		static constexpr size_t kNoLayer = std::numeric_limits< size_t >::max();
+
 		explicit cMeshComponent( const cShared_ptr< cAsset_Meta >& _mesh, const cShared_ptr< cAsset_Meta >& _material );
+		~cMeshComponent() override;
 
 		void enabled() override;
 		void disabled() override;
@@ -38,9 +42,21 @@ namespace sk::Object::Components
 		void SetMesh( const cShared_ptr< cAsset_Meta >& _mesh );
 		void SetMaterial( const cShared_ptr< cAsset_Meta >& _material );
 
+		// Gives the transform the bounds of the current mesh and returns them in world space.
+		auto UpdateBounds() -> const cAABBf&;
+
 	private:
 		cAsset_Ptr< Assets::cMesh >     m_mesh_;
 		cAsset_Ptr< Assets::cMaterial > m_material_;
+
+		// The mesh the transform got its bounds from.
+		const Assets::cMesh* m_bounds_mesh_ = nullptr;
+
+		// Where the mesh is in the layer managers dense arrays.
+		size_t m_layer_index_ = kNoLayer;
+		size_t m_layer_slot_  = kNoLayer;
+
+		friend class Scene::cLayer_Manager;
 	};
 } // sk::Object::Components
 
@@ -11,9 +11,6 @@ cSpinComponent::cSpinComponent( cVector3f _speed )
 
 void cSpinComponent::update()
 {
-    GetTransform().GetRotation() += m_speed_ * Time::Delta;
-    GetTransform().MarkDirty();
-
-    for( auto& child : m_children_ )
-        child->GetTransform().MarkDirty();
+    // The children follow along when the hierarchy is updated.
+    GetTransform().Rotate( m_speed_ * Time::Delta );
 }
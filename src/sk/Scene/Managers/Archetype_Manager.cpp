@@ -0,0 +1,198 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Archetype_Manager.h"
+
+#include <sk/Scene/Object.h>
+
+#include <new>
+
+using namespace sk::Scene;
+
+namespace
+{
+    constexpr size_t align_up( const size_t _value, const size_t _alignment )
+    {
+        return ( _value + _alignment - 1 ) & ~( _alignment - 1 );
+    }
+} // ::
+
+cArchetype::cArchetype( std::vector< Archetype::sColumn_Info > _columns )
+: m_columns_( std::move( _columns ) )
+{
+    size_t row_size  = sizeof( Object::iObject* );
+    size_t alignment = 0;
+    for( auto& column : m_columns_ )
+    {
+        row_size  += column.size;
+        alignment += column.alignment;
+    }
+
+    // Large components still get at least a single row per chunk.
+    m_chunk_bytes_    = std::max( kChunkSize, row_size + alignment );
+    m_chunk_capacity_ = ( m_chunk_bytes_ - alignment ) / row_size;
+
+    // The objects are always the first column.
+    size_t offset = m_chunk_capacity_ * sizeof( Object::iObject* );
+    m_column_offsets_.reserve( m_columns_.size() );
+    for( auto& column : m_columns_ )
+    {
+        offset = align_up( offset, column.alignment );
+        m_column_offsets_.emplace_back( offset );
+        offset += m_chunk_capacity_ * column.size;
+    }
+}
+
+cArchetype::~cArchetype()
+{
+    for( size_t row = 0; row < m_size_; row++ )
+    {
+        for( size_t column = 0; column < m_columns_.size(); column++ )
+            m_columns_[ column ].destroy( GetElement( row, column ) );
+    }
+
+    for( const auto chunk : m_chunks_ )
+        ::operator delete( chunk, std::align_val_t{ kChunkAlignment } );
+}
+
+auto cArchetype::GetColumnIndex( const type_hash _type ) const -> size_t
+{
+    // Archetypes rarely have more than a handful of components, so a linear search beats anything fancier.
+    for( size_t i = 0; i < m_columns_.size(); i++ )
+    {
+        if( m_columns_[ i ].type == _type )
+            return i;
+    }
+
+    return Archetype::kInvalidColumn;
+}
+
+auto cArchetype::GetChunkSize( const size_t _chunk ) const -> size_t
+{
+    const auto first = _chunk * m_chunk_capacity_;
+    if( m_size_ <= first )
+        return 0;
+
+    return std::min( m_chunk_capacity_, m_size_ - first );
+}
+
+auto cArchetype::GetColumn( const size_t _chunk, const size_t _column ) const -> std::byte*
+{
+    return m_chunks_[ _chunk ] + m_column_offsets_[ _column ];
+}
+
+auto cArchetype::GetObjects( const size_t _chunk ) const -> Object::iObject**
+{
+    return reinterpret_cast< Object::iObject** >( m_chunks_[ _chunk ] );
+}
+
+auto cArchetype::GetElement( const size_t _row, const size_t _column ) const -> std::byte*
+{
+    return GetColumn( _row / m_chunk_capacity_, _column ) + ( _row % m_chunk_capacity_ ) * m_columns_[ _column ].size;
+}
+
+auto cArchetype::push_row( Object::iObject* _object ) -> size_t
+{
+    const auto row = m_size_++;
+    if( row / m_chunk_capacity_ >= m_chunks_.size() )
+        m_chunks_.emplace_back( static_cast< std::byte* >( ::operator new( m_chunk_bytes_, std::align_val_t{ kChunkAlignment } ) ) );
+
+    GetObjects( row / m_chunk_capacity_ )[ row % m_chunk_capacity_ ] = _object;
+
+    return row;
+}
+
+auto cArchetype::pop_row( const size_t _row ) -> Object::iObject*
+{
+    const auto last = --m_size_;
+
+    Object::iObject* moved = nullptr;
+    if( _row != last )
+    {
+        for( size_t column = 0; column < m_columns_.size(); column++ )
+            m_columns_[ column ].move( GetElement( _row, column ), GetElement( last, column ) );
+
+        moved = GetObjects( last / m_chunk_capacity_ )[ last % m_chunk_capacity_ ];
+        GetObjects( _row / m_chunk_capacity_ )[ _row % m_chunk_capacity_ ] = moved;
+    }
+
+    // Keeps a single empty chunk around to avoid reallocating when objects move back and forth.
+    if( m_chunks_.size() > 1 && m_size_ <= ( m_chunks_.size() - 2 ) * m_chunk_capacity_ )
+    {
+        ::operator delete( m_chunks_.back(), std::align_val_t{ kChunkAlignment } );
+        m_chunks_.pop_back();
+    }
+
+    return moved;
+}
+
+void cArchetype_Manager::RemoveObject( Object::iObject& _object )
+{
+    auto& [ archetype, row ] = location( _object );
+    if( archetype == nullptr )
+        return;
+
+    for( size_t column = 0; column < archetype->GetColumns().size(); column++ )
+        archetype->GetColumns()[ column ].destroy( archetype->GetElement( row, column ) );
+
+    remove_row( *archetype, row );
+
+    archetype = nullptr;
+    row       = 0;
+}
+
+auto cArchetype_Manager::get_or_create( columns_t _columns ) -> cArchetype&
+{
+    std::ranges::sort( _columns, []( const auto& _a, const auto& _b ){ return _a.type.value() < _b.type.value(); } );
+
+    uint64_t key = Hashing::val_64_const;
+    for( auto& column : _columns )
+        key = ( key ^ column.type.value() ) * Hashing::prime_64_const;
+
+    auto& archetype = m_archetypes_[ key ];
+    if( archetype == nullptr )
+        archetype = std::make_unique< cArchetype >( std::move( _columns ) );
+
+    return *archetype;
+}
+
+auto cArchetype_Manager::move_object( Object::iObject& _object, cArchetype& _target ) -> size_t
+{
+    auto& [ archetype, row ] = location( _object );
+
+    const auto new_row = _target.push_row( &_object );
+
+    if( archetype != nullptr )
+    {
+        auto& columns = archetype->GetColumns();
+        for( size_t column = 0; column < columns.size(); column++ )
+        {
+            const auto element = archetype->GetElement( row, column );
+            if( const auto target_column = _target.GetColumnIndex( columns[ column ].type ); target_column != Archetype::kInvalidColumn )
+                columns[ column ].move( _target.GetElement( new_row, target_column ), element );
+            else
+                columns[ column ].destroy( element );
+        }
+
+        remove_row( *archetype, row );
+    }
+
+    archetype = &_target;
+    row       = new_row;
+
+    return new_row;
+}
+
+void cArchetype_Manager::remove_row( cArchetype& _archetype, const size_t _row )
+{
+    if( const auto moved = _archetype.pop_row( _row ) )
+        location( *moved ).row = _row;
+}
+
+auto cArchetype_Manager::location( const Object::iObject& _object ) -> sArchetype_Location&
+{
+    return const_cast< Object::iObject& >( _object ).m_archetype_location_;
+}
@@ -0,0 +1,283 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include <sk/Containers/Map.h>
+#include <sk/Misc/Singleton.h>
+#include <sk/Reflection/Types.h>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <tuple>
+#include <vector>
+
+namespace sk
+{
+    class cTransform;
+} // sk::
+
+namespace sk::Object
+{
+    class iObject;
+    class iComponent;
+} // sk::Object::
+
+namespace sk::Scene
+{
+    class cArchetype;
+
+    struct sArchetype_Location
+    {
+        cArchetype* archetype = nullptr;
+        size_t      row       = 0;
+    };
+
+    namespace Archetype
+    {
+        // Components and transforms are owned and referenced elsewhere, so only a pointer to them can be stored.
+        // Everything else is stored by value.
+        template< class Ty >
+        constexpr bool kStoredByPointer = std::is_base_of_v< Object::iComponent, Ty > || std::is_same_v< Ty, cTransform >;
+
+        template< class Ty >
+        using stored_t = std::conditional_t< kStoredByPointer< Ty >, Ty*, Ty >;
+
+        // Plain data components don't have to be reflected, but they have to be registered with REGISTER_TYPE to get an id.
+        template< class Ty >
+        constexpr auto GetColumnType() -> type_hash
+        {
+            static_assert( kTypeId< Ty > != kInvalid_Id, "Data components have to be registered with REGISTER_TYPE." );
+            return kTypeId< Ty >;
+        }
+
+        struct sColumn_Info
+        {
+            type_hash type;
+            size_t    size;
+            size_t    alignment;
+            // Move constructs the destination and destroys the source.
+            void( *move    )( void* _destination, void* _source );
+            void( *destroy )( void* _element );
+
+            template< class Ty >
+            static constexpr auto Create() -> sColumn_Info
+            {
+                using value_t = stored_t< Ty >;
+                return sColumn_Info{
+                    .type      = GetColumnType< Ty >(),
+                    .size      = sizeof( value_t ),
+                    .alignment = alignof( value_t ),
+                    .move      = []( void* _destination, void* _source )
+                    {
+                        auto& source = *static_cast< value_t* >( _source );
+                        std::construct_at( static_cast< value_t* >( _destination ), std::move( source ) );
+                        std::destroy_at( &source );
+                    },
+                    .destroy   = []( void* _element ){ std::destroy_at( static_cast< value_t* >( _element ) ); },
+                };
+            }
+        };
+
+        constexpr size_t kInvalidColumn = std::numeric_limits< size_t >::max();
+    } // Archetype::
+
+    // Every object with the same set of components shares an archetype.
+    // The components are stored column by column in fixed size chunks, so iterating a single component is linear.
+    class cArchetype
+    {
+        friend class cArchetype_Manager;
+    public:
+        static constexpr size_t kChunkSize      = 16 * 1024;
+        static constexpr size_t kChunkAlignment = 64;
+
+        // The columns have to be sorted by their type.
+        explicit cArchetype( std::vector< Archetype::sColumn_Info > _columns );
+        ~cArchetype();
+
+        cArchetype( const cArchetype& ) = delete;
+        cArchetype& operator=( const cArchetype& ) = delete;
+
+        [[ nodiscard ]] auto& GetColumns() const { return m_columns_; }
+        [[ nodiscard ]] auto  GetColumnIndex( type_hash _type ) const -> size_t;
+        [[ nodiscard ]] bool  HasColumn     ( const type_hash _type ) const { return GetColumnIndex( _type ) != Archetype::kInvalidColumn; }
+
+        [[ nodiscard ]] auto GetSize         () const { return m_size_; }
+        [[ nodiscard ]] auto GetChunkCount   () const { return m_chunks_.size(); }
+        [[ nodiscard ]] auto GetChunkCapacity() const { return m_chunk_capacity_; }
+        // The amount of rows used in the chunk.
+        [[ nodiscard ]] auto GetChunkSize    ( size_t _chunk ) const -> size_t;
+
+        [[ nodiscard ]] auto GetColumn ( size_t _chunk, size_t _column ) const -> std::byte*;
+        [[ nodiscard ]] auto GetObjects( size_t _chunk ) const -> Object::iObject**;
+        [[ nodiscard ]] auto GetElement( size_t _row, size_t _column ) const -> std::byte*;
+
+    private:
+        // Returns the new row. The columns are left uninitialized.
+        auto push_row( Object::iObject* _object ) -> size_t;
+        // Moves the last row into the removed one, the elements in the removed row have to be destroyed or moved out first.
+        // Returns the object that got moved, or nullptr if it was the last row.
+        auto pop_row( size_t _row ) -> Object::iObject*;
+
+        std::vector< Archetype::sColumn_Info > m_columns_;
+        std::vector< size_t >                  m_column_offsets_;
+        std::vector< std::byte* >              m_chunks_;
+
+        size_t m_chunk_bytes_;
+        size_t m_chunk_capacity_;
+        size_t m_size_ = 0;
+    };
+
+    // Optional storage backend for object components. Objects are only added if the manager is initialized.
+    class cArchetype_Manager : public cSingleton< cArchetype_Manager >
+    {
+    public:
+        template< class Ty, class... Args >
+        auto Add( Object::iObject& _object, Args&&... _args ) -> Archetype::stored_t< Ty >&;
+        template< class Ty >
+        void Remove( Object::iObject& _object );
+        template< class Ty >
+        [[ nodiscard ]] auto Get( const Object::iObject& _object ) const -> Archetype::stored_t< Ty >*;
+
+        void RemoveObject( Object::iObject& _object );
+
+        // Calls _function with a reference to every requested component, for every object having all of them.
+        // The function can take the object as its first argument. Objects can't change components while iterating.
+        template< class... Ty, class Fn >
+        void ForEach( Fn&& _function );
+
+        [[ nodiscard ]] auto GetArchetypeCount() const { return m_archetypes_.size(); }
+
+    private:
+        using columns_t = std::vector< Archetype::sColumn_Info >;
+
+        auto get_or_create( columns_t _columns ) -> cArchetype&;
+        // Moves the object to the target, destroying any components the target doesn't have. Returns the new row.
+        auto move_object( Object::iObject& _object, cArchetype& _target ) -> size_t;
+        void remove_row ( cArchetype& _archetype, size_t _row );
+
+        static auto location( const Object::iObject& _object ) -> sArchetype_Location&;
+
+        template< class... Ty, class Fn, size_t... I >
+        static void for_each_in_chunk( const cArchetype& _archetype, size_t _chunk, const size_t* _columns, Fn& _function, std::index_sequence< I... > );
+
+        template< class Ty >
+        static auto& deref( Archetype::stored_t< Ty >& _element )
+        {
+            if constexpr( Archetype::kStoredByPointer< Ty > )
+                return *_element;
+            else
+                return _element;
+        }
+
+        unordered_map< uint64_t, std::unique_ptr< cArchetype > > m_archetypes_;
+    };
+
+    template< class Ty, class... Args >
+    auto cArchetype_Manager::Add( Object::iObject& _object, Args&&... _args ) -> Archetype::stored_t< Ty >&
+    {
+        using value_t = Archetype::stored_t< Ty >;
+        constexpr auto type = Archetype::GetColumnType< Ty >();
+
+        auto& [ archetype, row ] = location( _object );
+
+        // Already has the component, so we replace it.
+        if( archetype != nullptr )
+        {
+            if( const auto column = archetype->GetColumnIndex( type ); column != Archetype::kInvalidColumn )
+            {
+                auto& element = *reinterpret_cast< value_t* >( archetype->GetElement( row, column ) );
+                element = value_t( std::forward< Args >( _args )... );
+                return element;
+            }
+        }
+
+        columns_t columns = archetype != nullptr ? archetype->GetColumns() : columns_t{};
+        columns.emplace_back( Archetype::sColumn_Info::Create< Ty >() );
+
+        auto& target   = get_or_create( std::move( columns ) );
+        const auto new_row = move_object( _object, target );
+
+        const auto element = reinterpret_cast< value_t* >( target.GetElement( new_row, target.GetColumnIndex( type ) ) );
+        return *std::construct_at( element, std::forward< Args >( _args )... );
+    }
+
+    template< class Ty >
+    void cArchetype_Manager::Remove( Object::iObject& _object )
+    {
+        constexpr auto type = Archetype::GetColumnType< Ty >();
+
+        const auto archetype = location( _object ).archetype;
+        if( archetype == nullptr || !archetype->HasColumn( type ) )
+            return;
+
+        if( archetype->GetColumns().size() == 1 )
+        {
+            RemoveObject( _object );
+            return;
+        }
+
+        columns_t columns = archetype->GetColumns();
+        std::erase_if( columns, [ & ]( const Archetype::sColumn_Info& _column ){ return _column.type == type; } );
+
+        move_object( _object, get_or_create( std::move( columns ) ) );
+    }
+
+    template< class Ty >
+    auto cArchetype_Manager::Get( const Object::iObject& _object ) const -> Archetype::stored_t< Ty >*
+    {
+        const auto& [ archetype, row ] = location( _object );
+        if( archetype == nullptr )
+            return nullptr;
+
+        const auto column = archetype->GetColumnIndex( Archetype::GetColumnType< Ty >() );
+        if( column == Archetype::kInvalidColumn )
+            return nullptr;
+
+        return reinterpret_cast< Archetype::stored_t< Ty >* >( archetype->GetElement( row, column ) );
+    }
+
+    template< class... Ty, class Fn >
+    void cArchetype_Manager::ForEach( Fn&& _function )
+    {
+        static constexpr type_hash kTypes[] = { Archetype::GetColumnType< Ty >()... };
+
+        for( auto& archetype : m_archetypes_ | std::views::values )
+        {
+            size_t columns[ sizeof...( Ty ) ];
+            bool   matches = true;
+            for( size_t i = 0; i < sizeof...( Ty ) && matches; i++ )
+            {
+                columns[ i ] = archetype->GetColumnIndex( kTypes[ i ] );
+                matches      = columns[ i ] != Archetype::kInvalidColumn;
+            }
+
+            if( !matches )
+                continue;
+
+            for( size_t chunk = 0; chunk < archetype->GetChunkCount(); chunk++ )
+                for_each_in_chunk< Ty... >( *archetype, chunk, columns, _function, std::index_sequence_for< Ty... >{} );
+        }
+    }
+
+    template< class... Ty, class Fn, size_t... I >
+    void cArchetype_Manager::for_each_in_chunk( const cArchetype& _archetype, const size_t _chunk, const size_t* _columns, Fn& _function, std::index_sequence< I... > )
+    {
+        const auto count   = _archetype.GetChunkSize( _chunk );
+        const auto objects = _archetype.GetObjects( _chunk );
+        const auto data    = std::tuple{ reinterpret_cast< Archetype::stored_t< Ty >* >( _archetype.GetColumn( _chunk, _columns[ I ] ) )... };
+
+        for( size_t i = 0; i < count; i++ )
+        {
+            if constexpr( std::is_invocable_v< Fn&, Object::iObject&, Ty&... > )
+                _function( *objects[ i ], deref< Ty >( std::get< I >( data )[ i ] )... );
+            else
+                _function( deref< Ty >( std::get< I >( data )[ i ] )... );
+        }
+    }
+} // sk::Scene::
@@ -1,36 +1,63 @@
 ﻿
 #include "Layer_Manager.h"
 
+#include <sk/Scene/Components/MeshComponent.h>
 #include <sk/Scene/Components/Internal/Layer_Component.h>
 
+#include <bit>
+
+sk::Scene::cLayer_Manager::cObjectIterator::cObjectIterator( const vector< sLayer >& _layers, const uint64_t _mask, const size_t _layer_index )
+: m_layers_{ &_layers }
+, m_mask_{ _mask }
+, m_layer_index_{ _layer_index }
+{
+    skipEmpty();
+}
+
 auto sk::Scene::cLayer_Manager::cObjectIterator::operator++() -> cObjectIterator&
 {
-    if( ++m_object_index_ >= getObjects().size() )
-    {
-        m_layer_index_++;
-        m_object_index_ = 0;
-    }
+    m_object_index_++;
+    skipEmpty();
                 
     return *this;
 }
 
 auto sk::Scene::cLayer_Manager::cObjectIterator::operator--() -> cObjectIterator&
 {
-    if( m_object_index_ == 0 )
+    if( m_object_index_ > 0 )
+    {
+        m_object_index_--;
+        return *this;
+    }
+
+    // Back to the last object of the closest layer below with any.
+    // This should cap the iterator at the first object.
+    auto below = m_mask_ & ( m_layer_index_ >= kEnd ? ~0ull : ( 1ull << m_layer_index_ ) - 1 );
+    while( below != 0 )
     {
-        // This should cap the iterator at the end.
-        if( m_layer_index_ > 0 )
+        const auto layer_index = static_cast< size_t >( std::bit_width( below ) - 1 );
+        if( const auto size = ( *m_layers_ )[ layer_index ].objects.size(); size > 0 )
         {
-            m_layer_index_--;
-            m_object_index_ = getObjects().size() - 1;
+            m_layer_index_  = layer_index;
+            m_object_index_ = size - 1;
+            break;
         }
+        below &= ~( 1ull << layer_index );
     }
-    else
-        m_object_index_--;
                 
     return *this;
 }
 
+void sk::Scene::cLayer_Manager::cObjectIterator::skipEmpty()
+{
+    while( m_layer_index_ < kEnd && ( ( m_mask_ >> m_layer_index_ & 1 ) == 0 || m_object_index_ >= getObjects().size() ) )
+    {
+        const auto above = m_layer_index_ + 1 < kEnd ? m_mask_ >> ( m_layer_index_ + 1 ) : 0;
+        m_layer_index_   = above == 0 ? kEnd : m_layer_index_ + 1 + static_cast< size_t >( std::countr_zero( above ) );
+        m_object_index_  = 0;
+    }
+}
+
 sk::Scene::cLayer_Manager::cLayer_Manager()
 {
     AddLayer( 0, "Default" );
@@ -58,10 +85,9 @@ void sk::Scene::cLayer_Manager::AddLayer( const uint64_t _layer, const cStringID
 
     // This may overwrite a layer in the same spot. But that will usually be intentional if done in the editor.
     // May want to consider triggering a break or warning in case it happens during runtime.
-    auto& [ name, layer_val, objects ] = *layer;
-    name      = _name;
-    layer_val = 1 << _layer;
-    objects   = object_vec_t{};
+    clearLayer( *layer );
+    layer->name  = _name;
+    layer->layer = 1ull << _layer;
 }
 
 void sk::Scene::cLayer_Manager::RemoveLayer( const uint64_t _layer )
@@ -69,13 +95,13 @@ void sk::Scene::cLayer_Manager::RemoveLayer( const uint64_t _layer )
     SK_BREAK_RET_IF( sk::Severity::kGeneral, m_layers_.size() <= _layer,
         TEXT( "Layer with value {} does not exist.", _layer ) )
     
-    auto& [ name, layer, objects ] = m_layers_[ _layer ];
+    auto& layer = m_layers_[ _layer ];
     
-    m_name_to_layer_.erase( name.hash() );
+    m_name_to_layer_.erase( layer.name.hash() );
     
-    name    = cStringID{};
-    layer   = 0;
-    objects = {};
+    clearLayer( layer );
+    layer.name  = cStringID{};
+    layer.layer = 0;
 }
 
 void sk::Scene::cLayer_Manager::AddObject( const cShared_ptr< Object::iObject >& _object )
@@ -84,12 +110,19 @@ void sk::Scene::cLayer_Manager::AddObject( const cShared_ptr< Object::iObject >&
     if( !was_created && component->m_index_ != std::numeric_limits< uint64_t >::max() )
         removeObjectAt( component->m_layer_index_, component->m_index_ );
     
-    const auto layer_index = std::countr_one( _object->GetLayer() );
+    // The object stores the index of its layer, same as AddLayer takes.
+    const auto layer_index = static_cast< size_t >( _object->GetLayer() );
+    SK_BREAK_RET_IF( sk::Severity::kGeneral, m_layers_.size() <= layer_index,
+        TEXT( "Layer with value {} does not exist.", layer_index ) )
+
     auto& objects = m_layers_[ layer_index ].objects;
     
     component->m_layer_index_ = layer_index;
     component->m_index_       = objects.size();
     objects.emplace_back( _object );
+
+    for( auto& mesh : _object->GetMeshComponents() )
+        AddMesh( *mesh, layer_index );
 }
 
 void sk::Scene::cLayer_Manager::RemoveObject( const cShared_ptr< Object::iObject >& _object )
@@ -98,9 +131,41 @@ void sk::Scene::cLayer_Manager::RemoveObject( const cShared_ptr< Object::iObject
     if( was_created )
         return;
     
+    if( component->m_index_ != std::numeric_limits< uint64_t >::max() )
+        removeObjectAt( component->m_layer_index_, component->m_index_ );
+
     component->m_layer_index_ = std::numeric_limits< uint64_t >::max();
     component->m_index_       = std::numeric_limits< uint64_t >::max();
-    removeObjectAt( component->m_layer_index_, component->m_index_ );
+
+    for( auto& mesh : _object->GetMeshComponents() )
+        RemoveMesh( *mesh );
+}
+
+void sk::Scene::cLayer_Manager::AddMesh( Object::Components::cMeshComponent& _mesh, const size_t _layer_index )
+{
+    SK_BREAK_RET_IF( sk::Severity::kGeneral, m_layers_.size() <= _layer_index,
+        TEXT( "Layer with value {} does not exist.", _layer_index ) )
+
+    if( _mesh.m_layer_index_ == _layer_index )
+        return;
+
+    RemoveMesh( _mesh );
+
+    auto& meshes = m_layers_[ _layer_index ].meshes;
+    _mesh.m_layer_index_ = _layer_index;
+    _mesh.m_layer_slot_  = meshes.size();
+    meshes.emplace_back( &_mesh );
+}
+
+void sk::Scene::cLayer_Manager::RemoveMesh( Object::Components::cMeshComponent& _mesh )
+{
+    if( _mesh.m_layer_index_ == Object::Components::cMeshComponent::kNoLayer )
+        return;
+
+    removeMeshAt( _mesh.m_layer_index_, _mesh.m_layer_slot_ );
+
+    _mesh.m_layer_index_ = Object::Components::cMeshComponent::kNoLayer;
+    _mesh.m_layer_slot_  = Object::Components::cMeshComponent::kNoLayer;
 }
 
 auto sk::Scene::cLayer_Manager::GetLayerByName( const cStringID& _name ) const -> std::optional< uint64_t >
@@ -112,29 +177,19 @@ auto sk::Scene::cLayer_Manager::GetLayerByName( const cStringID& _name ) const -
 
 auto sk::Scene::cLayer_Manager::GetObjectsIn( const uint64_t _layers ) const -> object_range_t
 {
-    std::vector< const sLayer* > layers;
-    for( uint32_t shift = 0; m_layers_.size() >= shift; ++shift )
-    {
-        if( ( _layers & ( 1 << shift ) ) == 0 )
-            continue;
-        
-        layers.emplace_back( &m_layers_[ shift ] );
-    }
+    // Only the bits of layers that exist, the iterators index the layers with them.
+    const auto existing = m_layers_.size() >= cObjectIterator::kEnd ? ~0ull : ( 1ull << m_layers_.size() ) - 1;
+    const auto mask     = _layers & existing;
     
-    cObjectIterator itr_start = { layers, 0, 0 };
-    cObjectIterator itr_end   = { layers, layers.size(), 0 };
-    
-    return { itr_start, itr_end };
+    return { cObjectIterator{ m_layers_, mask, 0 }, cObjectIterator{ m_layers_, mask, cObjectIterator::kEnd } };
 }
 
-auto sk::Scene::cLayer_Manager::GetMeshesIn( const uint64_t _layers ) const -> mesh_range_t
+auto sk::Scene::cLayer_Manager::GetMeshes( const size_t _layer_index ) const -> mesh_span_t
 {
-    const auto [ fst, snd ] = GetObjectsIn( _layers );
-    
-    cMeshIterator mesh_itr_start = { fst, snd, 0 };
-    cMeshIterator mesh_itr_end   = { snd, snd, 0 };
-    
-    return { mesh_itr_start, mesh_itr_end };
+    if( _layer_index >= m_layers_.size() )
+        return {};
+
+    return m_layers_[ _layer_index ].meshes;
 }
 
 void sk::Scene::cLayer_Manager::removeObjectAt( const size_t _layer_index, const size_t _index )
@@ -150,8 +205,50 @@ void sk::Scene::cLayer_Manager::removeObjectAt( const size_t _layer_index, const
         auto& back   = objects.back();
     
         std::swap( target, back );
+
+        // The moved object has to know its new index.
+        if( const auto moved = target.Lock() )
+        {
+            auto [ was_created, component ] = moved->AddOrGetInternalComponent< Object::Components::cLayer_Info_Component >( m_internal_component_index_ );
+            component->m_index_ = _index;
+        }
     }
     
     objects.pop_back();
 }
 
+void sk::Scene::cLayer_Manager::removeMeshAt( const size_t _layer_index, const size_t _index )
+{
+    auto& meshes = m_layers_[ _layer_index ].meshes;
+
+    if( _index < meshes.size() - 1 )
+    {
+        meshes[ _index ] = meshes.back();
+        meshes[ _index ]->m_layer_slot_ = _index;
+    }
+
+    meshes.pop_back();
+}
+
+void sk::Scene::cLayer_Manager::clearLayer( sLayer& _layer )
+{
+    for( auto& object : _layer.objects )
+    {
+        if( const auto locked = object.Lock() )
+        {
+            auto [ was_created, component ] = locked->AddOrGetInternalComponent< Object::Components::cLayer_Info_Component >( m_internal_component_index_ );
+            component->m_layer_index_ = std::numeric_limits< uint64_t >::max();
+            component->m_index_       = std::numeric_limits< uint64_t >::max();
+        }
+    }
+
+    for( const auto mesh : _layer.meshes )
+    {
+        mesh->m_layer_index_ = Object::Components::cMeshComponent::kNoLayer;
+        mesh->m_layer_slot_  = Object::Components::cMeshComponent::kNoLayer;
+    }
+
+    _layer.objects.clear();
+    _layer.meshes .clear();
+}
+
@@ -8,6 +8,7 @@
 #include <sk/Misc/StringID.h>
 #include <sk/Scene/Object.h>
 
+#include <span>
 #include <unordered_map>
 
 namespace sk::Object::Components
@@ -21,26 +22,28 @@ namespace sk::Scene
     {
     public:
         using object_vec_t = vector< cWeak_Ptr< Object::iObject > >;
+        // The mesh components remove themselves when destroyed, so plain pointers are enough.
+        using mesh_vec_t   = vector< Object::Components::cMeshComponent* >;
+        using mesh_span_t  = std::span< Object::Components::cMeshComponent* const >;
         
         struct sLayer
         {
             cStringID    name;
             uint64_t     layer;
             object_vec_t objects;
+            mesh_vec_t   meshes;
         };
         
+        // Walks the objects of every layer in a mask, where bit n is layer n. Holds nothing but the mask, so ranges are free to make.
         class cObjectIterator
         {
         public:
-            using layer_vec_t = std::vector< const sLayer* >;
+            // Layers are bits in a uint64_t, so there can't be more than this.
+            static constexpr size_t kEnd = 64;
             
             cObjectIterator() = default;
-            cObjectIterator( layer_vec_t _layers, const size_t _layer_index, const size_t _object_index )
-            : m_layers_{ std::move( _layers ) }
-            , m_layer_index_{ _layer_index }
-            , m_object_index_{ _object_index }
-            {
-            } // cLayerIterator
+            // Starts at the first object at or after the layer index.
+            cObjectIterator( const vector< sLayer >& _layers, uint64_t _mask, size_t _layer_index );
             
             using difference_type   = std::ptrdiff_t;
             using value_type        = object_vec_t::value_type;
@@ -89,152 +92,51 @@ namespace sk::Scene
         private:
             [[ nodiscard ]] auto getObjects() const -> const object_vec_t&
             {
-                return m_layers_[ m_layer_index_ ]->objects;
+                return ( *m_layers_ )[ m_layer_index_ ].objects;
             }
             
             [[ nodiscard ]] auto getObject() const -> const cWeak_Ptr< Object::iObject >&
             {
                 return getObjects()[ m_object_index_ ];
             }
-            
-            layer_vec_t m_layers_;
-            size_t      m_layer_index_;
-            size_t      m_object_index_;
-        };
-
-        class cMeshIterator
-        {
-        public:
-            cMeshIterator() = default;
-            cMeshIterator( cObjectIterator _object_itr_start, cObjectIterator _object_itr_end, const size_t _mesh_index )
-            : m_object_itr_{ std::move( _object_itr_start ) }
-            , m_object_end_{ std::move( _object_itr_end ) }
-            , m_mesh_index_{ _mesh_index }
-            {
-            } // cLayerIterator
-            
-            using difference_type   = std::ptrdiff_t;
-            using value_type        = cShared_ptr< Object::Components::cMeshComponent >;
-            using pointer           = value_type*;
-            using reference         = value_type&;
-            using iterator_category = std::forward_iterator_tag;
-
-            [[ nodiscard ]] bool IsValid() const
-            {
-                return !getMeshes().empty();
-            }
-            
-            operator bool() const
-            {
-                return IsValid();
-            }
-            
-            auto& operator*() const
-            {
-                auto& meshes = getMeshes();
-                return meshes[ m_mesh_index_ ];
-            }
-            
-            auto& operator->() const
-            {
-                auto& meshes = getMeshes();
-                return meshes[ m_mesh_index_ ];
-            }
-            
-            auto& operator++()
-            {
-                if( ++m_mesh_index_ >= getMeshes().size() )
-                {
-                    // This should cap the iterator at the end.
-                    if( m_object_itr_ != m_object_end_ )
-                        ++m_object_itr_;
-                    m_mesh_index_ = 0;
-                }
-                
-                return *this;
-            }
-            
-            auto operator++( int )
-            {
-                auto tmp = *this;
-                
-                ++( *this );
-                
-                return tmp;
-            }
-            
-            auto& operator--()
-            {
-                if( m_mesh_index_ == 0 )
-                {
-                    // This should cap the iterator at the end.
-                    static auto zero_iterator = cObjectIterator{ {}, 0, 0 };
-                    if( m_object_itr_ != zero_iterator )
-                    {
-                        --m_object_itr_;
-                        m_mesh_index_ = getMeshes().size() - 1;
-                    }
-                }
-                else
-                    m_mesh_index_++;
-                
-                return *this;
-            }
-            
-            auto operator--( int )
-            {
-                auto tmp = *this;
-                
-                --( *this );
-                
-                return tmp;
-            }
-            
-            bool operator==( const cMeshIterator& _other ) const
-            {
-                return m_mesh_index_ == _other.m_mesh_index_ && m_object_itr_ == _other.m_object_itr_;
-            }
 
-        private:
-            [[ nodiscard ]] auto getObject() const -> const cWeak_Ptr< Object::iObject >&
-            {
-                return *m_object_itr_;
-            }
-            
-            [[ nodiscard ]] auto getMeshes() const -> const vector< cShared_ptr< Object::Components::cMeshComponent > >&
-            {
-                return getObject()->GetMeshComponents();
-            }
+            // Moves on to the next layer in the mask if there's no object at the index, skipping empty ones.
+            void skipEmpty();
             
-            [[ nodiscard ]] auto getMesh() const -> const cShared_ptr< Object::Components::cMeshComponent >&
-            {
-                return getMeshes()[ m_mesh_index_ ];
-            }
-            
-            cObjectIterator m_object_itr_;
-            cObjectIterator m_object_end_;
-            size_t          m_mesh_index_;
+            const vector< sLayer >* m_layers_       = nullptr;
+            uint64_t                m_mask_         = 0;
+            size_t                  m_layer_index_  = kEnd;
+            size_t                  m_object_index_ = 0;
         };
 
         using object_range_t = std::pair< cObjectIterator, cObjectIterator >;
-        using mesh_range_t   = std::pair< cMeshIterator, cMeshIterator >;
         
         cLayer_Manager();
 
         void AddLayer   ( uint64_t _layer, const cStringID& _name );
         void RemoveLayer( uint64_t _layer );
 
+        // Also moves the objects mesh components to its layer.
         void AddObject   ( const cShared_ptr< Object::iObject >& _object );
         void RemoveObject( const cShared_ptr< Object::iObject >& _object );
 
+        // Moves the mesh if it's already in a layer.
+        void AddMesh   ( Object::Components::cMeshComponent& _mesh, size_t _layer_index );
+        void RemoveMesh( Object::Components::cMeshComponent& _mesh );
+
         [[ nodiscard ]] auto  GetLayerByName( const cStringID& _name   ) const -> std::optional< uint64_t >;
+        // Every object in the layers of the mask. Doesn't allocate, but is only valid until a layer or object is added or removed.
         [[ nodiscard ]] auto  GetObjectsIn  (       uint64_t   _layers ) const -> object_range_t;
-        [[ nodiscard ]] auto  GetMeshesIn   (       uint64_t   _layers ) const -> mesh_range_t;
+        // Every mesh component in the layer, in no particular order. Only valid until a mesh is added or removed.
+        [[ nodiscard ]] auto  GetMeshes     (       size_t     _layer_index ) const -> mesh_span_t;
 
         [[ nodiscard ]] auto& GetLayers() const { return m_layers_; }
 
     private:
         void removeObjectAt( size_t _layer_index, size_t _index );
+        void removeMeshAt  ( size_t _layer_index, size_t _index );
+        // Removes every object and mesh from the layer.
+        void clearLayer    ( sLayer& _layer );
         
         using hash_to_i_map_t = map< str_hash, uint64_t >;
         using layer_vec_t     = vector< sLayer >;
@@ -2,8 +2,11 @@
 
 #include "Light_Manager.h"
 
+#include <sk/Scene/Components/CameraComponent.h>
 #include <sk/Scene/Components/LightComponent.h>
 
+#include <algorithm>
+
 namespace 
 {
     // From: https://en.cppreference.com/w/cpp/utility/variant/visit
@@ -17,6 +20,8 @@ sk::Scene::cLight_Manager::cLight_Manager()
 , m_directional_buffer_( "Directional Light Buffer", false )
 , m_point_buffer_( "Point Light Buffer", false )
 , m_spot_buffer_( "Spot Light Buffer", false )
+, m_cluster_buffer_( "Light Cluster Buffer", false )
+, m_cluster_index_buffer_( "Light Cluster Index Buffer", false )
 {
 }
 
@@ -55,6 +60,105 @@ void sk::Scene::cLight_Manager::Update()
     m_shadow_caster_buffer_.Upload();
 }
 
+void sk::Scene::cLight_Manager::SyncTransforms()
+{
+    for( const auto& light : m_lights_ )
+    {
+        if( light.is_valid() )
+            light->sync_transform();
+    }
+}
+
+void sk::Scene::cLight_Manager::UpdateClusters( const Object::Components::cCameraComponent& _camera )
+{
+    const auto& projection = _camera.GetSettings();
+    const auto& previous   = m_cluster_projection_;
+    if( projection.fov != previous.fov || projection.aspect != previous.aspect || projection.near != previous.near || projection.far != previous.far )
+    {
+        m_clusters_.Build( {}, projection.fov, projection.aspect, projection.near, projection.far );
+        m_cluster_projection_ = projection;
+        
+        m_cluster_buffer_.Resize( m_clusters_.GetGrid().GetCount() );
+    }
+    
+    const auto& view = _camera.GetTransform().GetInverseWorld();
+    const auto to_view = [ & ]( const cVector3f& _position )
+    {
+        return cVector3f{ view.x } * _position.x + cVector3f{ view.y } * _position.y + cVector3f{ view.z } * _position.z + cVector3f{ view.w };
+    };
+    
+    m_packed_lights_.Clear();
+    m_packed_lights_.Reserve( m_point_buffer_.Size() + m_spot_buffer_.Size() );
+    
+    for( size_t i = 0; i < m_point_buffer_.Size(); i++ )
+    {
+        const auto& light = m_point_buffer_[ i ];
+        m_packed_lights_.AddPoint( to_view( light.position ), light.radius );
+    }
+    
+    // The direction of a spot light isn't always normalized, and its range is only kept in the settings.
+    for( size_t i = 0; i < m_spot_buffer_.Size(); i++ )
+    {
+        const auto& light     = m_spot_buffer_[ i ];
+        const auto  radius    = m_lights_[ m_spot_light_indices_[ i ] ]->GetSettings().radius;
+        const auto  direction = to_view( light.position + light.direction ) - to_view( light.position );
+        
+        m_packed_lights_.AddSpot( to_view( light.position ), Math::Vector3::Normalized( direction ), radius, Math::degToRad( light.outer_angle ) );
+    }
+    
+    m_clusters_.Assign( m_packed_lights_ );
+    
+    const auto& clusters = m_clusters_.GetClusters();
+    const auto& indices  = m_clusters_.GetIndices();
+    
+    std::ranges::copy( clusters, m_cluster_buffer_.Data() );
+    m_cluster_buffer_.Upload( true );
+    
+    // Grown ahead of time, as the amount of indices changes every time the camera moves.
+    if( m_cluster_index_buffer_.Size() < indices.size() )
+        m_cluster_index_buffer_.Resize( std::max< size_t >( { 1024, indices.size(), m_cluster_index_buffer_.Size() * 2 } ) );
+    
+    std::ranges::copy( indices, m_cluster_index_buffer_.Data() );
+    m_cluster_index_buffer_.Upload( true );
+}
+
+void sk::Scene::cLight_Manager::UpdateShadowAtlas( const Object::Components::cCameraComponent& _camera )
+{
+    const auto& camera_position = _camera.GetTransform().GetWorldPosition();
+    const auto  tan_half_fov    = Math::tan( Math::degToRad( _camera.GetSettings().fov ) * 0.5f );
+    
+    m_shadow_atlas_.Begin();
+    
+    for( const auto& caster : m_shadow_casters_ )
+    {
+        // Directional lights cover the whole view, the rest by how large their radius looks from the camera.
+        float importance = 1.0f;
+        if( caster->GetType() != Light::eType::kDirectional )
+        {
+            const auto radius   = caster->GetSettings().radius;
+            const auto distance = Math::Vector3::Length( caster->GetTransform().GetWorldPosition() - camera_position );
+            if( distance > radius )
+                importance = radius / ( distance * tan_half_fov );
+        }
+        
+        m_shadow_atlas_.Request( caster->GetUUID(), importance );
+    }
+    
+    m_shadow_atlas_.End();
+    
+    const auto atlas_size = static_cast< float >( m_shadow_atlas_.GetSize() );
+    for( size_t i = 0; i < m_shadow_casters_.size(); i++ )
+    {
+        const auto tile   = m_shadow_atlas_.GetTile( m_shadow_casters_[ i ]->GetUUID() );
+        auto&      shadow = m_shadow_caster_buffer_[ i ];
+        
+        shadow.atlas_start = cVector2f{ static_cast< float >( tile.x ), static_cast< float >( tile.y ) } / atlas_size;
+        shadow.atlas_end   = cVector2f{ static_cast< float >( tile.x + tile.size ), static_cast< float >( tile.y + tile.size ) } / atlas_size;
+    }
+    
+    mark_shadow_buffer_dirty();
+}
+
 auto sk::Scene::cLight_Manager::GetLights() const -> const light_vec_t&
 {
     return m_lights_;
@@ -187,9 +291,10 @@ void sk::Scene::cLight_Manager::add_shadow_caster( const light_ptr_t& _light )
     _light->m_shadow_data_index_ = static_cast< uint32_t >( m_shadow_casters_.size() );
     m_shadow_casters_.emplace_back( _light );
     
+    // The atlas area is set by UpdateShadowAtlas.
     m_shadow_caster_buffer_.EmplaceBack( Light::sShadowCaster{
         .atlas_start  = { 0.0f, 0.0f },
-        .atlas_end    = { 1.0f, 1.0f },
+        .atlas_end    = { 0.0f, 0.0f },
         .light_matrix = _light->GetViewProjMatrix()
     } );
     
@@ -204,9 +309,13 @@ void sk::Scene::cLight_Manager::remove_shadow_caster( const light_ptr_t& _light
         
         back->m_shadow_data_index_ = index;
         std::swap( m_shadow_casters_[ index ], back );
+        std::swap( m_shadow_caster_buffer_[ index ], m_shadow_caster_buffer_.Back() );
+        
+        m_shadow_casters_[ index ]->m_shadow_info_ = &m_shadow_caster_buffer_[ index ];
     }
     
     m_shadow_casters_.pop_back();
+    m_shadow_caster_buffer_.PopBack();
     
     _light->m_shadow_data_index_ = std::numeric_limits< uint32_t >::max();
     _light->m_shadow_info_       = nullptr;
@@ -232,8 +341,3 @@ void sk::Scene::cLight_Manager::mark_shadow_buffer_dirty()
 {
     m_shadow_caster_buffer_.MarkDirty();
 }
-
-void sk::Scene::cLight_Manager::compute_atlas()
-{
-    // TODO: Compute the shadow atlas
-}
@@ -1,9 +1,12 @@
 ﻿#pragma once
 
 #include <sk/Graphics/Buffer/Buffer.h>
+#include <sk/Graphics/Utils/Light_Clusters.h>
+#include <sk/Graphics/Utils/Shadow_Atlas.h>
 #include <sk/Math/Vector3.h>
 #include <sk/Misc/Singleton.h>
 #include <sk/Misc/UUID.h>
+#include <sk/Scene/Components/CameraComponent.h>
 #include <sk/Scene/Components/LightComponent.h>
 
 namespace sk::Scene
@@ -12,6 +15,10 @@ namespace sk::Scene
     {
         friend class sk::Object::Components::cLightComponent;
     public:
+        static constexpr uint32_t kShadowAtlasSize = 8192;
+        static constexpr uint32_t kShadowTileMin   = 128;
+        static constexpr uint32_t kShadowTileMax   = 2048;
+
         using light_ptr_t = cWeak_Ptr< Object::Components::cLightComponent >;
         using light_vec_t = std::vector< light_ptr_t >;
 
@@ -38,6 +45,17 @@ namespace sk::Scene
         
         void Update();
 
+        // Moves the lights whose transform changed in the last transform hierarchy update.
+        void SyncTransforms();
+
+        // Lists the point and spot lights touching each cluster of the cameras view, and uploads the lists.
+        // Indices below the point light count refer to the point buffer, the rest to the spot buffer minus that count.
+        void UpdateClusters( const Object::Components::cCameraComponent& _camera );
+
+        // Gives every shadow caster a tile of the atlas sized after how much of the cameras view it covers.
+        // Casters keep their tile between frames unless their size changes, those without one get an empty atlas area.
+        void UpdateShadowAtlas( const Object::Components::cCameraComponent& _camera );
+
         [[ nodiscard ]] auto  GetLights       () const -> const light_vec_t&;
         [[ nodiscard ]] auto  GetShadowCasters() const -> const light_vec_t&;
         
@@ -46,6 +64,10 @@ namespace sk::Scene
         [[ nodiscard ]] auto& GetPointBuffer       () const { return m_point_buffer_;          }
         [[ nodiscard ]] auto& GetSpotBuffer        () const { return m_spot_buffer_;           }
         [[ nodiscard ]] auto& GetShadowCasterBuffer() const { return m_shadow_caster_buffer_;  }
+        [[ nodiscard ]] auto& GetShadowAtlas       () const { return m_shadow_atlas_;          }
+        [[ nodiscard ]] auto& GetClusters          () const { return m_clusters_;              }
+        [[ nodiscard ]] auto& GetClusterBuffer     () const { return m_cluster_buffer_;        }
+        [[ nodiscard ]] auto& GetClusterIndexBuffer() const { return m_cluster_index_buffer_;  }
     private:
         void register_light  ( light_ptr_t _light );
         void update_light    ( light_ptr_t _light, const Light::sSettings& _previous_settings );
@@ -57,13 +79,13 @@ namespace sk::Scene
         void mark_buffer_dirty( Light::eType _type );
         void mark_shadow_buffer_dirty();
         
-        void compute_atlas();
-        
         using settings_buffer_t    = Graphics::cConstant_Buffer< sLightSettings >;
         using directional_buffer_t = Graphics::cStructured_Buffer< Light::sDirectionalLight >;
         using point_buffer_t       = Graphics::cStructured_Buffer< Light::sPointLight >;
         using spot_buffer_t        = Graphics::cStructured_Buffer< Light::sSpotLight >;
         using shadow_buffer_t      = Graphics::cStructured_Buffer< Light::sShadowCaster >;
+        using cluster_buffer_t     = Graphics::cStructured_Buffer< Graphics::Utils::sCluster >;
+        using index_buffer_t       = Graphics::cStructured_Buffer< uint32_t >;
         
         light_vec_t m_lights_;
         light_vec_t m_shadow_casters_;
@@ -71,6 +93,8 @@ namespace sk::Scene
         settings_buffer_t m_light_settings_buffer_;
         shadow_buffer_t   m_shadow_caster_buffer_;
         
+        Graphics::Utils::cShadow_Atlas m_shadow_atlas_{ kShadowAtlasSize, kShadowTileMin, kShadowTileMax };
+        
         directional_buffer_t m_directional_buffer_;
         point_buffer_t       m_point_buffer_;
         spot_buffer_t        m_spot_buffer_;
@@ -79,5 +103,12 @@ namespace sk::Scene
         std::vector< size_t > m_point_light_indices_;
         std::vector< size_t > m_spot_light_indices_;
         
+        Graphics::Utils::cLight_Clusters m_clusters_;
+        Graphics::Utils::sPacked_Lights  m_packed_lights_;
+        // The projection the clusters were last built for.
+        Object::Components::cCameraComponent::sCameraSettings m_cluster_projection_ = {};
+        
+        cluster_buffer_t m_cluster_buffer_;
+        index_buffer_t   m_cluster_index_buffer_;
     };
 } // sk::Scene::
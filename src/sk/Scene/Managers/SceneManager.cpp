@@ -8,6 +8,7 @@
 #include "SceneManager.h"
 
 #include <sk/Graphics/Rendering/Frame_Buffer.h>
+#include <sk/Math/Transform_Hierarchy.h>
 #include <sk/Graphics/Rendering/Render_Context.h>
 #include <sk/Scene/Components/CameraComponent.h>
 #include <sk/Scene/Managers/CameraManager.h>
@@ -23,6 +24,7 @@ namespace sk
 	cSceneManager::cSceneManager()
 	{
 		cEventManager::init();
+		cTransform_Hierarchy::init();
 		Scene::cCameraManager::init();
 		Scene::cLayer_Manager::init();
 		Scene::cLight_Manager::init();
@@ -36,6 +38,7 @@ namespace sk
 		Scene::cLight_Manager::shutdown();
 		Scene::cCameraManager::shutdown();
 		Scene::cLayer_Manager::shutdown();
+		cTransform_Hierarchy::shutdown();
 		cEventManager::shutdown();
 	} // ~cSceneManager
 
@@ -47,6 +50,10 @@ namespace sk
 	void cSceneManager::update()
 	{
 		cEventManager::get().postEvent( Object::kUpdate );
+
+		// After the components, so whatever they moved this frame is rendered this frame.
+		cTransform_Hierarchy::get().Update();
+		Scene::cLight_Manager::get().SyncTransforms();
 	} // update
 
 	void cSceneManager::render()
@@ -6,15 +6,35 @@
 
 #include "Object.h"
 
+#include <sk/Scene/Scene.h>
 #include <sk/Scene/Managers/Layer_Manager.h>
 
 void sk::Object::iObject::SetLayer( const uint64_t _layer )
 {
-    auto& layer_manager = Scene::cLayer_Manager::get();
     m_layer_ = _layer;
+
+    // Staged objects are added to their layer once committed.
+    if( m_staged_ )
+        return;
+
+    auto& layer_manager = Scene::cLayer_Manager::get();
     layer_manager.AddObject( get_shared() );
 }
 
+void sk::Object::iObject::add_mesh_component( const cShared_ptr< Components::cMeshComponent >& _mesh )
+{
+    m_mesh_components_.emplace_back( _mesh );
+
+    if( m_staged_ )
+        return;
+
+    if( m_parent_scene != nullptr )
+        m_parent_scene->add_mesh( _mesh.get() );
+
+    if( const auto layer_manager = Scene::cLayer_Manager::getPtr() )
+        layer_manager->AddMesh( *_mesh, static_cast< size_t >( m_layer_ ) );
+}
+
 void sk::Object::iObject::SetRoot( const cShared_ptr< iComponent >& _new_root_component, const bool _override_parent )
 {
     if( _override_parent )
@@ -26,4 +46,32 @@ void sk::Object::iObject::SetRoot( const cShared_ptr< iComponent >& _new_root_co
         m_root->m_children_.front()->SetParent( _new_root_component );
     
     m_root = _new_root_component;
+    update_archetype_root();
+}
+
+void sk::Object::iObject::update_archetype_root()
+{
+    if( m_staged_ )
+        return;
+
+    // The roots transform is what systems iterating the archetypes will care about.
+    if( const auto archetypes = Scene::cArchetype_Manager::getPtr() )
+        archetypes->Add< cTransform >( *this, m_root->GetSharedTransform().get() );
+}
+
+void sk::Object::iObject::commit_staged()
+{
+    if( !m_staged_ )
+        return;
+
+    m_staged_ = false;
+
+    // Also moves the mesh components to the layer.
+    SetLayer( m_layer_ );
+    update_archetype_root();
+
+    for( auto& registration : m_staged_registrations_ )
+        registration();
+
+    m_staged_registrations_ = {};
 }
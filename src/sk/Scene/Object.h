@@ -13,8 +13,11 @@
 #include <sk/Reflection/RuntimeClass.h>
 #include <sk/Scene/Components/Component.h>
 #include <sk/Scene/Components/TransformComponent.h>
+#include <sk/Scene/Managers/Archetype_Manager.h>
 #include <sk/Scene/Managers/Internal_Component_Manager.h>
+#include <sk/Scene/Staging.h>
 
+#include <functional>
 #include <ranges>
 
 
@@ -37,20 +40,28 @@ namespace sk::Object
 	sk_public:
 		// TODO: Create templated constructor with root type + parameters
 		explicit iObject( const std::string& _name )
-		: m_root( sk::make_shared< Components::cTransformComponent >() )
+		: m_root( sk::make_pooled< Components::cTransformComponent >() )
 		, m_name( _name )
 		{
 			SetLayer( 0 );
+			update_archetype_root();
+			stage_root();
 		} // iObject
 
 		template< class Ty = iComponent, class... Args >
 		explicit iObject( const std::string& _name, Args... _args )
-		: m_root( sk::make_shared< Ty >( _args... ) )
+		: m_root( sk::make_pooled< Ty >( _args... ) )
 		, m_name( _name )
-		{} // iObject
+		{
+			update_archetype_root();
+			stage_root();
+		} // iObject
 
 		~iObject() override
 		{
+			if( const auto archetypes = Scene::cArchetype_Manager::getPtr() )
+				archetypes->RemoveObject( *this );
+
 			m_children_.clear();
 			m_components_.clear();
 			m_root = nullptr;
@@ -60,37 +71,86 @@ namespace sk::Object
 		requires ( std::is_base_of_v< iComponent, Ty > && std::constructible_from< Ty, Args... > )
 		auto AddComponent( Args&&... _args ) -> cShared_ptr< Ty >
 		{
-			auto component = sk::make_shared< Ty >( std::forward< Args >( _args )... );
+			auto component = sk::make_pooled< Ty >( std::forward< Args >( _args )... );
 
 			component->m_object_ = get_weak();
 			component->m_uuid_   = GenerateRandomUUID();
 			component->SetParent( m_root );
 
 			if constexpr( std::is_base_of_v< Components::cMeshComponent, Ty > )
-				m_mesh_components_.emplace_back( component );
+				add_mesh_component( component );
 			else
 				m_components_.insert( std::pair{ Ty::getStaticType(), component } );
 
+			if( !m_staged_ )
+				add_archetype_component( component.get() );
+			else
+			{
+				// The object owns the component, so the raw pointer stays valid until the commit.
+				m_staged_registrations_.emplace_back( [ this, raw = component.get() ]
+				{
+					static_cast< iComponent* >( raw )->register_events();
+					add_archetype_component( raw );
+				} );
+			}
+
 			return component;
 		} // addComponent
 
-		// TODO: Have get component actually get a component instead of creating one.
+		/**
+		 * Plain data components are stored by value in the archetype storage, which has to be initialized to use them.
+		 * The type has to be registered with REGISTER_TYPE.
+		 * @return A pointer to the component, which is only valid until the objects set of components changes.
+		 */
 		template< class Ty, class... Args >
-		requires std::is_base_of_v< iComponent, Ty >
-		auto GetComponent( Args&&... _args ) -> cShared_ptr< Ty >
+		requires ( !std::is_base_of_v< iComponent, Ty > && std::constructible_from< Ty, Args... > )
+		auto AddComponent( Args&&... _args ) -> Ty*
 		{
-			auto component = sk::make_shared< Ty >( std::forward< Args >( _args )... );
+			const auto archetypes = Scene::cArchetype_Manager::getPtr();
+			SK_BREAK_RET_IF( sk::Severity::kEngine, archetypes == nullptr,
+				"Error: Data components require the archetype manager to be initialized.", nullptr )
 
-			component->m_object_ = get_weak();
-			component->setParent( m_root );
+			return &archetypes->Add< Ty >( *this, std::forward< Args >( _args )... );
+		} // AddComponent
+
+		// Returns nullptr if the object doesn't have the component.
+		template< class Ty >
+		requires ( !std::is_base_of_v< iComponent, Ty > )
+		auto GetComponent() const -> Ty*
+		{
+			if( const auto archetypes = Scene::cArchetype_Manager::getPtr() )
+				return archetypes->Get< Ty >( *this );
+
+			return nullptr;
+		} // GetComponent
 
+		template< class Ty >
+		requires ( !std::is_base_of_v< iComponent, Ty > )
+		void RemoveComponent()
+		{
+			if( const auto archetypes = Scene::cArchetype_Manager::getPtr() )
+				archetypes->Remove< Ty >( *this );
+		} // RemoveComponent
+
+		// Returns the first component of the type, adding one made from the arguments if the object doesn't have it yet.
+		// Added components are registered the same way as through AddComponent, staged or not.
+		template< class Ty, class... Args >
+		requires ( std::is_base_of_v< iComponent, Ty > && std::constructible_from< Ty, Args... > )
+		auto GetComponent( Args&&... _args ) -> cShared_ptr< Ty >
+		{
 			if constexpr( std::is_base_of_v< Components::cMeshComponent, Ty > )
-				m_mesh_components_.emplace_back( component );
-			else
-				m_components_.insert( std::pair{ Ty::getStaticType(), component } );
+			{
+				for( auto& component : m_mesh_components_ )
+				{
+					if( dynamic_cast< Ty* >( component.get() ) != nullptr )
+						return component.Cast< Ty >();
+				}
+			}
+			else if( const auto itr = m_components_.find( Ty::getStaticType() ); itr != m_components_.end() )
+				return itr->second.Cast< Ty >();
 
-			return component;
-		} // addComponent
+			return AddComponent< Ty >( std::forward< Args >( _args )... );
+		} // GetComponent
 		
 		// TODO: Add a way to remove the component
 
@@ -140,7 +200,7 @@ namespace sk::Object
 				return AddOrGetInternalComponent< Ty >( _requested_index );
 			}
 			
-			auto component = sk::make_shared< Ty >();
+			auto component = sk::make_pooled< Ty >();
 
 			component->m_object_   = get_weak();
 			component->m_uuid_     = GenerateRandomUUID();
@@ -191,12 +251,36 @@ namespace sk::Object
 		[[ nodiscard ]] auto& GetTransform() const { return m_root->GetTransform(); }
 
 		[[ nodiscard ]] auto& GetName() const { return m_name; }
-		
+
+		// True until the object has been committed to a scene, if it was built by a streamed chunk.
+		[[ nodiscard ]] bool IsStaged() const { return m_staged_; }
 
 	sk_protected:
 		void SetRoot( const cShared_ptr< iComponent >& _new_root_component, bool _override_parent = false );
 
 	sk_private:
+		void update_archetype_root();
+		// Also adds the mesh to the objects layer.
+		void add_mesh_component( const cShared_ptr< Components::cMeshComponent >& _mesh );
+
+		// Only the first component of each type is visible to archetype queries.
+		template< class Ty >
+		void add_archetype_component( Ty* _component )
+		{
+			if( const auto archetypes = Scene::cArchetype_Manager::getPtr(); archetypes && archetypes->Get< Ty >( *this ) == nullptr )
+				archetypes->Add< Ty >( *this, _component );
+		} // add_archetype_component
+
+		// The root component skipped its event registration if it was created while staging.
+		void stage_root()
+		{
+			if( m_staged_ )
+				m_staged_registrations_.emplace_back( [ root = m_root.get() ]{ root->register_events(); } );
+		} // stage_root
+
+		// Registers the staged object and its components with the scene managers. Has to be called on the main thread.
+		void commit_staged();
+
 		cShared_ptr< iComponent > m_root;
 		
 		// TODO: Use typedefs/using
@@ -211,12 +295,21 @@ namespace sk::Object
 
 		// TODO: Make this into a weak ptr.
 		cScene* m_parent_scene = nullptr;
+		// Index in the parent scenes object list, lets the scene remove it without searching.
+		size_t  m_scene_index_ = std::numeric_limits< size_t >::max();
+
+		// Objects built by a streamed chunk are staged until the scene commits them.
+		bool                                   m_staged_ = Scene::IsStaging();
+		std::vector< std::function< void() > > m_staged_registrations_;
 
 		// TODO: Actually implament these. Follow Unity's design when it comes to layers. But do allow multiple tags.
 		std::vector< str_hash > m_tags_;
 		uint64_t                m_layer_ = 1;
 
+		Scene::sArchetype_Location m_archetype_location_;
+
 		friend class sk::cScene;
+		friend class Scene::cArchetype_Manager;
 	};
 
 	namespace Object
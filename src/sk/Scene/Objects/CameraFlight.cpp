@@ -41,8 +41,9 @@ namespace sk::Object
 	{
 		// TODO: Make transform vector.
 		GetPosition() += Time::Delta * m_speeds.x * ( GetTransform().GetWorldRight() * m_position.x + GetTransform().GetWorldUp() * m_position.y + GetTransform().GetWorldFront() * m_position.z );
-		GetRotation() += Time::Delta * m_speeds.y * cVector3f{ m_rotation.x, m_rotation.y, 0.0f };
-		GetTransform().MarkDirty();
+		const auto rotation = m_rotation * ( Time::Delta * m_speeds.y * Math::kDegToRad< float > );
+		// Pitches around the local right and yaws around the world up, so the camera never rolls.
+		GetTransform().SetRotation( cQuaternionf::FromEuler( { rotation.x, 0.0f, 0.0f } ) * GetRotation() * cQuaternionf::FromEuler( { 0.0f, rotation.y, 0.0f } ) );
 		cCamera::update();
 	} // update
 
@@ -0,0 +1,161 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Prefab.h"
+
+#include <sk/Assets/Management/Asset_Job_Manager.h>
+#include <sk/Scene/Scene.h>
+#include <sk/Scene/Staging.h>
+
+#include <algorithm>
+
+namespace sk::Scene
+{
+	void cPrefab::SetParent( const step_t _step, const step_t _parent )
+	{
+		SK_BREAK_RET_IF( sk::Severity::kEngine, _step >= m_steps_.size(),
+			TEXT( "Error: The prefab has no step {}.", _step ) )
+		// Parents are created first when instantiating, which also rules out cycles.
+		SK_BREAK_RET_IF( sk::Severity::kEngine, _parent != kRoot && _parent >= _step,
+			"Error: A component can only be parented to a component added before it." )
+
+		m_steps_[ _step ].parent = _parent;
+	} // SetParent
+
+	void cPrefab::SetTransform( const step_t _step, const sLocal_Transform& _transform )
+	{
+		SK_BREAK_RET_IF( sk::Severity::kEngine, _step >= m_steps_.size(),
+			TEXT( "Error: The prefab has no step {}.", _step ) )
+
+		auto& step = m_steps_[ _step ];
+		if( step.transform == kNoTransform )
+		{
+			step.transform = static_cast< uint32_t >( m_transforms_.size() );
+			m_transforms_.emplace_back( _transform );
+		}
+		else
+			m_transforms_[ step.transform ] = _transform;
+	} // SetTransform
+
+	void cPrefab::SetEnabled( const step_t _step )
+	{
+		SK_BREAK_RET_IF( sk::Severity::kEngine, _step >= m_steps_.size(),
+			TEXT( "Error: The prefab has no step {}.", _step ) )
+
+		m_steps_[ _step ].enable = true;
+	} // SetEnabled
+
+	auto cPrefab::Instantiate( cScene& _scene, const std::string& _name, const customize_fn_t& _customize ) const -> cShared_ptr< Object::iObject >
+	{
+		auto object = _scene.Instantiate( _name );
+
+		components_t components;
+		execute( *object, components );
+
+		if( _customize )
+			_customize( *object, 0 );
+
+		enable( components );
+
+		return object;
+	} // Instantiate
+
+	auto cPrefab::InstantiateBatch( cScene& _scene, const std::string& _name, const size_t _count, const customize_fn_t& _customize ) const
+		-> std::vector< cShared_ptr< Object::iObject > >
+	{
+		std::vector< cShared_ptr< Object::iObject > > objects( _count );
+		std::vector< components_t >                   components( _count );
+
+		if( _count == 0 )
+			return objects;
+
+		// A few slices per worker, so a single slow worker doesn't hold up the whole batch.
+		const auto slice_count = std::min( _count, Assets::Jobs::cAsset_Job_Manager::get().GetWorkerCount() * 4 );
+
+		std::vector< cFuture< void > > slices;
+		slices.reserve( slice_count - 1 );
+		for( size_t slice = 0; slice < slice_count; slice++ )
+		{
+			const auto first            = _count * slice / slice_count;
+			const auto last             = _count * ( slice + 1 ) / slice_count;
+			const auto objects_slice    = std::span( objects ).subspan( first, last - first );
+			const auto components_slice = std::span( components ).subspan( first, last - first );
+
+			// Only the workers run queued jobs, so the last slice is built here instead of idling.
+			if( slice == slice_count - 1 )
+				build_range( objects_slice, components_slice, _name, first, _customize );
+			else
+				slices.emplace_back( build_slice( objects_slice, components_slice, _name, first, _customize ).Start() );
+		}
+
+		for( const auto& slice : slices )
+			slice.Wait();
+
+		for( size_t i = 0; i < _count; i++ )
+		{
+			_scene.Commit( objects[ i ] );
+			enable( components[ i ] );
+		}
+
+		return objects;
+	} // InstantiateBatch
+
+	void cPrefab::execute( Object::iObject& _object, components_t& _components ) const
+	{
+		_components.resize( m_steps_.size() );
+
+		for( step_t i = 0; i < m_steps_.size(); i++ )
+		{
+			const auto& step = m_steps_[ i ];
+
+			const auto component = step.create != nullptr ? step.create( _object, m_args_.data() + step.args_offset ) : m_bound_[ i ]( _object );
+			_components[ i ] = component;
+
+			// AddComponent already parents it to the root.
+			if( step.parent != kRoot )
+				component->SetParent( _components[ step.parent ]->get_shared() );
+
+			if( step.transform != kNoTransform )
+			{
+				const auto& transform = m_transforms_[ step.transform ];
+				component->SetPosition( transform.position );
+				component->SetRotation( transform.rotation );
+				component->SetScale   ( transform.scale );
+			}
+		}
+	} // execute
+
+	void cPrefab::enable( const components_t& _components ) const
+	{
+		for( step_t i = 0; i < m_steps_.size(); i++ )
+		{
+			if( m_steps_[ i ].enable )
+				_components[ i ]->enabled();
+		}
+	} // enable
+
+	void cPrefab::build_range( const std::span< cShared_ptr< Object::iObject > > _objects, const std::span< components_t > _components,
+		const std::string& _name, const size_t _first_index, const customize_fn_t& _customize ) const
+	{
+		cStaging_Scope staging;
+		for( size_t i = 0; i < _objects.size(); i++ )
+		{
+			_objects[ i ] = sk::make_pooled< Object::iObject >( _name );
+			execute( *_objects[ i ], _components[ i ] );
+
+			if( _customize )
+				_customize( *_objects[ i ], _first_index + i );
+		}
+	} // build_range
+
+	auto cPrefab::build_slice( const std::span< cShared_ptr< Object::iObject > > _objects, const std::span< components_t > _components,
+		const std::string& _name, const size_t _first_index, const customize_fn_t& _customize ) const -> cTask<>
+	{
+		co_await Assets::Jobs::cAsset_Job_Manager::ResumeOnWorker();
+
+		build_range( _objects, _components, _name, _first_index, _customize );
+	} // build_slice
+} // sk::Scene::
@@ -0,0 +1,194 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include <sk/Math/Quaternion.h>
+#include <sk/Math/Vector3.h>
+#include <sk/Misc/Smart_Ptrs.h>
+#include <sk/Misc/Task.h>
+#include <sk/Scene/Object.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <new>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace sk
+{
+	class cScene;
+} // sk::
+
+namespace sk::Scene
+{
+	// An object layout recorded once as a list of AddComponent calls, which are replayed for every instance.
+	// Constructor arguments that are trivially copyable are stored in a single byte blob, others are bound into a std::function.
+	// References between components are stored as step indices. The components are still constructed one by one.
+	class cPrefab
+	{
+	public:
+		using step_t = uint32_t;
+
+		static constexpr step_t kRoot = std::numeric_limits< step_t >::max();
+
+		struct sLocal_Transform
+		{
+			cVector3f    position = cVector3f( 0.0f );
+			cQuaternionf rotation = {};
+			cVector3f    scale    = cVector3f( 1.0f );
+		};
+
+		// Called for every instance before it's added to the scene, with the index of the instance in the batch.
+		using customize_fn_t = std::function< void( Object::iObject&, size_t ) >;
+
+		/**
+		 * Records a component in the program.
+		 * @param _args Arguments the component is constructed with for every instance. Copied into the prefab.
+		 * @return The step of the component, used to refer to it in the other calls.
+		 */
+		template< class Ty, class... Args >
+		requires ( std::is_base_of_v< Object::iComponent, Ty > && std::constructible_from< Ty, const std::decay_t< Args >&... > )
+		auto AddComponent( Args&&... _args ) -> step_t;
+
+		// Parents the component to another component in the prefab, or to the root of the object with kRoot.
+		void SetParent   ( step_t _step, step_t _parent );
+		void SetTransform( step_t _step, const sLocal_Transform& _transform );
+		// Calls enabled on the component once the instance has been added to the scene.
+		void SetEnabled  ( step_t _step );
+
+		[[ nodiscard ]] auto GetStepCount() const { return m_steps_.size(); }
+		// Whether the arguments of the step are packed in the blob, rather than bound into a std::function.
+		[[ nodiscard ]] bool IsPacked( const step_t _step ) const { return m_steps_[ _step ].create != nullptr; }
+
+		// Builds the instance on the calling thread.
+		auto Instantiate( cScene& _scene, const std::string& _name, const customize_fn_t& _customize = nullptr ) const -> cShared_ptr< Object::iObject >;
+
+		/**
+		 * Builds the instances on the asset workers, then adds them to the scene on the calling thread.
+		 * @param _count     Amount of instances to create.
+		 * @param _customize Runs on the workers while building, so it can't touch anything outside the instance.
+		 * @return The instances in order.
+		 */
+		auto InstantiateBatch( cScene& _scene, const std::string& _name, size_t _count, const customize_fn_t& _customize = nullptr ) const
+			-> std::vector< cShared_ptr< Object::iObject > >;
+
+	private:
+		using components_t = std::vector< Object::iComponent* >;
+		using create_fn_t  = Object::iComponent*( * )( Object::iObject&, const std::byte* );
+		using bound_fn_t   = std::function< Object::iComponent*( Object::iObject& ) >;
+
+		static constexpr uint32_t kNoTransform = std::numeric_limits< uint32_t >::max();
+
+		// Layout of a set of trivially copyable arguments in the blob, every argument at its own aligned offset.
+		// std::tuple isn't trivially copyable in any of the standard libraries, so it can't be used for this.
+		template< class... Ty >
+		struct sPacked_Args
+		{
+			static constexpr bool kPackable = ( std::is_trivially_copyable_v< Ty > && ... ) && ( ( alignof( Ty ) <= alignof( std::max_align_t ) ) && ... );
+
+			static constexpr size_t kAlignment = std::max( { alignof( std::byte ), alignof( Ty )... } );
+
+			static constexpr auto kOffsets = []
+			{
+				std::array< size_t, sizeof...( Ty ) + 1 > offsets{};
+				size_t offset = 0, index = 0;
+				( ( offset = ( offset + alignof( Ty ) - 1 ) & ~( alignof( Ty ) - 1 ), offsets[ index++ ] = offset, offset += sizeof( Ty ) ), ... );
+				// The last one is the size of all of them.
+				offsets[ index ] = offset;
+				return offsets;
+			}();
+
+			static constexpr size_t kSize = kOffsets.back();
+		};
+
+		struct sStep
+		{
+			type_hash   type;
+			// Constructs from the argument blob, nullptr if the arguments needed to be bound instead.
+			create_fn_t create;
+			uint32_t    args_offset;
+			step_t      parent;
+			uint32_t    transform;
+			bool        enable;
+		};
+
+		// Runs the program on the object, the components are written in step order.
+		void execute( Object::iObject& _object, components_t& _components ) const;
+		// Builds a slice of a batch on the calling thread while staging.
+		void build_range( std::span< cShared_ptr< Object::iObject > > _objects, std::span< components_t > _components,
+			const std::string& _name, size_t _first_index, const customize_fn_t& _customize ) const;
+		// Builds a slice of a batch on one of the asset workers.
+		auto build_slice( std::span< cShared_ptr< Object::iObject > > _objects, std::span< components_t > _components,
+			const std::string& _name, size_t _first_index, const customize_fn_t& _customize ) const -> cTask<>;
+		// Enables the components marked to be, has to be done on the main thread once the object is in the scene.
+		void enable( const components_t& _components ) const;
+
+		std::vector< sStep >            m_steps_;
+		std::vector< std::byte >        m_args_;
+		// Arguments which aren't trivially copyable, indexed by step.
+		std::vector< bound_fn_t >       m_bound_;
+		std::vector< sLocal_Transform > m_transforms_;
+	};
+
+	template< class Ty, class... Args >
+	requires ( std::is_base_of_v< Object::iComponent, Ty > && std::constructible_from< Ty, const std::decay_t< Args >&... > )
+	auto cPrefab::AddComponent( Args&&... _args ) -> step_t
+	{
+		using packed_t = sPacked_Args< std::decay_t< Args >... >;
+
+		const auto step = static_cast< step_t >( m_steps_.size() );
+		auto& info = m_steps_.emplace_back( sStep{
+			.type        = Ty::getStaticType(),
+			.create      = nullptr,
+			.args_offset = 0,
+			.parent      = kRoot,
+			.transform   = kNoTransform,
+			.enable      = false,
+		} );
+
+		if constexpr( packed_t::kPackable )
+		{
+			const auto offset = ( m_args_.size() + packed_t::kAlignment - 1 ) & ~( packed_t::kAlignment - 1 );
+			m_args_.resize( offset + packed_t::kSize );
+
+			[ & ]< size_t... Index >( std::index_sequence< Index... > )
+			{
+				// Converted to the decayed type first, as that's what's read back.
+				( [ & ]( const std::decay_t< Args >& _value ){ std::memcpy( m_args_.data() + offset + packed_t::kOffsets[ Index ], &_value, sizeof( _value ) ); }( _args ), ... );
+			}( std::index_sequence_for< Args... >{} );
+
+			info.args_offset = static_cast< uint32_t >( offset );
+			info.create      = []( Object::iObject& _object, const std::byte* _blob ) -> Object::iComponent*
+			{
+				// The blob is allocated with the default new alignment and the offsets are aligned, so the arguments can be used in place.
+				return [ & ]< size_t... Index >( std::index_sequence< Index... > )
+				{
+					return _object.AddComponent< Ty >( *std::launder( reinterpret_cast< const std::decay_t< Args >* >( _blob + packed_t::kOffsets[ Index ] ) )... ).get();
+				}( std::index_sequence_for< Args... >{} );
+			};
+
+			m_bound_.emplace_back( nullptr );
+		}
+		else
+		{
+			using args_t = std::tuple< std::decay_t< Args >... >;
+
+			m_bound_.emplace_back( [ args = args_t{ std::forward< Args >( _args )... } ]( Object::iObject& _object ) -> Object::iComponent*
+			{
+				return std::apply( [ & ]( const auto&... _values ){ return _object.AddComponent< Ty >( _values... ).get(); }, args );
+			} );
+		}
+
+		return step;
+	} // AddComponent
+} // sk::Scene::
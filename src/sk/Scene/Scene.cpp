@@ -6,6 +6,13 @@
 
 #include "Scene.h"
 
+#include <sk/Math/Transform_Hierarchy.h>
+#include <sk/Scene/Components/MeshComponent.h>
+#include <sk/Scene/Managers/Layer_Manager.h>
+
+#include <algorithm>
+#include <chrono>
+
 namespace sk
 {
 	cScene::~cScene( void )
@@ -13,6 +20,105 @@ namespace sk
 		m_objects.clear();
 	} // ~cScene
 
+	void cScene::Destroy( const cShared_ptr< Object::iObject >& _object )
+	{
+		SK_BREAK_RET_IF( sk::Severity::kEngine, _object == nullptr || _object->m_parent_scene != this,
+			"Error: The object doesn't belong to this scene." )
+
+		// The reference may be to an element of m_objects, which the swap below overwrites.
+		const auto object = _object;
+
+		remove_meshes( *object );
+
+		// Swap and pop so destroying objects doesn't scale with the size of the scene.
+		const auto index = object->m_scene_index_;
+		if( index != m_objects.size() - 1 )
+		{
+			m_objects[ index ] = m_objects.back();
+			m_objects[ index ]->m_scene_index_ = index;
+		}
+
+		// Stops it from being rendered even if something else is still holding on to it.
+		if( const auto layer_manager = Scene::cLayer_Manager::getPtr() )
+			layer_manager->RemoveObject( object );
+
+		object->m_parent_scene = nullptr;
+		object->m_scene_index_ = std::numeric_limits< size_t >::max();
+
+		m_objects.pop_back();
+	} // Destroy
+
+	void cScene::Commit( const cShared_ptr< Object::iObject >& _object )
+	{
+		SK_BREAK_RET_IF( sk::Severity::kEngine, _object == nullptr || _object->m_parent_scene != nullptr,
+			"Error: The object is already in a scene." )
+
+		_object->commit_staged();
+		add_object( _object );
+	} // Commit
+
+	void cScene::add_object( const cShared_ptr< Object::iObject >& _object )
+	{
+		_object->m_parent_scene = this;
+		_object->m_scene_index_ = m_objects.size();
+		m_objects.emplace_back( _object );
+
+		for( const auto& mesh : _object->GetMeshComponents() )
+			add_mesh( mesh.get() );
+	} // add_object
+
+	void cScene::add_mesh( Object::Components::cMeshComponent* _mesh )
+	{
+		const auto transform = &_mesh->GetTransform();
+		m_bvh_entries.insert_or_assign( transform, sBvh_Entry{ .mesh = _mesh } );
+		m_bvh_waiting.emplace_back( transform );
+	} // add_mesh
+
+	void cScene::remove_meshes( const Object::iObject& _object )
+	{
+		// Removed right away, as the pools are free to hand the components and their transforms out again once the object is gone.
+		for( const auto& mesh : _object.GetMeshComponents() )
+		{
+			const auto entry = m_bvh_entries.find( &mesh->GetTransform() );
+			if( entry == m_bvh_entries.end() )
+				continue;
+
+			if( entry->second.proxy != cBounding_Volume_Hierarchy::kInvalid )
+				m_bvh.Remove( entry->second.proxy );
+
+			m_bvh_entries.erase( entry );
+		}
+	} // remove_meshes
+
+	auto cScene::GetBvh() -> const cBounding_Volume_Hierarchy&
+	{
+		sync_bvh();
+		return m_bvh;
+	} // GetBvh
+
+	auto cScene::AddChunk( const cVector3i32& _coord, Scene::cChunk::builder_t _builder ) -> cShared_ptr< Scene::cChunk >
+	{
+		const auto existing = std::ranges::find_if( m_chunks, [ & ]( const auto& _chunk )
+		{
+			const auto& coord = _chunk->GetCoord();
+			return coord.x == _coord.x && coord.y == _coord.y && coord.z == _coord.z;
+		} );
+		SK_BREAK_RET_IF( sk::Severity::kEngine, existing != m_chunks.end(),
+			TEXT( "Error: The scene already has a chunk at {}, {}, {}.", _coord.x, _coord.y, _coord.z ), *existing )
+
+		return m_chunks.emplace_back( sk::make_shared< Scene::cChunk >( _coord, m_streaming_settings.chunk_size, std::move( _builder ) ) );
+	} // AddChunk
+
+	void cScene::AddStreamingSource( const cShared_ptr< Object::iObject >& _source )
+	{
+		m_streaming_sources.emplace_back( _source );
+	} // AddStreamingSource
+
+	void cScene::RemoveStreamingSource( const cShared_ptr< Object::iObject >& _source )
+	{
+		std::erase_if( m_streaming_sources, [ & ]( const auto& _other ){ return _other == _source; } );
+	} // RemoveStreamingSource
+
 	void cScene::force_render( void )
 	{
 		// TODO: Get rid of this
@@ -25,7 +131,213 @@ namespace sk
 
 	void cScene::force_update( void )
 	{
+		update_streaming();
+
 		for( auto& obj : m_objects )
 			obj->update();
 	} // update
+
+	void cScene::update_streaming( void )
+	{
+		using eState = Scene::cChunk::eState;
+
+		if( m_chunks.empty() && m_remove_queue.empty() )
+			return;
+
+		std::erase_if( m_streaming_sources, []( const auto& _source ){ return !_source.is_valid(); } );
+
+		uint32_t loading = 0;
+		uint32_t loaded  = 0;
+		for( auto& chunk : m_chunks )
+		{
+			bool in_load_range = false;
+			bool in_keep_range = false;
+			for( auto& source : m_streaming_sources )
+			{
+				const auto& position = source->GetTransform().GetWorldPosition();
+				in_load_range |= chunk->GetBounds().Intersects( position, m_streaming_settings.load_distance );
+				in_keep_range |= chunk->GetBounds().Intersects( position, m_streaming_settings.unload_distance );
+			}
+
+			switch( chunk->GetState() )
+			{
+			case eState::kUnloaded:
+			{
+				if( !in_load_range )
+					break;
+
+				chunk->m_state_.store( eState::kLoading );
+				Scene::cChunk::load( chunk ).Start();
+				loading++;
+			}
+			break;
+			case eState::kLoading:
+				// The worker owns the chunk until it's staged, so leaving the range is handled once it is.
+				loading++;
+				break;
+			case eState::kStaged:
+			{
+				if( !in_keep_range )
+				{
+					unload_chunk( chunk );
+					break;
+				}
+
+				chunk->m_state_.store( eState::kCommitting );
+				m_commit_queue.emplace_back( chunk );
+				loading++;
+			}
+			break;
+			case eState::kCommitting:
+			case eState::kLoaded:
+			{
+				if( !in_keep_range )
+				{
+					unload_chunk( chunk );
+					break;
+				}
+
+				chunk->GetState() == eState::kLoaded ? loaded++ : loading++;
+			}
+			break;
+			}
+		}
+
+		using clock_t = std::chrono::steady_clock;
+		const auto start     = clock_t::now();
+		const auto budget    = std::chrono::duration< float, std::milli >( m_streaming_settings.frame_budget );
+		const auto in_budget = [ & ]{ return clock_t::now() - start < budget; };
+
+		// Removing first gives the pools back the slots the committed objects are about to use.
+		// At least one object is removed and one committed every update, so a budget smaller than a single object still makes progress.
+		uint32_t removed = 0;
+		while( !m_remove_queue.empty() && ( removed == 0 || in_budget() ) )
+		{
+			// The object might've been destroyed already, or never been committed at all.
+			if( const auto& object = m_remove_queue.back(); object->m_parent_scene == this )
+				Destroy( object );
+
+			m_remove_queue.pop_back();
+			removed++;
+		}
+
+		uint32_t committed = 0;
+		while( !m_commit_queue.empty() && ( committed == 0 || in_budget() ) )
+		{
+			auto& chunk = *m_commit_queue.front();
+			if( chunk.m_committed_ == chunk.m_staged_.size() )
+			{
+				chunk.m_staged_.clear();
+				chunk.m_committed_ = 0;
+				chunk.m_state_.store( eState::kLoaded );
+				m_commit_queue.erase( m_commit_queue.begin() );
+				continue;
+			}
+
+			auto& object = chunk.m_staged_[ chunk.m_committed_++ ];
+			Commit( object );
+			chunk.m_objects_.emplace_back( std::move( object ) );
+			committed++;
+		}
+
+		const auto frame_time = std::chrono::duration< float, std::milli >( clock_t::now() - start ).count();
+
+		auto& stats = m_streaming_stats;
+		stats.frame_time     = frame_time;
+		stats.max_frame_time = std::max( stats.max_frame_time, frame_time );
+		stats.over_budget   += frame_time > m_streaming_settings.frame_budget ? 1 : 0;
+		stats.committed     += committed;
+		stats.removed       += removed;
+		stats.loading_chunks = loading;
+		stats.loaded_chunks  = loaded;
+	} // update_streaming
+
+	void cScene::unload_chunk( const cShared_ptr< Scene::cChunk >& _chunk )
+	{
+		using eState = Scene::cChunk::eState;
+
+		if( _chunk->GetState() == eState::kCommitting )
+			std::erase( m_commit_queue, _chunk );
+
+		// Both the committed objects and the ones that were never committed are removed in slices.
+		m_remove_queue.insert( m_remove_queue.end(), std::make_move_iterator( _chunk->m_objects_.begin() ), std::make_move_iterator( _chunk->m_objects_.end() ) );
+		m_remove_queue.insert( m_remove_queue.end(),
+			std::make_move_iterator( _chunk->m_staged_.begin() + static_cast< ptrdiff_t >( _chunk->m_committed_ ) ),
+			std::make_move_iterator( _chunk->m_staged_.end() ) );
+
+		_chunk->m_objects_.clear();
+		_chunk->m_staged_.clear();
+		_chunk->m_committed_ = 0;
+
+		for( const auto& dependency : _chunk->m_dependencies_ )
+		{
+			if( dependency->IsRequested() )
+				dependency->Unload();
+		}
+
+		_chunk->m_state_.store( eState::kUnloaded );
+	} // unload_chunk
+
+	void cScene::sync_bvh( void )
+	{
+		const auto& hierarchy    = cTransform_Hierarchy::get();
+		const auto  update_count = hierarchy.GetUpdateCount();
+
+		if( update_count == m_bvh_sync + 1 )
+		{
+			// Only what the hierarchy updated since the last sync can have moved.
+			for( const auto transform : hierarchy.GetUpdated() )
+			{
+				if( const auto entry = m_bvh_entries.find( transform ); entry != m_bvh_entries.end() && !entry->second.waiting )
+					refresh_mesh( transform, entry->second );
+			}
+		}
+		else if( update_count != m_bvh_sync )
+		{
+			// Missed some updates, the versions tell what has moved since.
+			for( auto& [ transform, entry ] : m_bvh_entries )
+			{
+				if( !entry.waiting && entry.transform_version != transform->GetVersion() )
+					refresh_mesh( transform, entry );
+			}
+		}
+
+		m_bvh_sync = update_count;
+
+		std::erase_if( m_bvh_waiting, [ this ]( const cTransform* _transform )
+		{
+			// Destroyed, or already handled through an earlier entry for the same transform.
+			const auto entry = m_bvh_entries.find( _transform );
+			if( entry == m_bvh_entries.end() || !entry->second.waiting )
+				return true;
+
+			if( !entry->second.mesh->IsReady() )
+				return false;
+
+			entry->second.waiting = false;
+			refresh_mesh( _transform, entry->second );
+			return true;
+		} );
+
+		m_bvh.Update();
+	} // sync_bvh
+
+	void cScene::refresh_mesh( const cTransform* _transform, sBvh_Entry& _entry )
+	{
+		// The bounds come from the mesh, so they can't be trusted until it's ready again.
+		if( !_entry.mesh->IsReady() )
+		{
+			_entry.waiting = true;
+			m_bvh_waiting.emplace_back( _transform );
+			return;
+		}
+
+		const auto& bounds = _entry.mesh->UpdateBounds();
+		_entry.transform_version = _transform->GetVersion();
+
+		if( _entry.proxy == cBounding_Volume_Hierarchy::kInvalid )
+			_entry.proxy = m_bvh.Insert( bounds, _entry.mesh );
+		else
+			m_bvh.Move( _entry.proxy, bounds );
+	} // refresh_mesh
 } // sk::
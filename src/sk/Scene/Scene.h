@@ -8,19 +8,48 @@
 
 
 #include <sk/Assets/Asset.h>
+#include <sk/Math/Bounding_Volume_Hierarchy.h>
 #include <sk/Scene/Object.h>
+#include <sk/Scene/Scene_Chunk.h>
 
 namespace sk
 {
 	namespace Object::Components
 	{
 		class cCamera;
+		class cMeshComponent;
 	} // Objects::Components
 
 	SK_ASSET_CLASS( Scene )
 	{
 		SK_CLASS_BODY( Scene )
 	public:
+		struct sStreaming_Settings
+		{
+			// Size of the chunks along every axis, has to be set before any chunks are added.
+			float chunk_size      = 64.0f;
+			// Chunks closer than this to a streaming source are loaded.
+			float load_distance   = 128.0f;
+			// Chunks further than this from every source are unloaded. Larger than the load distance so chunks on the edge don't thrash.
+			float unload_distance = 192.0f;
+			// Milliseconds per update the scene is allowed to spend committing and removing chunk objects.
+			// At least one of each is done every update, however small the budget is.
+			float frame_budget    = 1.0f;
+		};
+
+		struct sStreaming_Stats
+		{
+			// Milliseconds spent committing and removing chunk objects in the last update.
+			float    frame_time     = 0.0f;
+			float    max_frame_time = 0.0f;
+			// Updates where the last object committed or removed went past the budget.
+			uint32_t over_budget    = 0;
+			uint32_t committed      = 0;
+			uint32_t removed        = 0;
+			uint32_t loading_chunks = 0;
+			uint32_t loaded_chunks  = 0;
+		};
+
 		cScene() = default;
 
 		~cScene() override;
@@ -31,16 +60,93 @@ namespace sk
 		cShared_ptr< Ty > create_object( const std::string& _name, Args... _args )
 		{
 			auto shared = sk::make_shared< Ty >( _name, _args... );
-			m_objects.emplace_back( shared );
+			add_object( shared );
 			return shared;
 		} // create_object
 
+		// Same as create_object, but the object is constructed in a recycled slot from the pool of its type.
+		// Meant for objects that are spawned and destroyed often.
+		template< class Ty = Object::iObject, class... Args >
+		requires ( std::is_base_of_v< Object::iObject, Ty > && std::constructible_from< Ty, const std::string&, Args... > )
+		cShared_ptr< Ty > Instantiate( const std::string& _name, Args&&... _args )
+		{
+			auto shared = sk::make_pooled< Ty >( _name, std::forward< Args >( _args )... );
+			add_object( shared );
+			return shared;
+		} // Instantiate
+
+		// Removes the object from the scene, it's returned to its pool once nothing else references it.
+		void Destroy( const cShared_ptr< Object::iObject >& _object );
+
+		// Adds an object built while staging, registering it and its components with the managers. Main thread only.
+		void Commit( const cShared_ptr< Object::iObject >& _object );
+
+		// The chunk is loaded once a streaming source gets close enough to it, see Scene::cChunk.
+		auto AddChunk( const cVector3i32& _coord, Scene::cChunk::builder_t _builder ) -> cShared_ptr< Scene::cChunk >;
+
+		// Objects the chunks are streamed around, like cameras.
+		void AddStreamingSource   ( const cShared_ptr< Object::iObject >& _source );
+		void RemoveStreamingSource( const cShared_ptr< Object::iObject >& _source );
+
+		void SetStreamingSettings( const sStreaming_Settings& _settings ){ m_streaming_settings = _settings; }
+		[[ nodiscard ]] auto& GetStreamingSettings() const { return m_streaming_settings; }
+
+		// Reset the stats before something like a flythrough to measure the cost of streaming during it.
+		[[ nodiscard ]] auto& GetStreamingStats() const { return m_streaming_stats; }
+		void ResetStreamingStats(){ m_streaming_stats = {}; }
+
 		void force_render( void );
 		void force_update( void );
 
+		// World space bounds of the mesh components in the scene, the user data of every proxy is the cMeshComponent it belongs to.
+		// Only brought up to date with what has moved when asked for, so the scene doesn't pay for it unless it's used.
+		// Meshes are added once they're ready, but stay in after being unloaded, so check IsReady when querying.
+		[[ nodiscard ]] auto GetBvh() -> const cBounding_Volume_Hierarchy&;
+
 	private:
+		struct sBvh_Entry
+		{
+			Object::Components::cMeshComponent* mesh;
+			cBounding_Volume_Hierarchy::proxy_t proxy             = cBounding_Volume_Hierarchy::kInvalid;
+			uint32_t                            transform_version = 0;
+			// Waiting for the mesh to be ready before its bounds can be used.
+			bool                                waiting           = true;
+		};
+
+		void add_object( const cShared_ptr< Object::iObject >& _object );
+
+		// The objects own their mesh components, so they're added along with the object and removed when it's destroyed.
+		void add_mesh     ( Object::Components::cMeshComponent* _mesh );
+		void remove_meshes( const Object::iObject& _object );
+		void refresh_mesh ( const cTransform* _transform, sBvh_Entry& _entry );
+
+		// Loads and unloads chunks based on the streaming sources, then commits and removes chunk objects within the frame budget.
+		void update_streaming( void );
+		void unload_chunk( const cShared_ptr< Scene::cChunk >& _chunk );
+
+		// Moves the proxies of the meshes whose transform was updated since the last sync, and adds the meshes which became ready.
+		void sync_bvh( void );
+
+		cBounding_Volume_Hierarchy                     m_bvh         = {};
+		// Keyed by the transform of the mesh, as that's what the transform hierarchy reports as moved.
+		unordered_map< const cTransform*, sBvh_Entry > m_bvh_entries = {};
+		vector< const cTransform* >                    m_bvh_waiting = {};
+		// The transform hierarchy update the proxies were last synced with.
+		uint64_t                                       m_bvh_sync    = 0;
+
+		vector< cShared_ptr< Scene::cChunk > >   m_chunks             = {};
+		vector< cWeak_Ptr< Object::iObject > >   m_streaming_sources  = {};
+		// Chunks with staged objects left to commit, in the order they finished loading.
+		vector< cShared_ptr< Scene::cChunk > >   m_commit_queue       = {};
+		// Objects from unloaded chunks waiting to be removed.
+		vector< cShared_ptr< Object::iObject > > m_remove_queue       = {};
+		sStreaming_Settings                      m_streaming_settings = {};
+		sStreaming_Stats                         m_streaming_stats    = {};
+
 		// TODO: Replace this with a map.
 		vector< cShared_ptr< Object::iObject > > m_objects = {};
+
+		friend class Object::iObject;
 	};
 
 } // sk::
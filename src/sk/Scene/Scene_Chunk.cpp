@@ -0,0 +1,48 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Scene_Chunk.h"
+
+#include <sk/Assets/Management/Asset_Job_Manager.h>
+#include <sk/Debugging/Macros/Assert.h>
+#include <sk/Scene/Staging.h>
+
+namespace sk::Scene
+{
+	cChunk::cChunk( const cVector3i32& _coord, const float _size, builder_t _builder )
+	: m_coord_( _coord )
+	, m_builder_( std::move( _builder ) )
+	{
+		const auto min = cVector3f( static_cast< float >( _coord.x ), static_cast< float >( _coord.y ), static_cast< float >( _coord.z ) ) * _size;
+		m_bounds_ = cAABBf( min, min + cVector3f( _size ) );
+	} // cChunk
+
+	auto cChunk::load( const cShared_ptr< cChunk > _chunk ) -> cTask<>
+	{
+		co_await Assets::Jobs::cAsset_Job_Manager::ResumeOnWorker();
+
+		// The builder and the waits below would stall the frame if they ever ran on the main thread.
+		SK_ERR_IFN( Assets::Jobs::cAsset_Job_Manager::IsWorkerThread(),
+			"Error: Scene chunks have to be loaded on an asset worker." )
+
+		for( const auto& dependency : _chunk->m_dependencies_ )
+		{
+			if( !dependency->IsRequested() )
+				dependency->LoadAsync();
+		}
+
+		// Helps out with the other asset jobs while waiting, as they might be what's being waited on.
+		for( const auto& dependency : _chunk->m_dependencies_ )
+			dependency->WaitUntilLoaded();
+
+		{
+			cStaging_Scope staging;
+			_chunk->m_builder_( *_chunk );
+		}
+
+		_chunk->m_state_.store( eState::kStaged, std::memory_order_release );
+	} // load
+} // sk::Scene::
@@ -0,0 +1,100 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include <sk/Assets/Access/Asset_Ptr.h>
+#include <sk/Math/AABB.h>
+#include <sk/Math/Vector3.h>
+#include <sk/Misc/Smart_Ptrs.h>
+#include <sk/Misc/Task.h>
+#include <sk/Scene/Object.h>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+
+namespace sk
+{
+	class cAsset_Meta;
+	class cScene;
+} // sk::
+
+namespace sk::Scene
+{
+	// A cell of a streamed scene. The chunk owns the objects inside of it and the assets they depend on.
+	// Loading happens on the asset workers, the built objects are then committed to the scene by it in bounded slices.
+	class cChunk
+	{
+	public:
+		// Called on an asset worker once the dependencies are loaded, objects have to be created through Instantiate.
+		// Components registering with a manager in their constructor, like cameras and lights, can't be built here.
+		using builder_t      = std::function< void( cChunk& ) >;
+		using dependencies_t = vector< std::unique_ptr< cAsset_Ptr_Base > >;
+
+		enum class eState : uint8_t
+		{
+			kUnloaded,
+			// The dependencies are being loaded and the objects built on a worker.
+			kLoading,
+			// Built and waiting to be committed to the scene.
+			kStaged,
+			// The staged objects are being committed to the scene.
+			kCommitting,
+			kLoaded,
+		};
+
+		cChunk( const cVector3i32& _coord, float _size, builder_t _builder );
+
+		// The dependencies are loaded before the builder runs, and kept loaded until the chunk is unloaded.
+		// Has to be added while the chunk is unloaded.
+		template< class Ty >
+		requires std::is_base_of_v< cAsset, Ty >
+		void AddDependency( const cShared_ptr< cAsset_Meta >& _meta )
+		{
+			SK_BREAK_RET_IF( sk::Severity::kEngine, GetState() != eState::kUnloaded,
+				"Error: Dependencies can only be added to unloaded chunks." )
+
+			m_dependencies_.emplace_back( std::make_unique< cAsset_Ptr< Ty > >( nullptr, _meta ) );
+		} // AddDependency
+
+		// Only valid inside of the builder. The object is added to the scene when the chunk is committed.
+		template< class Ty = Object::iObject, class... Args >
+		requires ( std::is_base_of_v< Object::iObject, Ty > && std::constructible_from< Ty, const std::string&, Args... > )
+		auto Instantiate( const std::string& _name, Args&&... _args ) -> cShared_ptr< Ty >
+		{
+			auto object = sk::make_pooled< Ty >( _name, std::forward< Args >( _args )... );
+			m_staged_.emplace_back( object );
+			return object;
+		} // Instantiate
+
+		[[ nodiscard ]] auto& GetCoord () const { return m_coord_; }
+		[[ nodiscard ]] auto& GetBounds() const { return m_bounds_; }
+		[[ nodiscard ]] auto  GetState () const { return m_state_.load( std::memory_order_acquire ); }
+
+		[[ nodiscard ]] auto& GetDependencies() const { return m_dependencies_; }
+		[[ nodiscard ]] auto& GetObjects     () const { return m_objects_; }
+
+	private:
+		// Loads the dependencies and runs the builder, the chunk is staged once it's done.
+		static auto load( cShared_ptr< cChunk > _chunk ) -> cTask<>;
+
+		cVector3i32    m_coord_;
+		cAABBf         m_bounds_;
+		builder_t      m_builder_;
+		dependencies_t m_dependencies_;
+
+		vector< cShared_ptr< Object::iObject > > m_staged_;
+		vector< cShared_ptr< Object::iObject > > m_objects_;
+		// How many of the staged objects have been committed.
+		size_t                                   m_committed_ = 0;
+
+		// Only the worker loading the chunk sets it to staged, everything else happens on the main thread.
+		std::atomic< eState > m_state_ = eState::kUnloaded;
+
+		friend class sk::cScene;
+	};
+} // sk::Scene::
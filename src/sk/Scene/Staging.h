@@ -0,0 +1,33 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+namespace sk::Scene
+{
+	namespace Internal
+	{
+		inline auto staging_flag() -> bool&
+		{
+			thread_local bool staging = false;
+			return staging;
+		}
+	} // Internal::
+
+	// True while the current thread is building objects for a streamed chunk.
+	// Objects and components created while staging hold on to their manager registrations until they're committed on the main thread.
+	[[ nodiscard ]] inline bool IsStaging(){ return Internal::staging_flag(); }
+
+	class cStaging_Scope
+	{
+	public:
+		 cStaging_Scope(){ Internal::staging_flag() = true; }
+		~cStaging_Scope(){ Internal::staging_flag() = false; }
+
+		cStaging_Scope( const cStaging_Scope& ) = delete;
+		cStaging_Scope& operator=( const cStaging_Scope& ) = delete;
+	};
+} // sk::Scene::
@@ -0,0 +1,104 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Test.h"
+
+#include <sk/Math/Transform_Hierarchy.h>
+#include <sk/Scene/Object.h>
+#include <sk/Scene/Components/SpinComponent.h>
+#include <sk/Scene/Managers/Archetype_Manager.h>
+#include <sk/Scene/Managers/EventManager.h>
+#include <sk/Scene/Managers/Internal_Component_Manager.h>
+#include <sk/Scene/Managers/Layer_Manager.h>
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+    constexpr size_t kObjects = 1'000'000;
+    constexpr float  kDelta   = 1.0f / 60.0f;
+
+    struct sVelocity
+    {
+        sk::cVector3f value;
+    };
+} // ::
+
+REGISTER_TYPE( sVelocity, "Velocity" )
+
+using namespace sk::Object::Components;
+
+// Iterates 1M objects with a spin component, through the component map of every object and through the archetypes.
+int main()
+{
+    sk::cEventManager::init();
+    sk::cTransform_Hierarchy::init();
+    sk::Scene::cLayer_Manager::init();
+    sk::Scene::cInternal_Component_Manager::init();
+    auto& archetypes = sk::Scene::cArchetype_Manager::init();
+
+    std::vector< sk::cShared_ptr< sk::Object::iObject > > objects;
+    objects.reserve( kObjects );
+    for( size_t i = 0; i < kObjects; i++ )
+    {
+        auto& object = objects.emplace_back( sk::make_pooled< sk::Object::iObject >( "Object" ) );
+        object->GetTransform().SetPosition( sk::cVector3f{ static_cast< float >( i % 1000 ), 0.0f, static_cast< float >( i / 1000 ) } );
+        object->AddComponent< cSpinComponent >();
+        object->AddComponent< sVelocity >( sk::cVector3f{ 0.0f, 1.0f, 0.0f } );
+    }
+
+    // The layout every object has without the archetypes, a lookup in the component map and a pointer to follow for each of them.
+    double pointer_sum = 0.0;
+    const auto pointer_ms = sk::Testing::Measure( 10, [ & ]
+    {
+        pointer_sum = 0.0;
+        for( const auto& object : objects )
+        {
+            if( object->GetComponent< cSpinComponent >() != nullptr )
+                pointer_sum += object->GetTransform().GetPosition().x;
+        }
+    } );
+
+    double archetype_sum = 0.0;
+    const auto archetype_ms = sk::Testing::Measure( 10, [ & ]
+    {
+        archetype_sum = 0.0;
+        archetypes.ForEach< sk::cTransform, cSpinComponent >( [ & ]( const sk::cTransform& _transform, cSpinComponent& )
+        {
+            archetype_sum += _transform.GetPosition().x;
+        } );
+    } );
+
+    // Data components are stored in the archetype itself, so only the transform is behind a pointer. Runs last as it moves the objects.
+    const auto data_ms = sk::Testing::Measure( 10, [ & ]
+    {
+        archetypes.ForEach< sk::cTransform, sVelocity >( [ & ]( sk::cTransform& _transform, const sVelocity& _velocity )
+        {
+            _transform.GetPosition() += _velocity.value * kDelta;
+        } );
+    } );
+
+    std::println( "Archetypes, {} objects in {} archetypes", kObjects, archetypes.GetArchetypeCount() );
+    std::println( "Component map: {:.3f} ms", pointer_ms );
+    std::println( "Archetypes:    {:.3f} ms", archetype_ms );
+    std::println( "Data:          {:.3f} ms", data_ms );
+
+    // Both have to visit every object, or the timings aren't comparable.
+    const bool valid = std::abs( pointer_sum - archetype_sum ) <= 1e-6 * std::abs( pointer_sum ) && pointer_sum > 0.0;
+    if( !valid )
+        std::println( stderr, "The component map and the archetypes didn't visit the same objects." );
+
+    objects.clear();
+
+    sk::Scene::cArchetype_Manager::shutdown();
+    sk::Scene::cInternal_Component_Manager::shutdown();
+    sk::Scene::cLayer_Manager::shutdown();
+    sk::cTransform_Hierarchy::shutdown();
+    sk::cEventManager::shutdown();
+
+    return valid ? 0 : 1;
+}
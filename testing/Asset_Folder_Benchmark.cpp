@@ -0,0 +1,153 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Test.h"
+
+#include <sk/Assets/Mesh.h>
+#include <sk/Assets/Management/Asset_Job_Manager.h>
+#include <sk/Assets/Management/Asset_Manager.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <unordered_set>
+
+namespace
+{
+    // 50k files spread over a few hundred folders, like an imported asset library.
+    constexpr size_t kFolders    = 8;
+    constexpr size_t kSubFolders = 25;
+    constexpr size_t kFiles      = 250;
+    constexpr size_t kTotal      = kFolders * kSubFolders * kFiles;
+    constexpr size_t kRuns       = 3;
+
+    // Only creates the metas, the files are never loaded.
+    void load_meta( const std::filesystem::path& _path, sk::Assets::cAsset_List& _metas, const sk::Assets::eAssetTask _task )
+    {
+        if( _task == sk::Assets::eAssetTask::kLoadMeta )
+            _metas.AddAsset( sk::make_shared< sk::cAsset_Meta >( _path.stem().string(), &sk::kTypeInfo< sk::Assets::cMesh > ) );
+    } // load_meta
+
+    void make_files( const std::filesystem::path& _root )
+    {
+        for( size_t f = 0; f < kFolders; f++ )
+        {
+            for( size_t s = 0; s < kSubFolders; s++ )
+            {
+                const auto folder = _root / std::to_string( f ) / std::to_string( s );
+                std::filesystem::create_directories( folder );
+
+                for( size_t i = 0; i < kFiles; i++ )
+                    std::ofstream( folder / ( std::to_string( i ) + ".skbench" ) );
+            }
+        }
+    } // make_files
+
+    // A scan has to be timed from scratch every time, as the manager keeps every meta it registered.
+    template< class Fn >
+    auto once( Fn&& _fn )
+    {
+        const auto start = std::chrono::steady_clock::now();
+        _fn();
+        return std::chrono::duration< double, std::milli >( std::chrono::steady_clock::now() - start ).count();
+    } // once
+
+    struct sScan
+    {
+        double ms      = 0.0;
+        size_t metas   = 0;
+        size_t workers = 0;
+        // Every file has to end up registered exactly once, under its own path.
+        bool   valid   = true;
+    };
+
+    // What loadFolder did before, walking everything on the calling thread and registering a file at a time.
+    auto load_folder_sequential( sk::cAsset_Manager& _manager, const std::filesystem::path& _root )
+    {
+        sk::Assets::cAsset_List assets;
+        for( const auto& entry : std::filesystem::recursive_directory_iterator( _root ) )
+        {
+            if( entry.is_regular_file() )
+                assets += _manager.loadFile( entry.path() );
+        }
+        return assets;
+    } // load_folder_sequential
+
+    auto scan( const std::filesystem::path& _root, const bool _parallel ) -> sScan
+    {
+        const sk::cStringID extension{ "skbench" };
+
+        auto& manager = sk::cAsset_Manager::init();
+        manager.AddFileLoaderForExtension( extension, &load_meta );
+
+        sScan result;
+        result.workers = sk::Assets::Jobs::cAsset_Job_Manager::get().GetWorkerCount();
+
+        sk::Assets::cAsset_List assets;
+        result.ms = once( [ & ]{ assets = _parallel ? manager.loadFolder( _root ) : load_folder_sequential( manager, _root ); } );
+
+        std::unordered_set< std::string > paths;
+        for( const auto& meta : assets )
+        {
+            result.metas++;
+            paths.emplace( meta->GetAbsolutePath().view() );
+        }
+
+        result.valid = result.metas == kTotal && paths.size() == kTotal;
+        for( const auto& path : paths )
+        {
+            size_t registered = 0;
+            for( const auto& meta : manager.GetAssetsByPath( path ) )
+                registered += meta->GetAbsolutePath().view() == path;
+            result.valid &= registered == 1;
+        }
+
+        // Without a loader the metas are dropped straight away on shutdown, instead of queueing an unload for each.
+        manager.RemoveFileLoaders( { extension } );
+        sk::cAsset_Manager::shutdown();
+
+        return result;
+    } // scan
+} // ::
+
+// Registers 50k files through loadFolder, and by walking the folders and loading a file at a time like it used to.
+int main()
+{
+    const auto root = std::filesystem::temp_directory_path() / "skape_asset_folder_benchmark";
+    std::filesystem::remove_all( root );
+    make_files( root );
+
+    // The first walk of the new files is left out, so both start with the file system cache just as warm.
+    scan( root, true );
+
+    size_t workers       = 0;
+    bool   valid         = true;
+    double parallel_ms   = 0.0;
+    double sequential_ms = 0.0;
+    for( size_t i = 0; i < kRuns; i++ )
+    {
+        const auto parallel   = scan( root, true );
+        const auto sequential = scan( root, false );
+
+        parallel_ms   += parallel  .ms / kRuns;
+        sequential_ms += sequential.ms / kRuns;
+        workers = parallel.workers;
+        valid  &= parallel.valid && sequential.valid;
+    }
+
+    std::filesystem::remove_all( root );
+
+    std::println( "Asset folder, {} files in {} folders, {} asset workers", kTotal, kFolders * kSubFolders, workers );
+    std::println( "Parallel:   {:.3f} ms", parallel_ms );
+    std::println( "Sequential: {:.3f} ms", sequential_ms );
+    std::println( "Speedup:    {:.2f}x", sequential_ms / parallel_ms );
+
+    if( !valid )
+        std::println( stderr, "A file was missing, or registered more than once." );
+
+    return valid ? 0 : 1;
+}
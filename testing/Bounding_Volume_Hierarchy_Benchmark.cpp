@@ -0,0 +1,142 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Test.h"
+
+#include <sk/Math/Bounding_Volume_Hierarchy.h>
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr size_t kQueries = 1'000;
+    // Boxes inserted along a line from the far end all land in the first leaf, which makes the tree about half this deep until it's rebuilt.
+    // Every level leaves its right child on the query stack.
+    constexpr size_t kLine    = 10'000;
+    constexpr float  kWorld   = 1'000.0f;
+
+    // Measure runs everything twice, inserting can only be done once.
+    template< class Fn >
+    auto once( Fn&& _fn )
+    {
+        const auto start = std::chrono::steady_clock::now();
+        _fn();
+        return std::chrono::duration< double, std::milli >( std::chrono::steady_clock::now() - start ).count();
+    } // once
+
+    auto make_box( std::mt19937& _random, const float _size )
+    {
+        std::uniform_real_distribution position( 0.0f, kWorld );
+        std::uniform_real_distribution extent  ( 0.1f, _size );
+        const sk::cVector3f center{ position( _random ), position( _random ), position( _random ) };
+        return sk::cAABBf::FromCenterExtents( center, sk::cVector3f{ extent( _random ), extent( _random ), extent( _random ) } );
+    } // make_box
+
+    // Builds, refits and queries a tree of _count proxies, checking some of the queries against testing every box.
+    bool run( const size_t _count )
+    {
+        std::mt19937 random{ 1 };
+
+        std::vector< sk::cAABBf > boxes( _count );
+        for( auto& box : boxes )
+            box = make_box( random, 2.0f );
+
+        sk::cBounding_Volume_Hierarchy bvh;
+        std::vector< sk::cBounding_Volume_Hierarchy::proxy_t > proxies( _count );
+
+        const auto insert_ms = once( [ & ]
+        {
+            for( size_t i = 0; i < _count; i++ )
+                proxies[ i ] = bvh.Insert( boxes[ i ] );
+        } );
+
+        const auto build_ms = sk::Testing::Measure( 5, [ & ]{ bvh.Rebuild(); } );
+
+        // Everything moves a little, like a frame of a busy scene.
+        std::uniform_real_distribution step( -0.5f, 0.5f );
+        const auto refit_ms = sk::Testing::Measure( 10, [ & ]
+        {
+            for( size_t i = 0; i < _count; i++ )
+            {
+                const sk::cVector3f offset{ step( random ), step( random ), step( random ) };
+                boxes[ i ] = { boxes[ i ].GetMin() + offset, boxes[ i ].GetMax() + offset };
+                bvh.Move( proxies[ i ], boxes[ i ] );
+            }
+            bvh.Refit();
+        } );
+        bvh.Update();
+
+        std::vector< sk::cAABBf > queries( kQueries );
+        for( auto& query : queries )
+            query = make_box( random, 20.0f );
+
+        size_t hits = 0;
+        const auto query_ms = sk::Testing::Measure( 10, [ & ]
+        {
+            hits = 0;
+            for( const auto& query : queries )
+                bvh.QueryAABB( query, [ & ]( sk::cBounding_Volume_Hierarchy::proxy_t ){ hits++; } );
+        } );
+
+        bool valid = bvh.GetSize() == _count;
+        for( size_t q = 0; q < 10; q++ )
+        {
+            size_t expected = 0, found = 0;
+            for( const auto& box : boxes )
+                expected += box.Intersects( queries[ q ] );
+            bvh.QueryAABB( queries[ q ], [ & ]( sk::cBounding_Volume_Hierarchy::proxy_t ){ found++; } );
+            valid &= found == expected;
+        }
+
+        std::println( "{} proxies, {} nodes", _count, bvh.GetNodeCount() );
+        std::println( "Insert:        {:.3f} ms", insert_ms );
+        std::println( "Rebuild:       {:.3f} ms", build_ms );
+        std::println( "Move + refit:  {:.3f} ms", refit_ms );
+        std::println( "{} queries: {:.3f} ms, {} hits", kQueries, query_ms, hits );
+
+        return valid;
+    } // run
+
+    // The queries used to keep a fixed stack of nodes, which this tree overflowed.
+    bool run_deep()
+    {
+        sk::cBounding_Volume_Hierarchy bvh;
+        for( size_t i = 0; i < kLine; i++ )
+        {
+            const sk::cVector3f center{ static_cast< float >( kLine - 1 - i ), 0.0f, 0.0f };
+            bvh.Insert( sk::cAABBf::FromCenterExtents( center, sk::cVector3f{ 0.25f, 0.25f, 0.25f } ) );
+        }
+
+        // Nothing has moved, so it can be queried without the update that would rebuild it.
+        size_t found = 0;
+        const auto query_ms = sk::Testing::Measure( 10, [ & ]
+        {
+            found = 0;
+            bvh.QueryAABB( { sk::cVector3f{ -1.0f }, sk::cVector3f{ static_cast< float >( kLine ) } }, [ & ]( sk::cBounding_Volume_Hierarchy::proxy_t ){ found++; } );
+        } );
+
+        std::println( "{} proxies inserted along a line, {} nodes", kLine, bvh.GetNodeCount() );
+        std::println( "Query all:     {:.3f} ms", query_ms );
+
+        return found == kLine;
+    } // run_deep
+} // ::
+
+// Builds, refits and queries trees of 100k and 1M proxies, then queries a tree deeper than the query stack.
+int main()
+{
+    bool valid = true;
+    for( const size_t count : { 100'000, 1'000'000 } )
+        valid &= run( count );
+    valid &= run_deep();
+
+    if( !valid )
+        std::println( stderr, "The tree didn't find the same boxes as testing every one of them." );
+
+    return valid ? 0 : 1;
+}
@@ -0,0 +1,115 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Test.h"
+
+#include <sk/Graphics/Utils/Command_Buffer.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace sk::Graphics::Utils;
+
+namespace
+{
+    constexpr size_t kDraws     = 20'000;
+    constexpr size_t kMaterials = 64;
+    constexpr size_t kMeshes    = 512;
+    // Every eighth draw is instanced.
+    constexpr size_t kInstances = 16;
+
+    // Only ever compared, never dereferenced, so the backend doesn't need any assets.
+    template< class Ty >
+    auto fake( const size_t _index ){ return reinterpret_cast< Ty* >( static_cast< uintptr_t >( ( _index + 1 ) * 64 ) ); }
+
+    // Records a frame sorted like a draw list would leave it, the material changing least often.
+    void record( cCommand_Buffer& _buffer, const size_t _draws )
+    {
+        _buffer.Clear();
+
+        auto world = sk::cMatrix4x4f{};
+        for( size_t i = 0; i < _draws; i++ )
+        {
+            if( i % ( _draws / kMaterials ) == 0 )
+                _buffer.Push( Commands::sUse_Material{ .material = fake< sk::Assets::cMaterial >( i ) } );
+            if( i % ( _draws / kMeshes ) == 0 )
+                _buffer.Push( Commands::sBind_Mesh{ .mesh = fake< sk::Assets::cMesh >( i ), .lod = 0 } );
+
+            world.w.x = static_cast< float >( i );
+
+            if( i % 8 != 7 )
+            {
+                _buffer.Push( Commands::sDraw{ .world = world, .inverse_world = world } );
+                continue;
+            }
+
+            const auto instances = _buffer.Push< sInstance_Data >( Commands::sDraw_Instanced{ .count = kInstances }, kInstances );
+            for( auto& instance : instances )
+                instance = sInstance_Data{ .world = world, .inverse_world = world };
+        }
+    } // record
+
+    // A backend which only counts what it's given.
+    struct sNull_Backend
+    {
+        size_t commands  = 0;
+        size_t instances = 0;
+        float  checksum  = 0.0f;
+
+        void operator()( const Commands::sDraw& _draw ){ commands++; checksum += _draw.world.w.x; }
+        void operator()( const Commands::sDraw_Instanced& _draw )
+        {
+            commands++;
+            for( const auto& instance : cCommand_Buffer::GetPayload< sInstance_Data >( _draw, _draw.count ) )
+                checksum += instance.world.w.x;
+            instances += _draw.count;
+        }
+        void operator()( const auto& ){ commands++; }
+    };
+} // ::
+
+// Records and replays a frame of draws headless, single threaded and with a buffer per thread.
+int main()
+{
+    cCommand_Buffer buffer;
+
+    // The first frame grows the buffer, after that recording never allocates.
+    const auto record_ms = sk::Testing::Measure( 100, [ & ]{ record( buffer, kDraws ); } );
+
+    sNull_Backend backend;
+    const auto replay_ms = sk::Testing::Measure( 100, [ & ]{ buffer.Replay( backend ); } );
+
+    // Replaying with a generic lambda, the cheapest a backend can be.
+    size_t visited = 0;
+    const auto visit_ms = sk::Testing::Measure( 100, [ & ]{ buffer.Replay( [ & ]( const auto& ){ visited++; } ); } );
+
+    // Every thread records a whole frame into its own buffer, the time includes starting the threads.
+    const auto thread_count = std::max( 1u, std::thread::hardware_concurrency() );
+    std::vector< cCommand_Buffer > buffers( thread_count );
+    const auto threaded_ms = sk::Testing::Measure( 20, [ & ]
+    {
+        std::vector< std::jthread > threads;
+        for( auto& thread_buffer : buffers )
+            threads.emplace_back( [ &thread_buffer ]{ record( thread_buffer, kDraws ); } );
+    } );
+
+    const auto commands = static_cast< double >( buffer.GetCount() );
+    std::println( "Command buffer, {} draws in {} commands, {:.2f} MB", kDraws, buffer.GetCount(), static_cast< double >( buffer.GetSize() ) / ( 1024.0 * 1024.0 ) );
+    std::println( "Record:   {:.3f} ms, {:.1f} M commands/s", record_ms, commands / record_ms / 1000.0 );
+    std::println( "Replay:   {:.3f} ms, {:.1f} M commands/s", replay_ms, commands / replay_ms / 1000.0 );
+    std::println( "Visit:    {:.3f} ms, {:.1f} M commands/s", visit_ms, commands / visit_ms / 1000.0 );
+    std::println( "Threaded: {:.3f} ms for {} threads, {:.1f} M commands/s", threaded_ms, thread_count,
+        commands * thread_count / threaded_ms / 1000.0 );
+
+    // Keeps the replays from being optimized out, and checks nothing got lost on the way.
+    const bool valid = backend.commands == buffer.GetCount() * 101 && visited == buffer.GetCount() * 101 && backend.checksum != 0.0f;
+    if( !valid )
+        std::println( stderr, "The replayed commands don't match what was recorded." );
+
+    return valid ? 0 : 1;
+}
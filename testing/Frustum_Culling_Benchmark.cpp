@@ -0,0 +1,55 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Test.h"
+#include "Frustum_Culling_Reference.h"
+
+#include <sk/Math/Simd.h>
+
+using namespace sk::Graphics::Utils;
+
+// Culls 200k boxes, four at a time and one at a time. Configure with SKAPE_SIMD_FORCE_SCALAR to time the scalar path.
+int main()
+{
+    constexpr size_t kBoxes = 200'000;
+
+    const auto frustum = sk::Testing::MakeFrustum( 2.1f, -0.6f );
+    const auto boxes   = sk::Testing::MakeBoxes( kBoxes, 1 );
+    const auto bounds  = sk::Testing::Pack( boxes );
+
+    std::vector< uint32_t > visible;
+    visible.reserve( kBoxes );
+    const auto packed_ms = sk::Testing::Measure( 50, [ & ]
+    {
+        visible.clear();
+        CullBounds( bounds, frustum, visible );
+    } );
+
+    // What culling the meshes looked like before they were packed, a box at a time.
+    std::vector< uint32_t > scalar;
+    scalar.reserve( kBoxes );
+    const auto scalar_ms = sk::Testing::Measure( 50, [ & ]
+    {
+        scalar.clear();
+        for( uint32_t i = 0; i < kBoxes; i++ )
+        {
+            if( frustum.Intersects( boxes[ i ] ) )
+                scalar.emplace_back( i );
+        }
+    } );
+
+    std::println( "Frustum culling, {} backend, {} boxes, {} visible, {} from the scalar test", sk::Math::Simd::kBackend, kBoxes, visible.size(), scalar.size() );
+    std::println( "Packed:  {:.3f} ms", packed_ms );
+    std::println( "Scalar:  {:.3f} ms", scalar_ms );
+    std::println( "Speedup: {:.2f}x", scalar_ms / packed_ms );
+
+    // Both have to keep the same boxes, or the timings aren't comparable.
+    const bool valid = visible == scalar && !visible.empty();
+    if( !valid )
+        std::println( stderr, "The packed and scalar tests didn't keep the same boxes." );
+
+    return valid ? 0 : 1;
+}
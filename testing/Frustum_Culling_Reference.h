@@ -0,0 +1,92 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include <sk/Graphics/Utils/Frustum_Culling.h>
+#include <sk/Math/Quaternion.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+// A scalar version of Utils::CullBounds in doubles, testing one box against one plane at a time.
+namespace sk::Testing
+{
+    enum class eCulled : uint8_t
+    {
+        kVisible,
+        kCulled,
+        // Too close to one of the planes to call in floats, either answer is right.
+        kEdge,
+    };
+
+    constexpr float kFov    = 60.0f;
+    constexpr float kAspect = 16.0f / 9.0f;
+    constexpr float kNear   = 0.1f;
+    constexpr float kFar    = 1'000.0f;
+
+    // A camera at the origin, turned by _yaw and _pitch in radians.
+    inline auto MakeFrustum( const float _yaw, const float _pitch ) -> cFrustumf
+    {
+        const auto view = cQuaternionf::FromEuler( cVector3f{ _pitch, _yaw, 0.0f } ).ToMatrix().inversed_affine();
+        return cFrustumf( view * Math::Matrix4x4::AspectPerspective( kAspect, kFov, kNear, kFar ) );
+    } // MakeFrustum
+
+    // Boxes all around the camera, about a tenth of them inside of its frustum.
+    inline auto MakeBoxes( const size_t _count, const uint32_t _seed ) -> std::vector< cAABBf >
+    {
+        std::mt19937 random{ _seed };
+        const auto range = [ & ]( const float _min, const float _max ){ return std::uniform_real_distribution( _min, _max )( random ); };
+
+        std::vector< cAABBf > boxes( _count );
+        for( auto& box : boxes )
+        {
+            const cVector3f center { range( -kFar, kFar ), range( -kFar, kFar ), range( -kFar, kFar ) };
+            const cVector3f extents{ range( 0.1f, 10.0f ), range( 0.1f, 10.0f ), range( 0.1f, 10.0f ) };
+            box = cAABBf::FromCenterExtents( center, extents );
+        }
+
+        return boxes;
+    } // MakeBoxes
+
+    inline auto Pack( const std::vector< cAABBf >& _boxes ) -> Graphics::Utils::sPacked_Bounds
+    {
+        Graphics::Utils::sPacked_Bounds bounds;
+        bounds.Reserve( _boxes.size() );
+        for( const auto& box : _boxes )
+            bounds.Add( box );
+        return bounds;
+    } // Pack
+
+    // The same test as cFrustum::Intersects, in doubles.
+    inline auto Cull( const cFrustumf& _frustum, const cAABBf& _box ) -> eCulled
+    {
+        const auto center  = _box.GetCenter();
+        const auto extents = _box.GetExtents();
+
+        // Relative to how far out the box is, as that's what the errors scale with.
+        const auto epsilon = 1e-5 * std::max( { 1.0, std::abs( static_cast< double >( center.x ) ), std::abs( static_cast< double >( center.y ) ),
+            std::abs( static_cast< double >( center.z ) ) } );
+
+        auto result = eCulled::kVisible;
+        for( const auto& plane : _frustum.GetPlanes() )
+        {
+            const double distance = static_cast< double >( plane.x ) * center.x + static_cast< double >( plane.y ) * center.y
+                + static_cast< double >( plane.z ) * center.z + static_cast< double >( plane.w );
+            const double radius = std::abs( static_cast< double >( plane.x ) ) * extents.x + std::abs( static_cast< double >( plane.y ) ) * extents.y
+                + std::abs( static_cast< double >( plane.z ) ) * extents.z;
+
+            if( std::abs( distance + radius ) < epsilon )
+                result = eCulled::kEdge;
+            else if( distance + radius < 0.0 )
+                return eCulled::kCulled;
+        }
+
+        return result;
+    } // Cull
+} // sk::Testing::
@@ -0,0 +1,104 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Test.h"
+#include "Frustum_Culling_Reference.h"
+
+#include <algorithm>
+#include <limits>
+
+using namespace sk::Graphics::Utils;
+
+namespace
+{
+    constexpr size_t kBoxes = 200'000;
+
+    // Every box the reference is sure about has to be kept, or culled, exactly like it says.
+    void compare( const float _yaw, const float _pitch, const uint32_t _seed )
+    {
+        const auto frustum = sk::Testing::MakeFrustum( _yaw, _pitch );
+        const auto boxes   = sk::Testing::MakeBoxes( kBoxes, _seed );
+        const auto bounds  = sk::Testing::Pack( boxes );
+
+        std::vector< uint32_t > visible;
+        const auto count = CullBounds( bounds, frustum, visible );
+
+        SK_CHECK( count == visible.size() );
+        SK_CHECK( std::ranges::is_sorted( visible ) && std::ranges::adjacent_find( visible ) == visible.end() );
+
+        size_t missing = 0, extra = 0, reference = 0, scalar = 0;
+        for( uint32_t box = 0; box < kBoxes; box++ )
+        {
+            const auto culled     = sk::Testing::Cull( frustum, boxes[ box ] );
+            const bool is_visible = std::ranges::binary_search( visible, box );
+
+            reference += culled != sk::Testing::eCulled::kCulled;
+            scalar    += frustum.Intersects( boxes[ box ] );
+            missing   += culled == sk::Testing::eCulled::kVisible && !is_visible;
+            extra     += culled == sk::Testing::eCulled::kCulled  &&  is_visible;
+        }
+
+        SK_CHECK( missing == 0 );
+        SK_CHECK( extra   == 0 );
+        // Only boxes right on a plane can land on either side, and there are next to none of those.
+        SK_CHECK( count == scalar );
+        SK_CHECK( count <= reference );
+        // Makes sure the frustum both keeps and culls a fair share of the boxes.
+        SK_CHECK( count > kBoxes / 20 && count < kBoxes / 2 );
+    } // compare
+
+    // The last group is padded, whatever is in the padding can't be reported as visible.
+    void test_tails()
+    {
+        const auto frustum = sk::Testing::MakeFrustum( 0.0f, 0.0f );
+
+        for( size_t size = 0; size < 12; size++ )
+        {
+            // Alternating between in front of and behind the camera.
+            std::vector< sk::cAABBf > boxes;
+            for( size_t i = 0; i < size; i++ )
+                boxes.emplace_back( sk::cAABBf::FromCenterExtents( sk::cVector3f{ 0.0f, 0.0f, i % 2 == 0 ? 50.0f : -50.0f }, sk::cVector3f{ 1.0f } ) );
+
+            // Anything already in the output is left as it is.
+            std::vector< uint32_t > visible{ std::numeric_limits< uint32_t >::max() };
+            const auto count = CullBounds( sk::Testing::Pack( boxes ), frustum, visible );
+
+            std::vector< uint32_t > expected{ std::numeric_limits< uint32_t >::max() };
+            for( uint32_t i = 0; i < size; i++ )
+            {
+                if( frustum.Intersects( boxes[ i ] ) )
+                    expected.emplace_back( i );
+            }
+
+            SK_CHECK( count == ( size + 1 ) / 2 );
+            SK_CHECK( visible == expected );
+        }
+    } // test_tails
+
+    // Empty bounds belong to something without any, which is never culled.
+    void test_empty()
+    {
+        const auto frustum = sk::Testing::MakeFrustum( 0.0f, 0.0f );
+
+        sPacked_Bounds bounds;
+        bounds.Add( sk::cAABBf::FromCenterExtents( sk::cVector3f{ 0.0f, 0.0f, -50.0f }, sk::cVector3f{ 1.0f } ) );
+        bounds.Add( sk::cAABBf{} );
+
+        std::vector< uint32_t > visible;
+        SK_CHECK( CullBounds( bounds, frustum, visible ) == 1 );
+        SK_CHECK( visible.size() == 1 && visible.front() == 1 );
+    } // test_empty
+} // ::
+
+int main()
+{
+    sk::Testing::Run( "Tails", &test_tails );
+    sk::Testing::Run( "Empty bounds", &test_empty );
+    sk::Testing::Run( "Reference, 200k boxes",         []{ compare( 0.0f, 0.0f, 1 ); } );
+    sk::Testing::Run( "Reference, 200k boxes, turned", []{ compare( 2.1f, -0.6f, 2 ); } );
+
+    return sk::Testing::Finish();
+}
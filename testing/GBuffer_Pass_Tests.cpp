@@ -0,0 +1,229 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Test.h"
+
+#include <sk/Graphics/Passes/GBuffer_Pass.h>
+#include <sk/Graphics/Utils/Draw_List.h>
+#include <sk/Graphics/Utils/RenderUtils.h>
+#include <sk/Math/Transform.h>
+
+#include <random>
+#include <set>
+#include <tuple>
+#include <vector>
+
+using namespace sk::Graphics;
+using namespace sk::Graphics::Utils;
+
+namespace
+{
+    constexpr uint32_t kPrograms          = 2;
+    constexpr uint32_t kMaterials         = 8;
+    constexpr uint32_t kMeshesPerMaterial = 4;
+    constexpr uint32_t kLods              = 3;
+    constexpr size_t   kDraws             = 4'096;
+
+    // Only ever compared, never dereferenced, so nothing has to be loaded.
+    template< class Ty >
+    auto fake( const size_t _index ){ return reinterpret_cast< Ty* >( static_cast< uintptr_t >( ( _index + 1 ) * 64 ) ); }
+
+    auto get_material( const uint32_t _material ){ return fake< sk::Assets::cMaterial >( _material ); }
+    auto get_mesh    ( const uint32_t _mesh )    { return fake< sk::Assets::cMesh >( kMaterials + _mesh ); }
+
+    // Every material uses a shader of its own family, like the lit and unlit ones sharing a program.
+    auto get_program( const sk::Assets::cMaterial* _material )
+    {
+        return static_cast< uint32_t >( reinterpret_cast< uintptr_t >( _material ) / 64 - 1 ) % kPrograms;
+    } // get_program
+
+    // Changes state the way SubmitCommands does, a mesh is only rebound when it differs and its indices when the lod does.
+    struct sRecording_Backend
+    {
+        sDraw_Stats stats = {};
+
+        const sk::Assets::cMaterial* material = nullptr;
+        const sk::Assets::cMesh*     mesh     = nullptr;
+        uint32_t                     program  = ~0u;
+        uint32_t                     lod      = ~0u;
+
+        void operator()( const Commands::sUse_Material& _command )
+        {
+            if( _command.material == material )
+                return;
+
+            material = _command.material;
+            stats.material_changes++;
+            if( get_program( material ) != program )
+            {
+                program = get_program( material );
+                stats.program_changes++;
+            }
+        }
+
+        void operator()( const Commands::sBind_Mesh& _command )
+        {
+            if( _command.mesh != mesh )
+            {
+                mesh = _command.mesh;
+                lod  = ~0u;
+                stats.mesh_changes++;
+            }
+            if( _command.lod != lod )
+            {
+                lod = _command.lod;
+                stats.index_changes++;
+            }
+        }
+
+        void operator()( const Commands::sDraw& )
+        {
+            stats.draws++;
+            stats.instances++;
+        }
+
+        void operator()( const Commands::sDraw_Instanced& _command )
+        {
+            stats.draws++;
+            stats.instances += _command.count;
+        }
+    };
+
+    auto submit( const cDraw_List& _list, const is_instanced_t _is_instanced )
+    {
+        cCommand_Buffer commands;
+        RecordDrawList( _list, 0, _list.GetSize(), commands, _is_instanced );
+
+        sRecording_Backend backend;
+        commands.Replay( backend );
+        return backend.stats;
+    } // submit
+
+    bool never ( const sk::Assets::cMaterial* ){ return false; }
+    bool always( const sk::Assets::cMaterial* ){ return true; }
+
+    struct sScene
+    {
+        std::vector< sk::cShared_ptr< sk::cTransform > > transforms;
+        std::vector< float >                             depths;
+        cDraw_List                                       list;
+        // The state each draw needs, to count what the fewest changes could be.
+        std::set< uint32_t >                                        programs;
+        std::set< const sk::Assets::cMaterial* >                    materials;
+        std::set< const sk::Assets::cMesh* >                        meshes;
+        std::set< std::tuple< const sk::Assets::cMesh*, size_t > >  lods;
+    };
+
+    // Draws added in the order they'd come out of the layers, which has nothing to do with their state.
+    void fill( sScene& _scene, const size_t _count, const uint32_t _materials, const uint32_t _meshes_per_material, const uint32_t _lods )
+    {
+        std::mt19937 random{ 1 };
+        std::uniform_int_distribution< uint32_t > material_distribution( 0, _materials - 1 );
+        std::uniform_int_distribution< uint32_t > mesh_distribution    ( 0, _meshes_per_material - 1 );
+        std::uniform_int_distribution< uint32_t > lod_distribution     ( 0, _lods - 1 );
+        std::uniform_real_distribution            depth_distribution   ( 0.0f, 1.0f );
+
+        _scene.list.Reserve( _count );
+        for( size_t i = 0; i < _count; i++ )
+        {
+            const auto material_index = material_distribution( random );
+            const auto material       = get_material( material_index );
+            const auto mesh           = get_mesh( material_index * _meshes_per_material + mesh_distribution( random ) );
+            const auto lod            = static_cast< size_t >( lod_distribution( random ) );
+            const auto depth          = depth_distribution( random );
+
+            auto& transform = _scene.transforms.emplace_back( sk::make_shared< sk::cTransform >() );
+            _scene.depths.emplace_back( depth );
+
+            const auto key = Passes::cGBuffer_Pass::MakeKey( _scene.list, get_program( material ), material, mesh, lod, depth );
+            _scene.list.Add( key, { .material = material, .mesh = mesh, .transform = transform.get(), .lod = lod } );
+
+            _scene.programs .emplace( get_program( material ) );
+            _scene.materials.emplace( material );
+            _scene.meshes   .emplace( mesh );
+            _scene.lods     .emplace( mesh, lod );
+        }
+    } // fill
+} // ::
+
+int main()
+{
+    sk::cTransform_Hierarchy::init();
+
+    sk::Testing::Run( "Sorting binds every program, material, mesh and lod once", []
+    {
+        sScene scene;
+        fill( scene, kDraws, kMaterials, kMeshesPerMaterial, kLods );
+
+        // Unsorted, the entries are still in the order they were added.
+        const auto unsorted = submit( scene.list, &never );
+        scene.list.Sort();
+        const auto sorted = submit( scene.list, &never );
+
+        SK_CHECK( sorted.draws == kDraws );
+        SK_CHECK( unsorted.draws == kDraws );
+
+        SK_CHECK( sorted.program_changes  == scene.programs .size() );
+        SK_CHECK( sorted.material_changes == scene.materials.size() );
+        SK_CHECK( sorted.mesh_changes     == scene.meshes   .size() );
+        SK_CHECK( sorted.index_changes    == scene.lods     .size() );
+
+        SK_CHECK( sorted.program_changes  < unsorted.program_changes );
+        SK_CHECK( sorted.material_changes < unsorted.material_changes );
+        SK_CHECK( sorted.mesh_changes     < unsorted.mesh_changes );
+        SK_CHECK( sorted.index_changes    < unsorted.index_changes );
+    } );
+
+    sk::Testing::Run( "Lods of the same mesh are grouped before depth", []
+    {
+        // A single mesh at random depths, so sorting by depth first would switch lods between almost every draw.
+        sScene scene;
+        fill( scene, kDraws, 1, 1, kLods );
+        scene.list.Sort();
+
+        const auto stats = submit( scene.list, &never );
+        SK_CHECK( stats.mesh_changes == 1 );
+        SK_CHECK( stats.index_changes == kLods );
+    } );
+
+    sk::Testing::Run( "Draws sharing state are front to back", []
+    {
+        sScene scene;
+        fill( scene, kDraws, kMaterials, kMeshesPerMaterial, kLods );
+        scene.list.Sort();
+
+        const auto entries = scene.list.GetEntries();
+        for( size_t i = 1; i < entries.size(); i++ )
+        {
+            const auto& previous = scene.list.GetDraw( entries[ i - 1 ].draw );
+            const auto& current  = scene.list.GetDraw( entries[ i ].draw );
+            if( previous.material != current.material || previous.mesh != current.mesh || previous.lod != current.lod )
+                continue;
+
+            // The depth is quantized in the key, so only the buckets are ordered.
+            const auto bucket = []( const float _depth ){ return static_cast< uint32_t >( _depth * static_cast< float >( ( 1u << cDraw_List::kDepthBits ) - 1 ) ); };
+            SK_CHECK( bucket( scene.depths[ entries[ i - 1 ].draw ] ) <= bucket( scene.depths[ entries[ i ].draw ] ) );
+        }
+    } );
+
+    sk::Testing::Run( "Instancing draws every sorted run at once", []
+    {
+        sScene scene;
+        fill( scene, kDraws, kMaterials, kMeshesPerMaterial, kLods );
+
+        const auto unsorted = submit( scene.list, &always );
+        scene.list.Sort();
+        const auto sorted = submit( scene.list, &always );
+
+        SK_CHECK( sorted.instances == kDraws );
+        SK_CHECK( sorted.draws == scene.lods.size() );
+        SK_CHECK( sorted.draws < unsorted.draws );
+    } );
+
+    sk::cTransform_Hierarchy::shutdown();
+
+    return sk::Testing::Finish();
+}
@@ -0,0 +1,171 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Test.h"
+
+#include <sk/Graphics/Utils/Draw_List.h>
+#include <sk/Graphics/Utils/RenderUtils.h>
+#include <sk/Math/Transform.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace sk::Graphics::Utils;
+
+namespace
+{
+    // Clones of the same prop, like the spinning grid in cApp::create scaled up.
+    constexpr size_t kClones = 10'000;
+
+    // Only ever compared, never dereferenced, so the backend doesn't need any assets.
+    template< class Ty >
+    auto fake( const size_t _index ){ return reinterpret_cast< Ty* >( static_cast< uintptr_t >( ( _index + 1 ) * 64 ) ); }
+
+    // Does what SubmitCommands does with the state, minus the graphics api. Records the draws instead of issuing them.
+    struct sRecording_Backend
+    {
+        sDraw_Stats stats = {};
+        // Gathered like the instance buffer is before being uploaded.
+        std::vector< sInstance_Data > instances;
+        // A draw per world matrix, what the object block would have uploaded.
+        std::vector< sk::cMatrix4x4f > uploads;
+
+        const sk::Assets::cMaterial* material = nullptr;
+        const sk::Assets::cMesh*     mesh     = nullptr;
+        uint32_t                     lod      = 0;
+
+        void Reset()
+        {
+            stats    = {};
+            material = nullptr;
+            mesh     = nullptr;
+            instances.clear();
+            uploads  .clear();
+        }
+
+        void operator()( const Commands::sUse_Material& _command )
+        {
+            if( _command.material == material )
+                return;
+
+            material = _command.material;
+            mesh     = nullptr;
+            stats.material_changes++;
+        }
+
+        void operator()( const Commands::sBind_Mesh& _command )
+        {
+            if( _command.mesh != mesh )
+            {
+                mesh = _command.mesh;
+                stats.mesh_changes++;
+            }
+            if( _command.lod != lod )
+            {
+                lod = _command.lod;
+                stats.index_changes++;
+            }
+        }
+
+        void operator()( const Commands::sDraw& _command )
+        {
+            uploads.emplace_back( _command.world );
+            stats.draws++;
+            stats.instances++;
+        }
+
+        void operator()( const Commands::sDraw_Instanced& _command )
+        {
+            const auto payload = cCommand_Buffer::GetPayload< sInstance_Data >( _command, _command.count );
+            instances.insert( instances.end(), payload.begin(), payload.end() );
+            stats.draws++;
+            stats.instances += _command.count;
+        }
+    };
+
+    struct sResult
+    {
+        double      record_ms;
+        double      submit_ms;
+        sDraw_Stats stats;
+        size_t      bytes;
+    };
+
+    auto run( const cDraw_List& _list, const is_instanced_t _is_instanced )
+    {
+        cCommand_Buffer    commands;
+        sRecording_Backend backend;
+
+        sResult result;
+        result.record_ms = sk::Testing::Measure( 100, [ & ]
+        {
+            commands.Clear();
+            RecordDrawList( _list, 0, _list.GetSize(), commands, _is_instanced );
+        } );
+        result.submit_ms = sk::Testing::Measure( 100, [ & ]
+        {
+            backend.Reset();
+            commands.Replay( backend );
+        } );
+        result.stats = backend.stats;
+        result.bytes = commands.GetSize();
+        return result;
+    } // run
+
+    void print( const char* _name, const sResult& _result )
+    {
+        std::println( "{}: {} draws, {} instances, {} material and {} mesh changes, {:.2f} MB recorded", _name, _result.stats.draws, _result.stats.instances,
+            _result.stats.material_changes, _result.stats.mesh_changes, static_cast< double >( _result.bytes ) / ( 1024.0 * 1024.0 ) );
+        std::println( "    Record: {:.3f} ms", _result.record_ms );
+        std::println( "    Submit: {:.3f} ms", _result.submit_ms );
+    } // print
+} // ::
+
+// Records and submits 10k clones sharing a mesh and material, as one draw each and as a single instanced draw.
+int main()
+{
+    sk::cTransform_Hierarchy::init();
+
+    std::vector< sk::cShared_ptr< sk::cTransform > > transforms;
+    transforms.reserve( kClones );
+    for( size_t i = 0; i < kClones; i++ )
+    {
+        auto& transform = transforms.emplace_back( sk::make_shared< sk::cTransform >( sk::cVector3f{ static_cast< float >( i % 100 ), 0.0f, static_cast< float >( i / 100 ) } ) );
+        transform->Attach();
+    }
+    sk::cTransform_Hierarchy::get().Update();
+
+    const auto material = fake< sk::Assets::cMaterial >( 0 );
+    const auto mesh     = fake< sk::Assets::cMesh >( 1 );
+
+    cDraw_List list;
+    list.Reserve( kClones );
+    for( size_t i = 0; i < kClones; i++ )
+    {
+        const auto key = cDraw_List::MakeKey( 0, 0, list.GetMaterialId( material ), list.GetMeshId( mesh ), 0, static_cast< float >( i ) / kClones );
+        list.Add( key, { .material = material, .mesh = mesh, .transform = transforms[ i ].get(), .lod = 0 } );
+    }
+    list.Sort();
+
+    const auto single    = run( list, []( const sk::Assets::cMaterial* ){ return false; } );
+    const auto instanced = run( list, []( const sk::Assets::cMaterial* ){ return true; } );
+
+    std::println( "Instancing, {} clones of one mesh and material", kClones );
+    print( "Per draw ", single );
+    print( "Instanced", instanced );
+
+    // Every clone has to be drawn either way, the instanced path with a single draw.
+    const bool valid = single.stats.draws == kClones && single.stats.instances == kClones
+        && instanced.stats.draws == 1 && instanced.stats.instances == kClones
+        && single.stats.material_changes == 1 && instanced.stats.material_changes == 1;
+    if( !valid )
+        std::println( stderr, "The clones weren't all drawn, or weren't grouped into a single instanced draw." );
+
+    transforms.clear();
+    sk::cTransform_Hierarchy::shutdown();
+
+    return valid ? 0 : 1;
+}
@@ -0,0 +1,114 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Test.h"
+
+#include <sk/Math/Simd.h>
+#include <sk/Math/Transform.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr size_t kDraws  = 50'000;
+    // Every tenth object moves each frame.
+    constexpr size_t kMoving = kDraws / 10;
+
+    // What RenderMesh hands the object block for every draw.
+    struct sObject_Uniforms
+    {
+        sk::cMatrix4x4f world;
+        sk::cMatrix4x4f inverse_world;
+    };
+
+    // Relative to the element, as the translations are a lot larger than the rotations.
+    auto max_difference( const sk::cMatrix4x4f& _a, const sk::cMatrix4x4f& _b )
+    {
+        float result = 0.0f;
+        for( size_t c = 0; c < 16; c++ )
+            result = std::max( result, std::abs( ( &_a.x.x )[ c ] - ( &_b.x.x )[ c ] ) / std::max( 1.0f, std::abs( ( &_b.x.x )[ c ] ) ) );
+        return result;
+    } // max_difference
+} // ::
+
+// A 50k draw frame where a tenth of the objects move, uploading the inverse cached by the hierarchy,
+// and inverting every world matrix again for every draw like RenderMesh used to.
+int main()
+{
+    sk::cTransform_Hierarchy::init();
+    auto& hierarchy = sk::cTransform_Hierarchy::get();
+
+    std::mt19937 random{ 1 };
+    const auto range = [ & ]( const float _min, const float _max ){ return std::uniform_real_distribution( _min, _max )( random ); };
+
+    std::vector< sk::cShared_ptr< sk::cTransform > > transforms;
+    transforms.reserve( kDraws );
+    for( size_t i = 0; i < kDraws; i++ )
+    {
+        auto& transform = transforms.emplace_back( sk::make_shared< sk::cTransform >(
+            sk::cVector3f{ range( -500.0f, 500.0f ), range( -10.0f, 10.0f ), range( -500.0f, 500.0f ) },
+            sk::cVector3f{ range( -180.0f, 180.0f ), range( -180.0f, 180.0f ), range( -180.0f, 180.0f ) },
+            sk::cVector3f{ range( 0.5f, 2.0f ), range( 0.5f, 2.0f ), range( 0.5f, 2.0f ) } ) );
+        transform->Attach();
+    }
+    hierarchy.Update();
+
+    std::vector< sObject_Uniforms > uploads( kDraws );
+
+    const auto move = [ & ]
+    {
+        for( size_t i = 0; i < kDraws; i += kDraws / kMoving )
+            transforms[ i ]->SetPosition( transforms[ i ]->GetPosition() + sk::cVector3f{ 0.0f, 0.01f, 0.0f } );
+        hierarchy.Update();
+    };
+
+    // Only the objects which moved get a new inverse, four at a time.
+    const auto update_ms = sk::Testing::Measure( 50, move );
+
+    const auto cached_ms = sk::Testing::Measure( 50, [ & ]
+    {
+        move();
+        for( size_t i = 0; i < kDraws; i++ )
+            uploads[ i ] = { transforms[ i ]->GetWorld(), transforms[ i ]->GetInverseWorld() };
+    } );
+
+    std::vector< sObject_Uniforms > per_draw( kDraws );
+    const auto per_draw_ms = sk::Testing::Measure( 50, [ & ]
+    {
+        move();
+        for( size_t i = 0; i < kDraws; i++ )
+            per_draw[ i ] = { transforms[ i ]->GetWorld(), transforms[ i ]->GetWorld().inversed() };
+    } );
+
+    // Every cached inverse has to match a fresh general inverse of the world matrix it was uploaded with.
+    float error = 0.0f;
+    for( const auto& [ world, inverse_world ] : uploads )
+        error = std::max( error, max_difference( inverse_world, world.inversed() ) );
+
+    // Both frames have to upload the same matrices for the objects which didn't move since.
+    bool valid = error < 1e-4f;
+    for( size_t i = 0; i < kDraws; i++ )
+    {
+        if( i % ( kDraws / kMoving ) != 0 )
+            valid &= max_difference( uploads[ i ].world, per_draw[ i ].world ) == 0.0f && max_difference( uploads[ i ].inverse_world, per_draw[ i ].inverse_world ) < 1e-4f;
+    }
+
+    std::println( "Inverse world, {} backend, {} draws with {} moving", sk::Math::Simd::kBackend, kDraws, kMoving );
+    std::println( "Update:   {:.3f} ms", update_ms );
+    std::println( "Cached:   {:.3f} ms", cached_ms );
+    std::println( "Per draw: {:.3f} ms", per_draw_ms );
+    std::println( "Speedup:  {:.2f}x, largest difference {:.2e}", per_draw_ms / cached_ms, error );
+
+    if( !valid )
+        std::println( stderr, "The cached inverse doesn't match the world matrix." );
+
+    transforms.clear();
+    sk::cTransform_Hierarchy::shutdown();
+
+    return valid ? 0 : 1;
+}
@@ -0,0 +1,94 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Test.h"
+
+#include <sk/Math/Transform_Hierarchy.h>
+#include <sk/Scene/Object.h>
+#include <sk/Scene/Managers/EventManager.h>
+#include <sk/Scene/Managers/Internal_Component_Manager.h>
+#include <sk/Scene/Managers/Layer_Manager.h>
+
+#include <format>
+#include <vector>
+
+namespace
+{
+    constexpr size_t kLayers   = 64;
+    constexpr size_t kPerLayer = 10'000;
+    // Half of the layers, like a camera that skips the UI and debug layers would ask for.
+    constexpr uint64_t kEveryOther = 0x5555'5555'5555'5555ull;
+    // Range lookups a frame, one for every pass or system asking for a layer.
+    constexpr size_t kLookups  = 10'000;
+
+    auto count( const sk::Scene::cLayer_Manager::object_range_t& _range )
+    {
+        size_t count = 0;
+        for( auto itr = _range.first; itr != _range.second; ++itr )
+            count += ( *itr ).Lock() != nullptr;
+        return count;
+    } // count
+} // ::
+
+// Iterates 64 layers with 10k objects each, through every layer and through every other one.
+int main()
+{
+    sk::cEventManager::init();
+    sk::cTransform_Hierarchy::init();
+    auto& layers = sk::Scene::cLayer_Manager::init();
+    sk::Scene::cInternal_Component_Manager::init();
+
+    // The default layer is already added as layer 0.
+    for( size_t layer = 1; layer < kLayers; layer++ )
+        layers.AddLayer( layer, std::format( "Layer {}", layer ) );
+
+    std::vector< sk::cShared_ptr< sk::Object::iObject > > objects;
+    objects.reserve( kLayers * kPerLayer );
+    for( size_t i = 0; i < kLayers * kPerLayer; i++ )
+        objects.emplace_back( sk::make_pooled< sk::Object::iObject >( "Object" ) )->SetLayer( i % kLayers );
+
+    size_t all = 0;
+    const auto all_ms = sk::Testing::Measure( 20, [ & ]
+    {
+        all = count( layers.GetObjectsIn( ~0ull ) );
+    } );
+
+    size_t half = 0;
+    const auto half_ms = sk::Testing::Measure( 20, [ & ]
+    {
+        half = count( layers.GetObjectsIn( kEveryOther ) );
+    } );
+
+    // Making the range used to allocate, so it's timed on its own as well.
+    size_t empty = 0;
+    const auto lookup_ms = sk::Testing::Measure( 20, [ & ]
+    {
+        empty = 0;
+        for( size_t i = 0; i < kLookups; i++ )
+        {
+            const auto [ first, last ] = layers.GetObjectsIn( 1ull << ( i % kLayers ) );
+            empty += first == last;
+        }
+    } );
+
+    std::println( "Layers, {} layers with {} objects each", kLayers, kPerLayer );
+    std::println( "All layers:    {:.3f} ms", all_ms );
+    std::println( "Every other:   {:.3f} ms", half_ms );
+    std::println( "{} ranges: {:.3f} ms", kLookups, lookup_ms );
+
+    const bool valid = all == kLayers * kPerLayer && half == kLayers / 2 * kPerLayer && empty == 0;
+    if( !valid )
+        std::println( stderr, "Visited {} and {} objects, expected {} and {}.", all, half, kLayers * kPerLayer, kLayers / 2 * kPerLayer );
+
+    objects.clear();
+
+    sk::Scene::cInternal_Component_Manager::shutdown();
+    sk::Scene::cLayer_Manager::shutdown();
+    sk::cTransform_Hierarchy::shutdown();
+    sk::cEventManager::shutdown();
+
+    return valid ? 0 : 1;
+}
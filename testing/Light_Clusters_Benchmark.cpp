@@ -0,0 +1,49 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Test.h"
+#include "Light_Clusters_Reference.h"
+
+#include <sk/Assets/Management/Asset_Job_Manager.h>
+#include <sk/Math/Simd.h>
+
+using namespace sk::Graphics::Utils;
+
+// Assigns 10k lights to the default 16x9x24 grid. Configure with SKAPE_SIMD_FORCE_SCALAR to time the scalar path.
+int main()
+{
+    auto& jobs = sk::Assets::Jobs::cAsset_Job_Manager::init();
+
+    const auto lights = sk::Testing::MakeLights( 10'000, 1 );
+
+    cLight_Clusters clusters;
+    clusters.Build( {}, sk::Testing::kFov, sk::Testing::kAspect, sk::Testing::kNear, sk::Testing::kFar );
+
+    const auto assign = sk::Testing::Measure( 50, [ & ]{ clusters.Assign( lights ); } );
+
+    // Every light against every cluster, to show what the slice and tile ranges save.
+    size_t reference_hits = 0;
+    const auto reference = sk::Testing::Measure( 1, [ & ]
+    {
+        reference_hits = 0;
+        for( size_t cluster = 0; cluster < clusters.GetGrid().GetCount(); cluster++ )
+        {
+            for( size_t light = 0; light < lights.GetSize(); light++ )
+                reference_hits += sk::Testing::Overlap( lights, light, clusters.GetBounds(), cluster ) != sk::Testing::eOverlap::kOutside;
+        }
+    } );
+
+    const auto& grid = clusters.GetGrid();
+    std::println( "Light clusters, {} backend, {} asset workers", sk::Math::Simd::kBackend, jobs.GetWorkerCount() );
+    std::println( "{} lights, {}x{}x{} clusters, {} indices, {} from the reference", lights.GetSize(), grid.x, grid.y, grid.z,
+        clusters.GetIndices().size(), reference_hits );
+    std::println( "Assign:    {:.3f} ms", assign );
+    std::println( "Reference: {:.3f} ms", reference );
+
+    sk::Assets::Jobs::cAsset_Job_Manager::shutdown();
+
+    return 0;
+}
@@ -0,0 +1,115 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include <sk/Graphics/Utils/Light_Clusters.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+// A brute force version of cLight_Clusters::Assign, testing every light against every cluster.
+namespace sk::Testing
+{
+    enum class eOverlap : uint8_t
+    {
+        kOutside,
+        kInside,
+        // Too close to call in floats, either answer is right.
+        kEdge,
+    };
+
+    constexpr float kFov    = 60.0f;
+    constexpr float kAspect = 16.0f / 9.0f;
+    constexpr float kNear   = 0.1f;
+    constexpr float kFar    = 100.0f;
+
+    // Lights around the view frustum, some of them behind the camera or past the far plane. Every fourth one is a spot light.
+    inline auto MakeLights( const size_t _count, const uint32_t _seed ) -> Graphics::Utils::sPacked_Lights
+    {
+        std::mt19937 random{ _seed };
+        const auto range = [ & ]( const float _min, const float _max ){ return std::uniform_real_distribution( _min, _max )( random ); };
+
+        const auto tan_y = std::tan( kFov * 0.5f * 3.14159265f / 180.0f );
+        const auto tan_x = tan_y * kAspect;
+
+        Graphics::Utils::sPacked_Lights lights;
+        lights.Reserve( _count );
+
+        for( size_t i = 0; i < _count; i++ )
+        {
+            // Squared so most lights end up close to the camera, like they do on screen.
+            const auto depth    = range( -0.1f, 1.1f );
+            const auto z        = depth * std::abs( depth ) * kFar;
+            const auto spread   = std::max( z, 1.0f ) * 1.2f;
+            const auto position = cVector3f{ range( -spread, spread ) * tan_x, range( -spread, spread ) * tan_y, z };
+            const auto radius   = range( 0.25f, 2.5f );
+
+            if( i % 4 != 3 )
+            {
+                lights.AddPoint( position, radius );
+                continue;
+            }
+
+            auto direction = cVector3f{ range( -1.0f, 1.0f ), range( -1.0f, 1.0f ), range( -1.0f, 1.0f ) };
+            direction.normalize();
+
+            lights.AddSpot( position, direction, radius, range( 0.1f, 1.2f ) );
+        }
+
+        return lights;
+    } // MakeLights
+
+    // The same tests as the clusters make, in doubles.
+    inline auto Overlap( const Graphics::Utils::sPacked_Lights& _lights, const size_t _light,
+        const Graphics::Utils::sPacked_Bounds& _bounds, const size_t _cluster ) -> eOverlap
+    {
+        const auto compare = [ & ]( const double _a, const double _b )
+        {
+            // Relative to the size of the light, as that's what the errors scale with.
+            const auto epsilon = 1e-4 * std::max( 1.0, static_cast< double >( _lights.radius[ _light ] ) + static_cast< double >( _lights.z[ _light ] ) );
+            if( std::abs( _a - _b ) < epsilon )
+                return eOverlap::kEdge;
+
+            return _a < _b ? eOverlap::kInside : eOverlap::kOutside;
+        };
+
+        const double lx = _lights.x[ _light ], ly = _lights.y[ _light ], lz = _lights.z[ _light ];
+        const double radius = _lights.radius[ _light ];
+
+        const double cx = _bounds.center_x[ _cluster ], cy = _bounds.center_y[ _cluster ], cz = _bounds.center_z[ _cluster ];
+        const double ex = _bounds.extent_x[ _cluster ], ey = _bounds.extent_y[ _cluster ], ez = _bounds.extent_z[ _cluster ];
+
+        const auto ox = std::max( std::abs( cx - lx ) - ex, 0.0 );
+        const auto oy = std::max( std::abs( cy - ly ) - ey, 0.0 );
+        const auto oz = std::max( std::abs( cz - lz ) - ez, 0.0 );
+
+        const auto sphere = compare( std::sqrt( ox * ox + oy * oy + oz * oz ), radius );
+        if( sphere == eOverlap::kOutside || _lights.cone_cos[ _light ] <= -1.0f )
+            return sphere;
+
+        const double dx = _lights.dir_x[ _light ], dy = _lights.dir_y[ _light ], dz = _lights.dir_z[ _light ];
+
+        const auto bounds_radius = std::sqrt( ex * ex + ey * ey + ez * ez );
+        const auto vx = cx - lx, vy = cy - ly, vz = cz - lz;
+        const auto length_sq = vx * vx + vy * vy + vz * vz;
+        const auto along     = vx * dx + vy * dy + vz * dz;
+        const auto closest   = _lights.cone_cos[ _light ] * std::sqrt( std::max( length_sq - along * along, 0.0 ) ) - along * _lights.cone_sin[ _light ];
+
+        // The cone only removes clusters, so the box has to be inside every test to count as inside.
+        eOverlap result = sphere;
+        for( const auto cone : { compare( closest, bounds_radius ), compare( along, bounds_radius + radius ), compare( -bounds_radius, along ) } )
+        {
+            if( cone == eOverlap::kOutside )
+                return eOverlap::kOutside;
+            if( cone == eOverlap::kEdge )
+                result = eOverlap::kEdge;
+        }
+
+        return result;
+    } // Overlap
+} // sk::Testing::
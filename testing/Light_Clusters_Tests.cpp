@@ -0,0 +1,86 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Test.h"
+#include "Light_Clusters_Reference.h"
+
+#include <sk/Assets/Management/Asset_Job_Manager.h>
+
+#include <algorithm>
+
+using namespace sk::Graphics::Utils;
+
+namespace
+{
+    // Every light the reference is sure about has to be listed, or left out, exactly like it says.
+    void compare( const size_t _count, const uint32_t _seed, const sCluster_Grid& _grid )
+    {
+        const auto lights = sk::Testing::MakeLights( _count, _seed );
+
+        cLight_Clusters clusters;
+        clusters.Build( _grid, sk::Testing::kFov, sk::Testing::kAspect, sk::Testing::kNear, sk::Testing::kFar );
+        clusters.Assign( lights );
+
+        SK_CHECK( clusters.GetClusters().size() == _grid.GetCount() );
+
+        size_t missing = 0, extra = 0, hits = 0;
+        for( size_t cluster = 0; cluster < _grid.GetCount(); cluster++ )
+        {
+            const auto listed = clusters.GetLights( cluster );
+            SK_CHECK( std::ranges::is_sorted( listed ) && std::ranges::adjacent_find( listed ) == listed.end() );
+
+            for( uint32_t light = 0; light < lights.GetSize(); light++ )
+            {
+                const auto overlap   = sk::Testing::Overlap( lights, light, clusters.GetBounds(), cluster );
+                const bool is_listed = std::ranges::binary_search( listed, light );
+
+                hits    += is_listed;
+                missing += overlap == sk::Testing::eOverlap::kInside  && !is_listed;
+                extra   += overlap == sk::Testing::eOverlap::kOutside &&  is_listed;
+            }
+        }
+
+        SK_CHECK( missing == 0 );
+        SK_CHECK( extra   == 0 );
+        SK_CHECK( hits == clusters.GetIndices().size() );
+        // Makes sure the scene actually lights something.
+        SK_CHECK( hits > _count );
+    } // compare
+
+    void test_slices()
+    {
+        cLight_Clusters clusters;
+        clusters.Build( {}, sk::Testing::kFov, sk::Testing::kAspect, sk::Testing::kNear, sk::Testing::kFar );
+
+        SK_CHECK( clusters.GetSlice( 0.0f ) == 0 );
+        SK_CHECK( clusters.GetSlice( sk::Testing::kNear ) == 0 );
+        SK_CHECK( clusters.GetSlice( sk::Testing::kFar * 2.0f ) == clusters.GetGrid().z - 1 );
+
+        // Every slice covers the same ratio of depths.
+        const auto& bounds = clusters.GetBounds();
+        for( uint32_t z = 0; z < clusters.GetGrid().z; z++ )
+        {
+            const auto index = clusters.GetIndex( 0, 0, z );
+            SK_CHECK( clusters.GetSlice( bounds.center_z[ index ] ) == z );
+        }
+    } // test_slices
+} // ::
+
+int main()
+{
+    sk::Assets::Jobs::cAsset_Job_Manager::init();
+
+    sk::Testing::Run( "Slices", &test_slices );
+    // Few enough lights to be assigned in place.
+    sk::Testing::Run( "Reference, 100 lights",  []{ compare( 100, 1, {} ); } );
+    // Spread over the asset workers.
+    sk::Testing::Run( "Reference, 2000 lights", []{ compare( 2000, 2, {} ); } );
+    sk::Testing::Run( "Reference, odd grid",    []{ compare( 2000, 3, { .x = 7, .y = 5, .z = 11 } ); } );
+
+    sk::Assets::Jobs::cAsset_Job_Manager::shutdown();
+
+    return sk::Testing::Finish();
+}
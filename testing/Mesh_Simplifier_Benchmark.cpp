@@ -0,0 +1,111 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Test.h"
+
+#include <sk/Assets/Utils/Mesh_Simplifier.h>
+#include <sk/Math/Vector3.h>
+
+#include <chrono>
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+namespace
+{
+    // A closed torus has no borders or seams, so every vertex can be collapsed.
+    constexpr uint32_t kRings    = 1'000;
+    constexpr uint32_t kSides    = 500;
+    constexpr float    kRadius   = 1.0f;
+    constexpr float    kThickness = 0.3f;
+    // Bumps on the surface, so the error isn't the same for every edge.
+    constexpr float    kBumps    = 0.02f;
+
+    struct sMesh
+    {
+        std::vector< sk::cVector3f > positions;
+        std::vector< uint32_t >      indices;
+    };
+
+    auto make_torus()
+    {
+        sMesh mesh;
+        mesh.positions.reserve( kRings * kSides );
+        for( uint32_t r = 0; r < kRings; r++ )
+        {
+            const auto u = static_cast< float >( r ) / kRings * 2.0f * std::numbers::pi_v< float >;
+            for( uint32_t s = 0; s < kSides; s++ )
+            {
+                const auto v      = static_cast< float >( s ) / kSides * 2.0f * std::numbers::pi_v< float >;
+                const auto radius = kThickness + kBumps * std::sin( u * 37.0f ) * std::sin( v * 11.0f );
+                mesh.positions.emplace_back( ( kRadius + radius * std::cos( v ) ) * std::cos( u ), radius * std::sin( v ), ( kRadius + radius * std::cos( v ) ) * std::sin( u ) );
+            }
+        }
+
+        mesh.indices.reserve( kRings * kSides * 6 );
+        for( uint32_t r = 0; r < kRings; r++ )
+        {
+            for( uint32_t s = 0; s < kSides; s++ )
+            {
+                const auto a = r * kSides + s;
+                const auto b = ( r + 1 ) % kRings * kSides + s;
+                const auto c = ( r + 1 ) % kRings * kSides + ( s + 1 ) % kSides;
+                const auto d = r * kSides + ( s + 1 ) % kSides;
+                mesh.indices.insert( mesh.indices.end(), { a, b, c, a, c, d } );
+            }
+        }
+
+        return mesh;
+    } // make_torus
+
+    // Measure runs everything twice, and a simplification is long enough on its own.
+    template< class Fn >
+    auto once( Fn&& _fn )
+    {
+        const auto start = std::chrono::steady_clock::now();
+        _fn();
+        return std::chrono::duration< double, std::milli >( std::chrono::steady_clock::now() - start ).count();
+    } // once
+} // ::
+
+// Simplifies a 1M triangle torus down to a tenth, then generates a LOD chain from it.
+int main()
+{
+    using namespace sk::Assets::Utils;
+
+    const auto mesh      = make_torus();
+    const auto triangles = mesh.indices.size() / 3;
+    const auto target    = mesh.indices.size() / 10;
+
+    std::vector< uint32_t > simplified;
+    float error = 0.0f;
+    const auto simplify_ms = once( [ & ]
+    {
+        simplified = SimplifyMesh( mesh.indices.data(), mesh.indices.size(), mesh.positions.data(), mesh.positions.size(), sizeof( sk::cVector3f ), target, std::numeric_limits< float >::max(), &error );
+    } );
+
+    std::vector< sSimplified_Lod > lods;
+    const auto lods_ms = once( [ & ]
+    {
+        lods = GenerateLods( mesh.indices.data(), mesh.indices.size(), mesh.positions.data(), mesh.positions.size(), sizeof( sk::cVector3f ) );
+    } );
+
+    const auto removed = static_cast< double >( triangles - simplified.size() / 3 );
+
+    std::println( "Mesh simplifier, {} triangles", triangles );
+    std::println( "Simplify:  {:.3f} ms, {} triangles left, {:.5f} error", simplify_ms, simplified.size() / 3, error );
+    std::println( "Rate:      {:.0f} triangles removed a second", removed / ( simplify_ms / 1000.0 ) );
+    std::println( "{} LODs:    {:.3f} ms", lods.size(), lods_ms );
+    for( const auto& lod : lods )
+        std::println( "    {} triangles, {:.5f} error", lod.indices.size() / 3, lod.error );
+
+    // The torus is closed and smooth, so it has to get all the way to the target without a visible error.
+    const bool valid = simplified.size() <= target && !simplified.empty() && error < kThickness * 0.1f && lods.size() == 3;
+    if( !valid )
+        std::println( stderr, "The torus wasn't simplified to the target." );
+
+    return valid ? 0 : 1;
+}
@@ -0,0 +1,173 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Test.h"
+
+#include <sk/Assets/Utils/Meshlet_Builder.h>
+#include <sk/Graphics/Utils/Cluster_Culling.h>
+#include <sk/Math/Quaternion.h>
+
+#include <chrono>
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+using sk::Assets::Utils::sMeshlet;
+
+namespace
+{
+    // The same closed torus as the simplifier benchmark, a million triangles.
+    constexpr uint32_t kRings     = 1'000;
+    constexpr uint32_t kSides     = 500;
+    constexpr float    kRadius    = 1.0f;
+    constexpr float    kThickness = 0.3f;
+
+    struct sMesh
+    {
+        std::vector< sk::cVector3f > positions;
+        std::vector< uint32_t >      indices;
+    };
+
+    auto make_torus()
+    {
+        sMesh mesh;
+        mesh.positions.reserve( kRings * kSides );
+        for( uint32_t r = 0; r < kRings; r++ )
+        {
+            const auto u = static_cast< float >( r ) / kRings * 2.0f * std::numbers::pi_v< float >;
+            for( uint32_t s = 0; s < kSides; s++ )
+            {
+                const auto v = static_cast< float >( s ) / kSides * 2.0f * std::numbers::pi_v< float >;
+                mesh.positions.emplace_back( ( kRadius + kThickness * std::cos( v ) ) * std::cos( u ), kThickness * std::sin( v ), ( kRadius + kThickness * std::cos( v ) ) * std::sin( u ) );
+            }
+        }
+
+        mesh.indices.reserve( kRings * kSides * 6 );
+        for( uint32_t r = 0; r < kRings; r++ )
+        {
+            for( uint32_t s = 0; s < kSides; s++ )
+            {
+                const auto a = r * kSides + s;
+                const auto b = ( r + 1 ) % kRings * kSides + s;
+                const auto c = ( r + 1 ) % kRings * kSides + ( s + 1 ) % kSides;
+                const auto d = r * kSides + ( s + 1 ) % kSides;
+                mesh.indices.insert( mesh.indices.end(), { a, b, c, a, c, d } );
+            }
+        }
+
+        return mesh;
+    } // make_torus
+
+    // Building only happens once at import, and Measure runs everything twice.
+    template< class Fn >
+    auto once( Fn&& _fn )
+    {
+        const auto start = std::chrono::steady_clock::now();
+        _fn();
+        return std::chrono::duration< double, std::milli >( std::chrono::steady_clock::now() - start ).count();
+    } // once
+
+    // Every triangle has to end up in exactly one meshlet, within the limits and inside of its bounding sphere.
+    bool is_valid( const sMesh& _mesh, const sk::Assets::Utils::sMeshlet_Data& _data )
+    {
+        size_t triangles = 0;
+        for( const auto& meshlet : _data.meshlets )
+        {
+            if( meshlet.vertex_count > sMeshlet::kMaxVertices || meshlet.triangle_count > sMeshlet::kMaxTriangles )
+                return false;
+
+            for( size_t i = 0; i < meshlet.vertex_count; i++ )
+            {
+                const auto& position = _mesh.positions[ _data.vertices[ meshlet.vertex_offset + i ] ];
+                if( sk::Math::Vector3::Length( position - meshlet.center ) > meshlet.radius * 1.0001f + 1e-6f )
+                    return false;
+            }
+
+            triangles += meshlet.triangle_count;
+        }
+
+        return triangles == _mesh.indices.size() / 3 && _data.triangles.size() == _mesh.indices.size();
+    } // is_valid
+
+    // A meshlet culled by its cone may only contain triangles facing away from the camera.
+    bool is_back_facing( const sk::Assets::Utils::sMeshlet_Data& _data, const sMesh& _mesh, const sMeshlet& _meshlet, const sk::cVector3f& _view )
+    {
+        for( size_t i = 0; i < _meshlet.triangle_count; i++ )
+        {
+            const auto vertex = [ & ]( const size_t _k ) -> auto&
+            {
+                return _mesh.positions[ _data.vertices[ _meshlet.vertex_offset + _data.triangles[ _meshlet.triangle_offset + i * 3 + _k ] ] ];
+            };
+
+            const auto normal = sk::Math::Vector3::Cross( vertex( 1 ) - vertex( 0 ), vertex( 2 ) - vertex( 0 ) );
+            if( sk::Math::Vector3::Dot( normal, vertex( 0 ) - _view ) < 0.0f )
+                return false;
+        }
+        return true;
+    } // is_back_facing
+} // ::
+
+// Splits a million triangle torus into meshlets, then culls them from a camera looking down at the near side of the ring.
+int main()
+{
+    const auto mesh = make_torus();
+
+    sk::Assets::Utils::sMeshlet_Data data;
+    const auto build_ms = once( [ & ]
+    {
+        data = sk::Assets::Utils::BuildMeshlets( mesh.indices.data(), mesh.indices.size(), mesh.positions.data(), mesh.positions.size(), sizeof( sk::cVector3f ) );
+    } );
+
+    // Close to the ring, so only the near side of it is in view.
+    const sk::cVector3f view  { 0.0f, 1.0f, -1.5f };
+    const sk::cVector3f target{ 0.0f, 0.0f, -1.0f };
+    const auto camera  = sk::Math::Matrix4x4::scale_rotate_translate( sk::cVector3f{ 1.0f }, sk::cQuaternionf::LookRotation( target - view ), view );
+    const auto frustum = sk::cFrustumf( camera.inversed_affine() * sk::Math::Matrix4x4::AspectPerspective( 16.0f / 9.0f, 60.0f, 0.1f, 100.0f ) );
+    const auto world = sk::cMatrix4x4f{};
+
+    std::vector< sk::Graphics::Utils::sMeshlet_Range > ranges;
+    size_t survivors = 0;
+    const auto cull_ms = sk::Testing::Measure( 100, [ & ]
+    {
+        ranges.clear();
+        survivors = sk::Graphics::Utils::CullMeshlets( data.meshlets, world, frustum, view, ranges );
+    } );
+
+    // Sorts out what the frustum and what the cones removed.
+    std::vector< uint8_t > kept( data.meshlets.size(), 0 );
+    for( const auto& range : ranges )
+        std::fill_n( kept.begin() + range.first, range.count, 1 );
+
+    size_t outside = 0, back_facing = 0;
+    bool   valid   = is_valid( mesh, data );
+    for( size_t i = 0; i < data.meshlets.size(); i++ )
+    {
+        const auto& meshlet = data.meshlets[ i ];
+        if( kept[ i ] )
+            continue;
+
+        if( !frustum.Intersects( meshlet.center, meshlet.radius ) )
+            outside++;
+        else
+        {
+            back_facing++;
+            valid &= is_back_facing( data, mesh, meshlet, view );
+        }
+    }
+
+    const auto triangles = mesh.indices.size() / 3;
+    std::println( "Meshlets, {} triangles", triangles );
+    std::println( "Build: {:.3f} ms, {} meshlets, {:.1f} vertices and {:.1f} triangles each", build_ms, data.meshlets.size(),
+        static_cast< double >( data.vertices.size() ) / static_cast< double >( data.meshlets.size() ), static_cast< double >( triangles ) / static_cast< double >( data.meshlets.size() ) );
+    std::println( "Cull:  {:.3f} ms, {} kept in {} ranges, {} outside the frustum, {} facing away", cull_ms, survivors, ranges.size(), outside, back_facing );
+
+    // The camera sees part of the torus, so both the frustum and the cones have to remove something.
+    valid &= survivors > 0 && outside > 0 && back_facing > 0 && survivors + outside + back_facing == data.meshlets.size();
+    if( !valid )
+        std::println( stderr, "The meshlets didn't cover the mesh, or a meshlet with triangles facing the camera was culled." );
+
+    return valid ? 0 : 1;
+}
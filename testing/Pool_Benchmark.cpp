@@ -0,0 +1,119 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Test.h"
+
+#include <sk/Assets/Management/Asset_Job_Manager.h>
+#include <sk/Math/Transform_Hierarchy.h>
+#include <sk/Memory/Pool.h>
+#include <sk/Scene/Scene.h>
+#include <sk/Scene/Components/SpinComponent.h>
+#include <sk/Scene/Managers/EventManager.h>
+#include <sk/Scene/Managers/Internal_Component_Manager.h>
+#include <sk/Scene/Managers/Layer_Manager.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <thread>
+
+using namespace sk::Object::Components;
+
+namespace
+{
+    // 50k spawns and 50k despawns every second at 60 frames a second, for 5 seconds.
+    constexpr size_t kFrames   = 300;
+    constexpr size_t kPerFrame = 50'000 / 60;
+    constexpr size_t kAlive    = 10'000;
+    // Frames before the pool is expected to stop growing.
+    constexpr size_t kSettled  = 60;
+
+    using pool_t = sk::Memory::cPool< sk::Object::iObject >;
+} // ::
+
+// Spawns and despawns 50k objects a second with a spin component each, like a particle or projectile heavy scene.
+// Another thread reads the pool counters the whole time, like a stats overlay would.
+int main()
+{
+    sk::cEventManager::init();
+    sk::cTransform_Hierarchy::init();
+    sk::Scene::cLayer_Manager::init();
+    sk::Scene::cInternal_Component_Manager::init();
+    sk::Assets::Jobs::cAsset_Job_Manager::init();
+
+    auto& pool  = pool_t::Get();
+    auto  scene = sk::make_shared< sk::cScene >();
+    std::deque< sk::cShared_ptr< sk::Object::iObject > > alive;
+
+    std::atomic_bool running  = true;
+    size_t           reads    = 0;
+    size_t           max_used = 0;
+    std::thread reader( [ & ]
+    {
+        for( ; running.load( std::memory_order_relaxed ); reads++ )
+            max_used = std::max( max_used, pool.GetUsed() );
+    } );
+
+    const auto spawn = [ & ]( const size_t _count )
+    {
+        for( size_t i = 0; i < _count; i++ )
+        {
+            auto& object = alive.emplace_back( scene->Instantiate( "Spawned" ) );
+            object->AddComponent< cSpinComponent >( sk::cVector3f{ 0.0f, 5.0f, 0.0f } );
+        }
+    };
+
+    spawn( kAlive );
+
+    double total_ms = 0.0;
+    double worst_ms = 0.0;
+    size_t settled_capacity = 0;
+    for( size_t frame = 0; frame < kFrames; frame++ )
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        for( size_t i = 0; i < kPerFrame; i++ )
+        {
+            scene->Destroy( alive.front() );
+            alive.pop_front();
+        }
+        spawn( kPerFrame );
+
+        const auto ms = std::chrono::duration< double, std::milli >( std::chrono::steady_clock::now() - start ).count();
+        total_ms += ms;
+        worst_ms  = std::max( worst_ms, ms );
+
+        if( frame == kSettled )
+            settled_capacity = pool.GetCapacity();
+    }
+
+    running = false;
+    reader.join();
+
+    const auto capacity = pool.GetCapacity();
+
+    std::println( "Pool, {} spawned and despawned every frame for {} frames, {} alive", kPerFrame, kFrames, kAlive );
+    std::println( "Frame:   {:.3f} ms average, {:.3f} ms worst", total_ms / kFrames, worst_ms );
+    std::println( "Rate:    {:.0f} spawns a second of frame time", static_cast< double >( kPerFrame * kFrames ) / ( total_ms / 1000.0 ) );
+    std::println( "Objects: {} slots, {} used at most, read {} times from another thread", capacity, max_used, reads );
+
+    // Once the scene has settled, every spawn has to reuse a slot instead of growing the pool.
+    const bool valid = capacity == settled_capacity;
+    if( !valid )
+        std::println( stderr, "The pool kept growing after {} frames, from {} to {} slots.", kSettled, settled_capacity, capacity );
+
+    alive.clear();
+    scene = nullptr;
+
+    sk::Assets::Jobs::cAsset_Job_Manager::shutdown();
+    sk::Scene::cInternal_Component_Manager::shutdown();
+    sk::Scene::cLayer_Manager::shutdown();
+    sk::cTransform_Hierarchy::shutdown();
+    sk::cEventManager::shutdown();
+
+    return valid ? 0 : 1;
+}
@@ -0,0 +1,143 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Test.h"
+
+#include <sk/Assets/Management/Asset_Job_Manager.h>
+#include <sk/Math/Transform_Hierarchy.h>
+#include <sk/Scene/Prefab.h>
+#include <sk/Scene/Scene.h>
+#include <sk/Scene/Components/SpinComponent.h>
+#include <sk/Scene/Components/TransformComponent.h>
+#include <sk/Scene/Managers/EventManager.h>
+#include <sk/Scene/Managers/Internal_Component_Manager.h>
+#include <sk/Scene/Managers/Layer_Manager.h>
+
+#include <string>
+#include <vector>
+
+using namespace sk::Object::Components;
+
+namespace
+{
+    constexpr size_t kInstances = 10'000;
+
+    auto position( const size_t _index ){ return sk::cVector3f( static_cast< float >( _index % 100 ) * 2.0f, 0.0f, static_cast< float >( _index / 100 ) * 2.0f ); }
+
+    // The same layout cApp::create builds its clones with, with a plain transform instead of the mesh.
+    void clone( sk::cScene& _scene, std::vector< sk::cShared_ptr< sk::Object::iObject > >& _objects )
+    {
+        for( size_t i = 0; i < kInstances; i++ )
+        {
+            auto object = _scene.Instantiate( "Clone" );
+            object->GetTransform().SetPosition( position( i ) );
+
+            auto spin  = object->AddComponent< cSpinComponent >( sk::cVector3f{ 0.0f, 5.0f, 0.0f } );
+            auto child = object->AddComponent< cTransformComponent >();
+            child->SetPosition( sk::cVector3f{ 0.0f, 1.0f, 0.0f } );
+            child->SetScale( sk::cVector3f{ 0.5f } );
+            child->SetParent( spin );
+            child->enabled();
+
+            _objects.emplace_back( std::move( object ) );
+        }
+    } // clone
+
+    // Converts to the same spin speed, but isn't trivially copyable, so the prefab has to bind it into a std::function.
+    struct sBound_Speed
+    {
+        std::string name = "Spin";
+
+        operator sk::cVector3f() const { return { 0.0f, 5.0f, 0.0f }; }
+    };
+
+    void destroy_all( sk::cScene& _scene, std::vector< sk::cShared_ptr< sk::Object::iObject > >& _objects )
+    {
+        for( const auto& object : _objects )
+            _scene.Destroy( object );
+        _objects.clear();
+    } // destroy_all
+} // ::
+
+// Spawns 10k objects by adding their components one by one like cApp does, and from a prefab with packed and bound arguments,
+// on one thread and on the asset workers.
+int main()
+{
+    sk::cEventManager::init();
+    sk::cTransform_Hierarchy::init();
+    sk::Scene::cLayer_Manager::init();
+    sk::Scene::cInternal_Component_Manager::init();
+    auto& jobs = sk::Assets::Jobs::cAsset_Job_Manager::init();
+
+    sk::Scene::cPrefab prefab;
+    const auto spin  = prefab.AddComponent< cSpinComponent >( sk::cVector3f{ 0.0f, 5.0f, 0.0f } );
+    const auto child = prefab.AddComponent< cTransformComponent >();
+    prefab.SetParent( child, spin );
+    prefab.SetTransform( child, { .position = sk::cVector3f{ 0.0f, 1.0f, 0.0f }, .scale = sk::cVector3f{ 0.5f } } );
+    prefab.SetEnabled( child );
+
+    // The same layout, with the spin speed bound instead of packed.
+    sk::Scene::cPrefab bound;
+    const auto bound_spin  = bound.AddComponent< cSpinComponent >( sBound_Speed{} );
+    const auto bound_child = bound.AddComponent< cTransformComponent >();
+    bound.SetParent( bound_child, bound_spin );
+    bound.SetTransform( bound_child, { .position = sk::cVector3f{ 0.0f, 1.0f, 0.0f }, .scale = sk::cVector3f{ 0.5f } } );
+    bound.SetEnabled( bound_child );
+
+    const auto place = []( sk::Object::iObject& _object, const size_t _index ){ _object.GetTransform().SetPosition( position( _index ) ); };
+
+    auto scene = sk::make_shared< sk::cScene >();
+    std::vector< sk::cShared_ptr< sk::Object::iObject > > objects;
+    objects.reserve( kInstances );
+
+    // Destroying is part of every run, so the pools are warm for all of them.
+    const auto clone_ms = sk::Testing::Measure( 10, [ & ]
+    {
+        clone( *scene, objects );
+        destroy_all( *scene, objects );
+    } );
+
+    const auto instantiate = [ & ]( const sk::Scene::cPrefab& _prefab )
+    {
+        for( size_t i = 0; i < kInstances; i++ )
+        {
+            auto& object = objects.emplace_back( _prefab.Instantiate( *scene, "Prefab" ) );
+            place( *object, i );
+        }
+        destroy_all( *scene, objects );
+    };
+
+    const auto prefab_ms = sk::Testing::Measure( 10, [ & ]{ instantiate( prefab ); } );
+    const auto bound_ms  = sk::Testing::Measure( 10, [ & ]{ instantiate( bound ); } );
+
+    const auto batch_ms = sk::Testing::Measure( 10, [ & ]
+    {
+        objects = prefab.InstantiateBatch( *scene, "Prefab", kInstances, place );
+        destroy_all( *scene, objects );
+    } );
+
+    std::println( "Prefab, {} instances of {} components, {} asset workers", kInstances, prefab.GetStepCount(), jobs.GetWorkerCount() );
+    std::println( "Every run includes destroying the instances again." );
+    std::println( "Clone:    {:.3f} ms", clone_ms );
+    std::println( "Prefab:   {:.3f} ms", prefab_ms );
+    std::println( "Bound:    {:.3f} ms", bound_ms );
+    std::println( "Batch:    {:.3f} ms", batch_ms );
+
+    // Both of the steps of the prefab have to take the packed path, or the timings above don't show it.
+    const bool valid = prefab.IsPacked( spin ) && prefab.IsPacked( child ) && !bound.IsPacked( bound_spin );
+    if( !valid )
+        std::println( stderr, "The prefab arguments weren't packed as expected." );
+
+    scene = nullptr;
+
+    sk::Assets::Jobs::cAsset_Job_Manager::shutdown();
+    sk::Scene::cInternal_Component_Manager::shutdown();
+    sk::Scene::cLayer_Manager::shutdown();
+    sk::cTransform_Hierarchy::shutdown();
+    sk::cEventManager::shutdown();
+
+    return valid ? 0 : 1;
+}
@@ -0,0 +1,109 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Test.h"
+
+#include <sk/Math/Matrix4x4.h>
+#include <sk/Math/Quaternion.h>
+#include <sk/Math/Simd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace sk::Math;
+
+namespace
+{
+    constexpr size_t kTransforms = 1'000'000;
+    constexpr float  kDelta      = 1.0f / 60.0f;
+
+    struct sTransforms
+    {
+        std::vector< sk::cVector3f >    positions;
+        std::vector< sk::cVector3f >    scales;
+        std::vector< sk::cVector3f >    eulers;
+        std::vector< sk::cQuaternionf > rotations;
+        std::vector< sk::cVector3f >    speeds;
+    };
+
+    auto make_transforms()
+    {
+        std::mt19937 random{ 1 };
+        const auto range = [ & ]( const float _min, const float _max ){ return std::uniform_real_distribution( _min, _max )( random ); };
+        const auto vector = [ & ]( const float _min, const float _max ){ return sk::cVector3f{ range( _min, _max ), range( _min, _max ), range( _min, _max ) }; };
+
+        sTransforms transforms;
+        for( size_t i = 0; i < kTransforms; i++ )
+        {
+            transforms.positions.emplace_back( vector( -100.0f, 100.0f ) );
+            transforms.scales   .emplace_back( vector( 0.5f, 2.0f ) );
+            transforms.eulers   .emplace_back( vector( -3.0f, 3.0f ) );
+            transforms.rotations.emplace_back( sk::cQuaternionf::FromEuler( transforms.eulers.back() ) );
+            transforms.speeds   .emplace_back( vector( -2.0f, 2.0f ) );
+        }
+        return transforms;
+    } // make_transforms
+} // ::
+
+// Builds 1M world matrices from euler angles like the transforms used to, and from quaternions like they do now.
+// Then spins them a frame, by adding to the angles and by composing a rotation the way cSpinComponent does.
+int main()
+{
+    auto transforms = make_transforms();
+    std::vector< sk::cMatrix4x4f > matrices( kTransforms );
+
+    const auto euler_ms = sk::Testing::Measure( 10, [ & ]
+    {
+        for( size_t i = 0; i < kTransforms; i++ )
+            matrices[ i ] = Matrix4x4::scale_rotate_translate( transforms.scales[ i ], transforms.eulers[ i ], transforms.positions[ i ] );
+    } );
+    const auto euler_matrices = matrices;
+
+    const auto quaternion_ms = sk::Testing::Measure( 10, [ & ]
+    {
+        for( size_t i = 0; i < kTransforms; i++ )
+            matrices[ i ] = Matrix4x4::scale_rotate_translate( transforms.scales[ i ], transforms.rotations[ i ], transforms.positions[ i ] );
+    } );
+
+    // Spinning used to only add to the angles, now every frame composes a rotation and normalizes it.
+    const auto add_ms = sk::Testing::Measure( 10, [ & ]
+    {
+        for( size_t i = 0; i < kTransforms; i++ )
+            transforms.eulers[ i ] += transforms.speeds[ i ] * kDelta;
+    } );
+
+    const auto compose_ms = sk::Testing::Measure( 10, [ & ]
+    {
+        for( size_t i = 0; i < kTransforms; i++ )
+            transforms.rotations[ i ] = ( sk::cQuaternionf::FromEuler( transforms.speeds[ i ] * kDelta ) * transforms.rotations[ i ] ).Normalize();
+    } );
+
+    double difference = 0.0;
+    for( size_t i = 0; i < kTransforms; i++ )
+    {
+        for( size_t r = 0; r < 4; r++ )
+        {
+            for( size_t c = 0; c < 4; c++ )
+                difference = std::max( difference, static_cast< double >( std::abs( ( &matrices[ i ][ r ].x )[ c ] - ( &euler_matrices[ i ][ r ].x )[ c ] ) ) );
+        }
+    }
+
+    std::println( "Quaternions, {} backend, {} transforms", Simd::kBackend, kTransforms );
+    std::println( "Build from euler:      {:.3f} ms", euler_ms );
+    std::println( "Build from quaternion: {:.3f} ms", quaternion_ms );
+    std::println( "Spin euler:            {:.3f} ms", add_ms );
+    std::println( "Spin quaternion:       {:.3f} ms", compose_ms );
+    std::println( "Largest difference between the matrices: {:.2e}", difference );
+
+    // Both have to build the same matrices, or the timings aren't comparable.
+    const bool valid = difference < 1e-4;
+    if( !valid )
+        std::println( stderr, "The euler and quaternion matrices didn't match." );
+
+    return valid ? 0 : 1;
+}
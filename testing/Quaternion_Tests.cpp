@@ -0,0 +1,127 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Test.h"
+
+#include <sk/Math/Matrix4x4.h>
+#include <sk/Math/Quaternion.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace sk::Math;
+
+namespace
+{
+    // A minute at 60 fps has 3600 frames, this is about four and a half hours of spinning.
+    constexpr size_t kSteps = 1'000'000;
+    constexpr float  kDelta = 1.0f / 60.0f;
+
+    std::mt19937 random{ 1 };
+
+    auto next( const float _min = -3.0f, const float _max = 3.0f ){ return std::uniform_real_distribution( _min, _max )( random ); }
+
+    auto to_matrix( const sk::cQuaternionf& _rotation ){ return Matrix4x4::scale_rotate_translate( sk::cVector3f{ 1.0f }, _rotation, sk::cVector3f{ 0.0f } ); }
+
+    // The largest difference between any two elements of the upper 3x3.
+    template< class Ty >
+    auto difference( const sk::cMatrix4x4f& _a, const cMatrix4x4< Ty >& _b )
+    {
+        double result = 0.0;
+        for( size_t r = 0; r < 3; r++ )
+        {
+            for( size_t c = 0; c < 3; c++ )
+                result = std::max( result, std::abs( static_cast< double >( ( &_a[ r ].x )[ c ] ) - static_cast< double >( ( &_b[ r ].x )[ c ] ) ) );
+        }
+        return result;
+    } // difference
+
+    // How far the rows are from being unit length and perpendicular, which shows up as scale and shear.
+    auto orthonormal_error( const sk::cMatrix4x4f& _matrix )
+    {
+        double result = 0.0;
+        for( size_t a = 0; a < 3; a++ )
+        {
+            for( size_t b = 0; b < 3; b++ )
+            {
+                double dot = 0.0;
+                for( size_t c = 0; c < 3; c++ )
+                    dot += static_cast< double >( ( &_matrix[ a ].x )[ c ] ) * static_cast< double >( ( &_matrix[ b ].x )[ c ] );
+                result = std::max( result, std::abs( dot - ( a == b ? 1.0 : 0.0 ) ) );
+            }
+        }
+        return result;
+    } // orthonormal_error
+
+    void test_euler()
+    {
+        for( int i = 0; i < 1000; i++ )
+        {
+            const sk::cVector3f euler{ next(), next(), next() };
+            const auto from_euler = Matrix4x4::scale_rotate_translate( sk::cVector3f{ 1.0f }, euler, sk::cVector3f{ 0.0f } );
+            SK_CHECK( difference( to_matrix( sk::cQuaternionf::FromEuler( euler ) ), from_euler ) < 1e-5 );
+        }
+    } // test_euler
+
+    // Multiplying the quaternions has to rotate the same way as multiplying their matrices.
+    void test_order()
+    {
+        for( int i = 0; i < 1000; i++ )
+        {
+            const auto a = sk::cQuaternionf::FromEuler( sk::cVector3f{ next(), next(), next() } );
+            const auto b = sk::cQuaternionf::FromEuler( sk::cVector3f{ next(), next(), next() } );
+            SK_CHECK( difference( to_matrix( a * b ), to_matrix( a ) * to_matrix( b ) ) < 1e-5 );
+        }
+    } // test_order
+
+    // Spins a rotation a frame at a time like cSpinComponent, through cTransform::Rotate's quaternion path and by multiplying matrices.
+    void test_composition()
+    {
+        const auto speed = sk::cVector3f{ 0.3f, 1.1f, -0.7f } * kDelta;
+        const auto step  = sk::cQuaternionf::FromEuler( speed );
+
+        sk::cQuaternionf quaternion;
+        auto matrix = to_matrix( quaternion );
+        const auto step_matrix = to_matrix( step );
+
+        // The same steps in doubles, which stay exact to well past the float error.
+        const sk::cQuaterniond step_reference{ step.x, step.y, step.z, step.w };
+        sk::cQuaterniond reference;
+
+        for( size_t i = 0; i < kSteps; i++ )
+        {
+            quaternion = ( step * quaternion ).Normalize();
+            matrix     = step_matrix * matrix;
+            reference  = ( step_reference * reference ).Normalize();
+        }
+
+        const auto expected         = reference.ToMatrix();
+        const auto quaternion_error = difference( to_matrix( quaternion ), expected );
+        const auto matrix_error     = difference( matrix, expected );
+        const auto quaternion_shear = orthonormal_error( to_matrix( quaternion ) );
+        const auto matrix_shear     = orthonormal_error( matrix );
+
+        std::println( "    {} steps, quaternion error {:.2e} and drift {:.2e}, matrix error {:.2e} and drift {:.2e}", kSteps,
+            quaternion_error, quaternion_shear, matrix_error, matrix_shear );
+
+        // Normalizing every step keeps the rotation a rotation, whatever the angle has drifted to.
+        SK_CHECK( std::abs( static_cast< double >( quaternion.Length() ) - 1.0 ) < 1e-6 );
+        SK_CHECK( quaternion_shear < 1e-5 );
+        SK_CHECK( quaternion_shear < matrix_shear );
+        SK_CHECK( quaternion_error < 1e-3 );
+        SK_CHECK( quaternion_error <= matrix_error );
+    } // test_composition
+} // ::
+
+int main()
+{
+    sk::Testing::Run( "Matches the euler matrices", &test_euler );
+    sk::Testing::Run( "Composes like the matrices", &test_order );
+    sk::Testing::Run( "Repeated composition",       &test_composition );
+
+    return sk::Testing::Finish();
+}
@@ -0,0 +1,335 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Test.h"
+
+#include <sk/Graphics/Pipelines/Render_Graph.h>
+
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace sk::Graphics;
+
+namespace
+{
+    constexpr uint32_t kBackbuffer = 1000;
+
+    // Hands out ids instead of textures, so the graph can be compiled and executed without a gpu.
+    class cId_Backend : public iGraph_Backend
+    {
+    public:
+        // A pass being executed when texture is kInvalid, a barrier otherwise.
+        struct sEvent
+        {
+            std::string   pass;
+            uint32_t      texture = cRender_Graph::kInvalid;
+            eGraph_Access from    = eGraph_Access::kNone;
+            eGraph_Access to      = eGraph_Access::kNone;
+
+            bool operator==( const sEvent& ) const = default;
+        };
+
+        auto Create( const sGraph_Texture& ) -> uint32_t override
+        {
+            m_created_++;
+            m_live_.insert( m_next_ );
+            return m_next_++;
+        } // Create
+
+        void Destroy( const uint32_t _texture ) override
+        {
+            SK_CHECK( m_live_.erase( _texture ) == 1 );
+        } // Destroy
+
+        [[ nodiscard ]] auto GetByteSize( const sGraph_Texture& _desc ) const -> size_t override
+        {
+            return static_cast< size_t >( _desc.resolution.x ) * _desc.resolution.y * 4;
+        } // GetByteSize
+
+        void Barrier( const uint32_t _texture, const eGraph_Access _from, const eGraph_Access _to ) override
+        {
+            m_events_.push_back( { .texture = _texture, .from = _from, .to = _to } );
+        } // Barrier
+
+        void Execute( const std::string& _pass ){ m_events_.push_back( { .pass = _pass } ); }
+
+        [[ nodiscard ]] auto  GetCreated() const { return m_created_; }
+        [[ nodiscard ]] auto& GetLive   () const { return m_live_; }
+        [[ nodiscard ]] auto& GetEvents () const { return m_events_; }
+        void ClearEvents(){ m_events_.clear(); }
+
+    private:
+        uint32_t             m_next_    = 0;
+        size_t               m_created_ = 0;
+        std::set< uint32_t > m_live_;
+        std::vector< sEvent > m_events_;
+    };
+
+    const auto kColor = sGraph_Texture{ .resolution = { 1920u, 1080u }, .type = sGraph_Texture::eType::kColor, .format = 0 };
+    const auto kDepth = sGraph_Texture{ .resolution = { 1920u, 1080u }, .type = sGraph_Texture::eType::kDepth, .format = 1 };
+
+    // Adds a pass which records itself to the backend when executed.
+    void add_pass( cRender_Graph& _graph, cId_Backend& _backend, const std::string& _name, cRender_Graph::setup_fn_t _setup )
+    {
+        _graph.AddPass( _name, std::move( _setup ), [ &_backend, _name ]( const cRender_Graph& ){ _backend.Execute( _name ); } );
+    } // add_pass
+
+    auto executed( const cId_Backend& _backend ) -> std::vector< std::string >
+    {
+        std::vector< std::string > passes;
+        for( const auto& event : _backend.GetEvents() )
+        {
+            if( event.texture == cRender_Graph::kInvalid )
+                passes.push_back( event.pass );
+        }
+
+        return passes;
+    } // executed
+
+    void test_cull()
+    {
+        cId_Backend backend;
+        cRender_Graph graph{ backend };
+        graph.Import( "Backbuffer", kBackbuffer );
+
+        add_pass( graph, backend, "Unused", []( cRender_Graph::cBuilder& _builder ){ _builder.Create( "Unused", kColor ); } );
+        add_pass( graph, backend, "Scene",  []( cRender_Graph::cBuilder& _builder ){ _builder.Create( "Color", kColor ); } );
+        add_pass( graph, backend, "Debug",  []( cRender_Graph::cBuilder& _builder ){ _builder.SetSideEffect(); } );
+        add_pass( graph, backend, "Read Unused", []( cRender_Graph::cBuilder& _builder )
+        {
+            _builder.Read( "Unused" );
+            _builder.Create( "Also Unused", kColor );
+        } );
+        add_pass( graph, backend, "Present", []( cRender_Graph::cBuilder& _builder )
+        {
+            _builder.Read( "Color" );
+            _builder.Write( "Backbuffer" );
+        } );
+
+        SK_CHECK( graph.Compile() );
+        SK_CHECK( graph.GetStats().passes == 3 );
+        SK_CHECK( graph.GetStats().culled == 2 );
+        // Culled passes don't get any textures either.
+        SK_CHECK( graph.GetStats().transient == 1 );
+        SK_CHECK( backend.GetCreated() == 1 );
+
+        graph.Execute();
+        SK_CHECK( executed( backend ) == std::vector< std::string >{ "Scene", "Debug", "Present" } );
+    } // test_cull
+
+    void test_sort()
+    {
+        cId_Backend backend;
+        cRender_Graph graph{ backend };
+        graph.Import( "Backbuffer", kBackbuffer );
+
+        // Added in reverse, the graph has to put them back in order.
+        add_pass( graph, backend, "Present", []( cRender_Graph::cBuilder& _builder )
+        {
+            _builder.Read( "Lit" );
+            _builder.Write( "Backbuffer" );
+        } );
+        add_pass( graph, backend, "Light", []( cRender_Graph::cBuilder& _builder )
+        {
+            _builder.Read( "Albedo" );
+            _builder.Read( "Depth" );
+            _builder.Create( "Lit", kColor );
+        } );
+        add_pass( graph, backend, "Depth", []( cRender_Graph::cBuilder& _builder ){ _builder.Create( "Depth", kDepth ); } );
+        add_pass( graph, backend, "GBuffer", []( cRender_Graph::cBuilder& _builder )
+        {
+            _builder.Create( "Albedo", kColor );
+            _builder.Write( "Depth" );
+        } );
+
+        SK_CHECK( graph.Compile() );
+        // Depth is created before the GBuffer writes to it, which has to happen before the light pass reads it.
+        SK_CHECK( graph.GetOrder() == std::vector< size_t >{ 2, 3, 1, 0 } );
+
+        graph.Execute();
+        SK_CHECK( executed( backend ) == std::vector< std::string >{ "Depth", "GBuffer", "Light", "Present" } );
+    } // test_sort
+
+    void test_write_after_read()
+    {
+        cId_Backend backend;
+        cRender_Graph graph{ backend };
+        graph.Import( "Backbuffer", kBackbuffer );
+
+        add_pass( graph, backend, "Create", []( cRender_Graph::cBuilder& _builder ){ _builder.Create( "History", kColor ); } );
+        add_pass( graph, backend, "Read",   []( cRender_Graph::cBuilder& _builder )
+        {
+            _builder.Read( "History" );
+            _builder.Write( "Backbuffer" );
+        } );
+        add_pass( graph, backend, "Overwrite", []( cRender_Graph::cBuilder& _builder )
+        {
+            _builder.Write( "History" );
+            _builder.SetSideEffect();
+        } );
+
+        SK_CHECK( graph.Compile() );
+        // The reader sees the write added before it, so the write after has to wait for it.
+        SK_CHECK( graph.GetOrder() == std::vector< size_t >{ 0, 1, 2 } );
+    } // test_write_after_read
+
+    void test_invalid()
+    {
+        cId_Backend backend;
+        cRender_Graph graph{ backend };
+        graph.Import( "Backbuffer", kBackbuffer );
+
+        add_pass( graph, backend, "A", []( cRender_Graph::cBuilder& _builder )
+        {
+            _builder.Read( "B" );
+            _builder.Create( "A", kColor );
+        } );
+        add_pass( graph, backend, "B", []( cRender_Graph::cBuilder& _builder )
+        {
+            _builder.Read( "A" );
+            _builder.Create( "B", kColor );
+        } );
+        add_pass( graph, backend, "Present", []( cRender_Graph::cBuilder& _builder )
+        {
+            _builder.Read( "A" );
+            _builder.Read( "B" );
+            _builder.Write( "Backbuffer" );
+        } );
+
+        SK_CHECK( !graph.Compile() );
+        SK_CHECK( !graph.IsCompiled() );
+
+        // Nothing runs from a graph which failed to compile.
+        graph.Execute();
+        SK_CHECK( backend.GetEvents().empty() );
+
+        cRender_Graph missing{ backend };
+        add_pass( missing, backend, "Read", []( cRender_Graph::cBuilder& _builder )
+        {
+            _builder.Read( "Never Created" );
+            _builder.SetSideEffect();
+        } );
+
+        SK_CHECK( !missing.Compile() );
+    } // test_invalid
+
+    // Each pass reads what the one before created, so every texture is done with two passes after it's created.
+    void add_chain( cRender_Graph& _graph, cId_Backend& _backend, const sGraph_Texture& _second )
+    {
+        add_pass( _graph, _backend, "0", []( cRender_Graph::cBuilder& _builder ){ _builder.Create( "T0", kColor ); } );
+        add_pass( _graph, _backend, "1", [ _second ]( cRender_Graph::cBuilder& _builder )
+        {
+            _builder.Read( "T0" );
+            _builder.Create( "T1", _second );
+        } );
+        add_pass( _graph, _backend, "2", []( cRender_Graph::cBuilder& _builder )
+        {
+            _builder.Read( "T1" );
+            _builder.Create( "T2", kColor );
+        } );
+        add_pass( _graph, _backend, "3", []( cRender_Graph::cBuilder& _builder )
+        {
+            _builder.Read( "T2" );
+            _builder.Write( "Backbuffer" );
+        } );
+    } // add_chain
+
+    void test_aliasing()
+    {
+        cId_Backend backend;
+        {
+            cRender_Graph graph{ backend };
+            graph.Import( "Backbuffer", kBackbuffer );
+            add_chain( graph, backend, kColor );
+
+            SK_CHECK( graph.Compile() );
+
+            const auto t0 = graph.GetTexture( graph.GetResource( "T0" ) );
+            const auto t1 = graph.GetTexture( graph.GetResource( "T1" ) );
+            const auto t2 = graph.GetTexture( graph.GetResource( "T2" ) );
+
+            // T0 is done with by the time T2 is created.
+            SK_CHECK( t0 == t2 );
+            SK_CHECK( t0 != t1 );
+            SK_CHECK( graph.GetTexture( graph.GetResource( "Backbuffer" ) ) == kBackbuffer );
+
+            const auto& stats = graph.GetStats();
+            SK_CHECK( stats.transient == 3 );
+            SK_CHECK( stats.physical == 2 );
+            SK_CHECK( stats.physical_bytes * 3 == stats.transient_bytes * 2 );
+            SK_CHECK( backend.GetCreated() == 2 );
+
+            // Recompiling with the same descriptions takes the textures back from the pool.
+            SK_CHECK( graph.Compile() );
+            SK_CHECK( backend.GetCreated() == 2 );
+            SK_CHECK( backend.GetLive().size() == 2 );
+        }
+
+        SK_CHECK( backend.GetLive().empty() );
+
+        // Textures of another kind never share.
+        cRender_Graph graph{ backend };
+        graph.Import( "Backbuffer", kBackbuffer );
+        add_chain( graph, backend, kDepth );
+
+        SK_CHECK( graph.Compile() );
+        SK_CHECK( graph.GetStats().physical == 2 );
+        SK_CHECK( graph.GetTexture( graph.GetResource( "T0" ) ) == graph.GetTexture( graph.GetResource( "T2" ) ) );
+    } // test_aliasing
+
+    void test_barriers()
+    {
+        using enum eGraph_Access;
+        using sEvent = cId_Backend::sEvent;
+
+        cId_Backend backend;
+        cRender_Graph graph{ backend };
+        graph.Import( "Backbuffer", kBackbuffer );
+        add_chain( graph, backend, kColor );
+
+        SK_CHECK( graph.Compile() );
+        graph.Execute();
+
+        const auto t0 = graph.GetTexture( graph.GetResource( "T0" ) );
+        const auto t1 = graph.GetTexture( graph.GetResource( "T1" ) );
+
+        // Barriers come right before the pass which changes the access, first uses don't need one.
+        // T2 takes over the texture of T0, so writing it has to wait for the read before.
+        const auto expected = std::vector< sEvent >{
+            { .pass = "0" },
+            { .texture = t0, .from = kWrite, .to = kRead },
+            { .pass = "1" },
+            { .texture = t1, .from = kWrite, .to = kRead },
+            { .texture = t0, .from = kRead, .to = kWrite },
+            { .pass = "2" },
+            { .texture = t0, .from = kWrite, .to = kRead },
+            { .pass = "3" },
+        };
+
+        SK_CHECK( backend.GetEvents() == expected );
+        SK_CHECK( graph.GetStats().barriers == 4 );
+
+        // The same barriers every frame.
+        backend.ClearEvents();
+        graph.Execute();
+        SK_CHECK( backend.GetEvents() == expected );
+    } // test_barriers
+} // ::
+
+int main()
+{
+    sk::Testing::IgnoreBreaks();
+
+    sk::Testing::Run( "Cull",              &test_cull );
+    sk::Testing::Run( "Sort",              &test_sort );
+    sk::Testing::Run( "Write after read",  &test_write_after_read );
+    sk::Testing::Run( "Invalid graphs",    &test_invalid );
+    sk::Testing::Run( "Aliasing",          &test_aliasing );
+    sk::Testing::Run( "Barriers",          &test_barriers );
+
+    return sk::Testing::Finish();
+}
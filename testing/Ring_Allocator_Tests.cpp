@@ -0,0 +1,207 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Test.h"
+
+#include <sk/Graphics/Buffer/Ring_Allocator.h>
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+using namespace sk::Graphics;
+
+namespace
+{
+    // Fences which are passed as soon as they're waited on, keeping track of what's still in flight.
+    struct sFake_Fences
+    {
+        struct sAllocation
+        {
+            size_t offset;
+            size_t size;
+        };
+
+        cRing_Allocator::fence_t next = 1;
+        std::vector< cRing_Allocator::fence_t > waited;
+
+        // The allocations of the frame being recorded, and of every frame which hasn't been waited on.
+        std::vector< sAllocation > current;
+        std::map< cRing_Allocator::fence_t, std::vector< sAllocation > > in_flight;
+
+        auto Get() -> cRing_Allocator::sFences
+        {
+            return {
+                .insert = [ this ]
+                {
+                    in_flight[ next ] = std::move( current );
+                    current.clear();
+                    return next++;
+                },
+                .wait = [ this ]( const cRing_Allocator::fence_t _fence )
+                {
+                    waited.push_back( _fence );
+                    in_flight.erase( _fence );
+                }
+            };
+        } // Get
+
+        // True if the allocation doesn't overlap anything the gpu could still be reading.
+        bool IsFree( const size_t _offset, const size_t _size ) const
+        {
+            const auto overlaps = [ & ]( const sAllocation& _other )
+            {
+                return _offset < _other.offset + _other.size && _other.offset < _offset + _size;
+            };
+
+            if( std::ranges::any_of( current, overlaps ) )
+                return false;
+
+            for( const auto& allocations : in_flight )
+            {
+                if( std::ranges::any_of( allocations.second, overlaps ) )
+                    return false;
+            }
+
+            return true;
+        } // IsFree
+    };
+
+    void test_alignment()
+    {
+        sFake_Fences fences;
+        cRing_Allocator ring{ 256, 16, fences.Get() };
+
+        SK_CHECK( ring.Allocate( 10 ) == 0 );
+        SK_CHECK( ring.Allocate( 10 ) == 16 );
+        SK_CHECK( ring.Allocate( 16 ) == 32 );
+        SK_CHECK( ring.GetUsed() == 48 );
+    } // test_alignment
+
+    void test_wraparound()
+    {
+        sFake_Fences fences;
+        cRing_Allocator ring{ 256, 16, fences.Get() };
+
+        SK_CHECK( ring.Allocate( 96 ) == 0 );
+        SK_CHECK( ring.Allocate( 96 ) == 96 );
+        ring.EndFrame();
+
+        // Only 64 bytes are left at the end, so the allocation starts over at the front once the first frame is done with it.
+        SK_CHECK( ring.Allocate( 96 ) == 0 );
+        SK_CHECK( fences.waited == std::vector< cRing_Allocator::fence_t >{ 1 } );
+        SK_CHECK( ring.GetWaitCount() == 1 );
+        SK_CHECK( ring.GetFrameCount() == 0 );
+        // The skipped end is counted until the frame which skipped it is done.
+        SK_CHECK( ring.GetUsed() == 64 + 96 );
+
+        SK_CHECK( ring.Allocate( 32 ) == 96 );
+        SK_CHECK( ring.GetWaitCount() == 1 );
+
+        ring.EndFrame();
+        SK_CHECK( ring.GetUsed() == 64 + 96 + 32 );
+
+        // Exactly fills the free space, without waiting.
+        SK_CHECK( ring.Allocate( 64 ) == 128 );
+        SK_CHECK( ring.GetWaitCount() == 1 );
+    } // test_wraparound
+
+    void test_fence_waits()
+    {
+        sFake_Fences fences;
+        cRing_Allocator ring{ 1024, 16, fences.Get() };
+
+        const size_t sizes[] = { 100, 36, 250, 16, 180, 64, 300 };
+
+        size_t allocations = 0;
+        for( size_t frame = 0; frame < 200; frame++ )
+        {
+            for( size_t i = 0; i < 3; i++ )
+            {
+                const auto size   = sizes[ ( frame * 3 + i ) % std::size( sizes ) ];
+                const auto offset = ring.Allocate( size );
+
+                SK_CHECK( offset != cRing_Allocator::kInvalid );
+                SK_CHECK( offset % ring.GetAlignment() == 0 );
+                SK_CHECK( offset + size <= ring.GetCapacity() );
+                SK_CHECK( fences.IsFree( offset, size ) );
+                SK_CHECK( ring.GetUsed() <= ring.GetCapacity() );
+
+                fences.current.push_back( { offset, size } );
+                allocations++;
+            }
+
+            ring.EndFrame();
+        }
+
+        // Fences are waited on oldest first, and only when the ring is full.
+        SK_CHECK( std::ranges::is_sorted( fences.waited ) );
+        SK_CHECK( std::ranges::adjacent_find( fences.waited ) == fences.waited.end() );
+        SK_CHECK( !fences.waited.empty() && fences.waited.size() < allocations );
+        SK_CHECK( ring.GetWaitCount() == fences.waited.size() );
+        SK_CHECK( ring.GetFrameCount() + fences.waited.size() == 200 );
+    } // test_fence_waits
+
+    void test_empty_frames()
+    {
+        sFake_Fences fences;
+        cRing_Allocator ring{ 256, 16, fences.Get() };
+
+        ring.EndFrame();
+        ring.EndFrame();
+
+        SK_CHECK( ring.GetFrameIndex() == 2 );
+        SK_CHECK( ring.GetFrameCount() == 0 );
+        SK_CHECK( fences.next == 1 );
+    } // test_empty_frames
+
+    void test_oversized_frame()
+    {
+        sFake_Fences fences;
+        cRing_Allocator ring{ 256, 16, fences.Get() };
+
+        ring.Allocate( 128 );
+        ring.EndFrame();
+
+        SK_CHECK( ring.Allocate( 128 ) == 128 );
+        // The frame would need more than the whole ring, which fails without waiting on the frame in flight.
+        SK_CHECK( ring.Allocate( 160 ) == cRing_Allocator::kInvalid );
+        SK_CHECK( fences.waited.empty() );
+        SK_CHECK( ring.GetUsed() == 256 );
+    } // test_oversized_frame
+
+    void test_destruction()
+    {
+        sFake_Fences fences;
+        {
+            cRing_Allocator ring{ 1024, 16, fences.Get() };
+            for( size_t i = 0; i < 3; i++ )
+            {
+                ring.Allocate( 128 );
+                ring.EndFrame();
+            }
+
+            ring.Allocate( 128 );
+        }
+
+        // The frame being recorded was never fenced, so only the ones in flight are waited on.
+        SK_CHECK( fences.waited == std::vector< cRing_Allocator::fence_t >{ 1, 2, 3 } );
+    } // test_destruction
+} // ::
+
+int main()
+{
+    sk::Testing::IgnoreBreaks();
+
+    sk::Testing::Run( "Alignment",       &test_alignment );
+    sk::Testing::Run( "Wraparound",      &test_wraparound );
+    sk::Testing::Run( "Fence waits",     &test_fence_waits );
+    sk::Testing::Run( "Empty frames",    &test_empty_frames );
+    sk::Testing::Run( "Oversized frame", &test_oversized_frame );
+    sk::Testing::Run( "Destruction",     &test_destruction );
+
+    return sk::Testing::Finish();
+}
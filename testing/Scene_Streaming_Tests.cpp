@@ -0,0 +1,223 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Test.h"
+
+#include <sk/Assets/Management/Asset_Job_Manager.h>
+#include <sk/Math/Transform_Hierarchy.h>
+#include <sk/Scene/Scene.h>
+#include <sk/Scene/Components/SpinComponent.h>
+#include <sk/Scene/Managers/EventManager.h>
+#include <sk/Scene/Managers/Internal_Component_Manager.h>
+#include <sk/Scene/Managers/Layer_Manager.h>
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using eState = sk::Scene::cChunk::eState;
+
+namespace
+{
+    constexpr size_t kObjects = 16;
+    // Updates to wait for something that should take a handful of them.
+    constexpr size_t kMaxUpdates = 1'000;
+
+    const sk::cVector3f kInside { 5.0f, 5.0f, 5.0f };
+    const sk::cVector3f kOutside{ 1'000.0f, 0.0f, 0.0f };
+
+    // Smaller than a single commit, so every update runs over it.
+    constexpr sk::cScene::sStreaming_Settings kTinyBudget{
+        .chunk_size      = 10.0f,
+        .load_distance   = 5.0f,
+        .unload_distance = 20.0f,
+        .frame_budget    = 0.0f,
+    };
+
+    // What a chunk built, so the test can tell whether anything is still holding on to it.
+    struct sBuilt
+    {
+        std::mutex                                          mutex;
+        std::vector< sk::cWeak_Ptr< sk::Object::iObject > > objects;
+
+        auto GetAlive()
+        {
+            std::scoped_lock lock( mutex );
+            return static_cast< size_t >( std::ranges::count_if( objects, []( const auto& _object ){ return _object.is_valid(); } ) );
+        } // GetAlive
+    };
+
+    auto add_chunk( sk::cScene& _scene, sBuilt& _built )
+    {
+        return _scene.AddChunk( { 0, 0, 0 }, [ &_built ]( sk::Scene::cChunk& _chunk )
+        {
+            for( size_t i = 0; i < kObjects; i++ )
+            {
+                auto object = _chunk.Instantiate( "Chunk Object" );
+                object->AddComponent< sk::Object::Components::cSpinComponent >();
+
+                std::scoped_lock lock( _built.mutex );
+                _built.objects.emplace_back( object );
+            }
+        } );
+    } // add_chunk
+
+    void move_source( sk::Object::iObject& _source, const sk::cVector3f& _position )
+    {
+        _source.GetTransform().SetPosition( _position );
+        _source.GetTransform().Update();
+        sk::cTransform_Hierarchy::get().Update();
+    } // move_source
+
+    // The chunk is built on an asset worker, the scene only sees it once it's staged.
+    bool wait_until_staged( const sk::Scene::cChunk& _chunk )
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds( 10 );
+        while( _chunk.GetState() == eState::kLoading )
+        {
+            if( std::chrono::steady_clock::now() > deadline )
+                return false;
+            std::this_thread::yield();
+        }
+        return _chunk.GetState() == eState::kStaged;
+    } // wait_until_staged
+} // ::
+
+int main()
+{
+    sk::cEventManager::init();
+    sk::cTransform_Hierarchy::init();
+    sk::Scene::cLayer_Manager::init();
+    sk::Scene::cInternal_Component_Manager::init();
+    sk::Assets::Jobs::cAsset_Job_Manager::init();
+
+    sk::Testing::Run( "Chunks commit a slice every update within a tiny budget", []
+    {
+        auto scene  = sk::make_shared< sk::cScene >();
+        auto source = sk::make_pooled< sk::Object::iObject >( "Source" );
+        move_source( *source, kInside );
+
+        scene->SetStreamingSettings( kTinyBudget );
+        scene->AddStreamingSource( source );
+
+        sBuilt built;
+        const auto chunk = add_chunk( *scene, built );
+        SK_CHECK( chunk->GetState() == eState::kUnloaded );
+
+        scene->force_update();
+        SK_CHECK( chunk->GetState() == eState::kLoading || chunk->GetState() == eState::kStaged );
+        SK_CHECK( scene->GetStreamingStats().loading_chunks == 1 );
+
+        SK_CHECK( wait_until_staged( *chunk ) );
+        SK_CHECK( built.GetAlive() == kObjects );
+
+        // Only a single object fits in the budget, so the chunk stays committing until all of them are in.
+        for( size_t i = 1; i <= kObjects; i++ )
+        {
+            scene->force_update();
+            SK_CHECK( chunk->GetState() == eState::kCommitting );
+            SK_CHECK( scene->GetStreamingStats().committed == i );
+            SK_CHECK( chunk->GetObjects().size() == i );
+        }
+
+        scene->force_update();
+        SK_CHECK( chunk->GetState() == eState::kLoaded );
+        SK_CHECK( scene->GetStreamingStats().committed == kObjects );
+        SK_CHECK( scene->GetStreamingStats().over_budget >= kObjects );
+
+        scene->force_update();
+        SK_CHECK( scene->GetStreamingStats().loaded_chunks == 1 );
+        SK_CHECK( scene->GetStreamingStats().loading_chunks == 0 );
+        SK_CHECK( built.GetAlive() == kObjects );
+    } );
+
+    sk::Testing::Run( "A large enough budget commits the chunk in a single update", []
+    {
+        auto scene  = sk::make_shared< sk::cScene >();
+        auto source = sk::make_pooled< sk::Object::iObject >( "Source" );
+        move_source( *source, kInside );
+
+        auto settings = kTinyBudget;
+        settings.frame_budget = 10'000.0f;
+        scene->SetStreamingSettings( settings );
+        scene->AddStreamingSource( source );
+
+        sBuilt built;
+        const auto chunk = add_chunk( *scene, built );
+
+        scene->force_update();
+        SK_CHECK( wait_until_staged( *chunk ) );
+
+        scene->force_update();
+        SK_CHECK( chunk->GetState() == eState::kLoaded );
+        SK_CHECK( scene->GetStreamingStats().committed == kObjects );
+        SK_CHECK( scene->GetStreamingStats().over_budget == 0 );
+    } );
+
+    sk::Testing::Run( "Unloading a committing chunk leaves no orphans", []
+    {
+        auto scene  = sk::make_shared< sk::cScene >();
+        auto source = sk::make_pooled< sk::Object::iObject >( "Source" );
+        move_source( *source, kInside );
+
+        scene->SetStreamingSettings( kTinyBudget );
+        scene->AddStreamingSource( source );
+
+        sBuilt built;
+        const auto chunk = add_chunk( *scene, built );
+
+        scene->force_update();
+        SK_CHECK( wait_until_staged( *chunk ) );
+
+        // Part of the chunk is in the scene, the rest is still staged.
+        constexpr size_t kCommitted = kObjects / 4;
+        for( size_t i = 0; i < kCommitted; i++ )
+            scene->force_update();
+        SK_CHECK( chunk->GetState() == eState::kCommitting );
+        SK_CHECK( scene->GetStreamingStats().committed == kCommitted );
+
+        move_source( *source, kOutside );
+        scene->force_update();
+        SK_CHECK( chunk->GetState() == eState::kUnloaded );
+        SK_CHECK( chunk->GetObjects().empty() );
+
+        // Committed and staged objects alike are removed one at a time.
+        for( size_t i = 0; i < kMaxUpdates && scene->GetStreamingStats().removed < kObjects; i++ )
+            scene->force_update();
+        SK_CHECK( scene->GetStreamingStats().removed == kObjects );
+
+        // Nothing is left to commit, the chunk would be marked as loaded again if it were still queued.
+        for( size_t i = 0; i < kObjects; i++ )
+            scene->force_update();
+        SK_CHECK( chunk->GetState() == eState::kUnloaded );
+        SK_CHECK( scene->GetStreamingStats().committed == kCommitted );
+        SK_CHECK( scene->GetStreamingStats().loading_chunks == 0 );
+        SK_CHECK( scene->GetStreamingStats().loaded_chunks == 0 );
+
+        // Neither the scene, the chunk nor the queues hold on to any of the objects.
+        SK_CHECK( built.GetAlive() == 0 );
+
+        // And it loads from scratch when the source comes back.
+        move_source( *source, kInside );
+        scene->force_update();
+        SK_CHECK( wait_until_staged( *chunk ) );
+        for( size_t i = 0; i < kMaxUpdates && chunk->GetState() != eState::kLoaded; i++ )
+            scene->force_update();
+        SK_CHECK( chunk->GetState() == eState::kLoaded );
+        SK_CHECK( chunk->GetObjects().size() == kObjects );
+        SK_CHECK( built.GetAlive() == kObjects );
+    } );
+
+    sk::Assets::Jobs::cAsset_Job_Manager::shutdown();
+    sk::Scene::cInternal_Component_Manager::shutdown();
+    sk::Scene::cLayer_Manager::shutdown();
+    sk::cTransform_Hierarchy::shutdown();
+    sk::cEventManager::shutdown();
+
+    return sk::Testing::Finish();
+}
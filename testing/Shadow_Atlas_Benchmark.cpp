@@ -0,0 +1,85 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Test.h"
+
+#include <sk/Graphics/Utils/Shadow_Atlas.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace sk::Graphics::Utils;
+
+// 1k casters in an 8k atlas. The importance of every caster jitters each frame, and 2% of the casters are swapped for new ones.
+int main()
+{
+    constexpr size_t kCasters = 1000;
+    constexpr size_t kFrames  = 500;
+    constexpr size_t kChurn   = 20;
+
+    cShadow_Atlas atlas{ 8192, 64, 2048 };
+
+    std::mt19937 random{ 1 };
+    // Most casters are small on screen. Scaled so the atlas is close to full, which makes it downsize and repack now and then.
+    const auto make_importance = [ & ]{ return 0.35f * std::pow( std::uniform_real_distribution( 0.0f, 1.0f )( random ), 3.0f ); };
+
+    struct sCaster
+    {
+        sk::cUUID id;
+        float     importance;
+    };
+
+    uint64_t next = 1;
+    std::vector< sCaster > casters;
+    for( size_t i = 0; i < kCasters; i++ )
+        casters.push_back( { sk::cUUID{ next++, 0 }, make_importance() } );
+
+    double total = 0.0, worst = 0.0;
+    size_t repacks = 0, moved = 0, allocated = 0, downsized = 0, failed = 0;
+    double density = 0.0;
+
+    for( size_t frame = 0; frame < kFrames; frame++ )
+    {
+        for( size_t i = 0; i < kChurn; i++ )
+            casters[ ( frame * kChurn + i ) % kCasters ] = { sk::cUUID{ next++, 0 }, make_importance() };
+
+        const auto start = std::chrono::steady_clock::now();
+
+        atlas.Begin();
+        for( const auto& caster : casters )
+            atlas.Request( caster.id, caster.importance * std::uniform_real_distribution( 0.9f, 1.1f )( random ) );
+        atlas.End();
+
+        const auto elapsed = std::chrono::duration< double, std::milli >( std::chrono::steady_clock::now() - start ).count();
+
+        // The first frame fills an empty atlas, which isn't what the rest of them do.
+        if( frame == 0 )
+            continue;
+
+        const auto& stats = atlas.GetStats();
+        total     += elapsed;
+        worst      = std::max( worst, elapsed );
+        repacks   += stats.repacked;
+        moved     += stats.moved;
+        allocated += stats.allocated;
+        downsized += stats.downsized;
+        failed    += stats.failed;
+        density   += static_cast< double >( stats.used_area ) / ( static_cast< double >( atlas.GetSize() ) * atlas.GetSize() );
+    }
+
+    const auto frames = static_cast< double >( kFrames - 1 );
+    std::println( "Shadow atlas, {} casters in {}x{}, {} new every frame", kCasters, atlas.GetSize(), atlas.GetSize(), kChurn );
+    std::println( "Frame:      {:.4f} ms on average, {:.4f} ms at most", total / frames, worst );
+    std::println( "Used area:  {:.1f}%", density / frames * 100.0 );
+    std::println( "Per frame:  {:.1f} allocated, {:.1f} moved, {:.1f} downsized, {:.1f} failed",
+        allocated / frames, moved / frames, downsized / frames, failed / frames );
+    std::println( "Repacks:    {} in {} frames", repacks, kFrames - 1 );
+
+    return 0;
+}
@@ -0,0 +1,240 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Test.h"
+
+#include <sk/Graphics/Utils/Shadow_Atlas.h>
+
+#include <map>
+#include <random>
+#include <ranges>
+#include <vector>
+
+using namespace sk::Graphics::Utils;
+
+namespace
+{
+    using tiles_t = std::map< uint64_t, cShadow_Atlas::sTile >;
+
+    auto caster( const uint64_t _id ){ return sk::cUUID{ _id, 0 }; }
+
+    // Requests a tile for every caster and returns what they got.
+    auto run_frame( cShadow_Atlas& _atlas, const std::map< uint64_t, float >& _importance ) -> tiles_t
+    {
+        _atlas.Begin();
+        for( const auto& [ id, importance ] : _importance )
+            _atlas.Request( caster( id ), importance );
+        _atlas.End();
+
+        tiles_t tiles;
+        for( const auto& id : _importance | std::views::keys )
+            tiles[ id ] = _atlas.GetTile( caster( id ) );
+
+        return tiles;
+    } // run_frame
+
+    // Every tile has to be inside the atlas and not overlap any other, and the stats have to agree with them.
+    void check_tiles( const cShadow_Atlas& _atlas, const tiles_t& _tiles )
+    {
+        uint64_t area = 0;
+        for( auto first = _tiles.begin(); first != _tiles.end(); ++first )
+        {
+            const auto& a = first->second;
+            if( !a.IsValid() )
+                continue;
+
+            area += static_cast< uint64_t >( a.size ) * a.size;
+
+            SK_CHECK( a.x % a.size == 0 && a.y % a.size == 0 );
+            SK_CHECK( a.x + a.size <= _atlas.GetSize() && a.y + a.size <= _atlas.GetSize() );
+
+            for( auto second = std::next( first ); second != _tiles.end(); ++second )
+            {
+                const auto& b = second->second;
+                const bool overlaps = b.IsValid() && a.x < b.x + b.size && b.x < a.x + a.size && a.y < b.y + b.size && b.y < a.y + a.size;
+                SK_CHECK( !overlaps );
+            }
+        }
+
+        SK_CHECK( area == _atlas.GetStats().used_area );
+    } // check_tiles
+
+    void test_pick_size()
+    {
+        const cShadow_Atlas atlas{ 4096, 64, 1024 };
+
+        SK_CHECK( atlas.PickSize( 2.0f ) == 1024 );
+        SK_CHECK( atlas.PickSize( 1.0f ) == 1024 );
+        SK_CHECK( atlas.PickSize( 0.5f ) == 512 );
+        SK_CHECK( atlas.PickSize( 0.25f ) == 256 );
+        SK_CHECK( atlas.PickSize( 0.0f ) == 64 );
+        SK_CHECK( atlas.PickSize( 0.0001f ) == 64 );
+
+        // The current size is kept until the importance is well past it.
+        SK_CHECK( atlas.PickSize( 0.7f, 512 ) == 512 );
+        SK_CHECK( atlas.PickSize( 0.3f, 512 ) == 512 );
+        SK_CHECK( atlas.PickSize( 0.9f, 512 ) == 1024 );
+        SK_CHECK( atlas.PickSize( 0.2f, 512 ) == 256 );
+    } // test_pick_size
+
+    void test_density()
+    {
+        cShadow_Atlas atlas{ 4096, 64, 1024 };
+
+        // Sixteen of the largest tiles fill the atlas exactly.
+        std::map< uint64_t, float > importance;
+        for( uint64_t i = 0; i < 16; i++ )
+            importance[ i ] = 1.0f;
+
+        auto tiles = run_frame( atlas, importance );
+        check_tiles( atlas, tiles );
+        SK_CHECK( atlas.GetStats().failed == 0 );
+        SK_CHECK( atlas.GetStats().downsized == 0 );
+        SK_CHECK( atlas.GetStats().used_area == 4096ull * 4096 );
+
+        // Swapping every other large tile for 16 small ones fragments the atlas, which still has to be filled exactly.
+        for( uint64_t i = 0; i < 16; i += 2 )
+        {
+            importance.erase( i );
+            for( uint64_t j = 0; j < 16; j++ )
+                importance[ 100 + i * 16 + j ] = 0.25f;
+        }
+
+        tiles = run_frame( atlas, importance );
+        check_tiles( atlas, tiles );
+        SK_CHECK( atlas.GetStats().failed == 0 );
+        SK_CHECK( atlas.GetStats().downsized == 0 );
+        SK_CHECK( atlas.GetStats().used_area == 4096ull * 4096 );
+
+        // Random sizes whose area fits are all placed at the size they asked for.
+        std::mt19937 random{ 1 };
+        for( size_t frame = 0; frame < 20; frame++ )
+        {
+            cShadow_Atlas fresh{ 4096, 64, 1024 };
+
+            importance.clear();
+            uint64_t area = 0;
+            for( uint64_t id = 0; ; id++ )
+            {
+                const auto value = std::uniform_real_distribution( 0.01f, 1.0f )( random );
+                const auto size  = static_cast< uint64_t >( fresh.PickSize( value ) );
+                if( area + size * size > 4096ull * 4096 )
+                    break;
+
+                area += size * size;
+                importance[ id ] = value;
+            }
+
+            tiles = run_frame( fresh, importance );
+            check_tiles( fresh, tiles );
+            SK_CHECK( fresh.GetStats().failed == 0 );
+            SK_CHECK( fresh.GetStats().downsized == 0 );
+            SK_CHECK( fresh.GetStats().used_area == area );
+        }
+    } // test_density
+
+    void test_overflow()
+    {
+        cShadow_Atlas atlas{ 4096, 64, 1024 };
+
+        // Twice what fits at the largest size, the largest size is halved instead of some casters missing out.
+        std::map< uint64_t, float > importance;
+        for( uint64_t i = 0; i < 32; i++ )
+            importance[ i ] = 1.0f;
+        importance[ 100 ] = 0.1f;
+
+        const auto tiles = run_frame( atlas, importance );
+        check_tiles( atlas, tiles );
+
+        const auto& stats = atlas.GetStats();
+        SK_CHECK( stats.max_tile == 512 );
+        SK_CHECK( stats.failed == 0 );
+        SK_CHECK( stats.downsized == 32 );
+        // The small caster keeps its size.
+        SK_CHECK( tiles.at( 100 ).size == 128 );
+
+        // Far more than fits even at the smallest size, whatever doesn't fit fails without breaking the rest.
+        cShadow_Atlas small{ 256, 64, 64 };
+        importance.clear();
+        for( uint64_t i = 0; i < 20; i++ )
+            importance[ i ] = 1.0f;
+
+        const auto small_tiles = run_frame( small, importance );
+        check_tiles( small, small_tiles );
+        SK_CHECK( small.GetStats().failed == 4 );
+        SK_CHECK( small.GetStats().used_area == 256ull * 256 );
+    } // test_overflow
+
+    void test_stability()
+    {
+        cShadow_Atlas atlas{ 4096, 64, 1024 };
+
+        std::mt19937 random{ 2 };
+        std::map< uint64_t, float > importance;
+        for( uint64_t i = 0; i < 40; i++ )
+            importance[ i ] = std::uniform_real_distribution( 0.05f, 0.6f )( random );
+
+        const auto first = run_frame( atlas, importance );
+
+        // Nothing moves while the casters keep asking for the same thing, even with their importance jittering a little.
+        for( size_t frame = 0; frame < 10; frame++ )
+        {
+            auto jittered = importance;
+            for( auto& value : jittered | std::views::values )
+                value *= std::uniform_real_distribution( 0.9f, 1.1f )( random );
+
+            const auto tiles = run_frame( atlas, jittered );
+            SK_CHECK( tiles == first );
+            SK_CHECK( atlas.GetStats().allocated == 0 );
+            SK_CHECK( atlas.GetStats().moved == 0 );
+        }
+
+        // Casters coming and going leave the tiles of the others alone, as long as there's no repack.
+        size_t next = 1000;
+        auto previous = first;
+        for( size_t frame = 0; frame < 50; frame++ )
+        {
+            importance.erase( importance.begin() );
+            importance[ next++ ] = std::uniform_real_distribution( 0.05f, 0.6f )( random );
+
+            const auto tiles = run_frame( atlas, importance );
+            check_tiles( atlas, tiles );
+
+            const auto& stats = atlas.GetStats();
+            SK_CHECK( stats.failed == 0 );
+            SK_CHECK( stats.allocated == 1 );
+
+            size_t moved = 0;
+            for( const auto& [ id, tile ] : tiles )
+            {
+                if( const auto itr = previous.find( id ); itr != previous.end() )
+                    moved += itr->second != tile;
+            }
+
+            SK_CHECK( moved == stats.moved );
+            SK_CHECK( stats.repacked || moved == 0 );
+
+            previous = tiles;
+        }
+
+        // Casters which stop asking lose their tile.
+        atlas.Begin();
+        atlas.End();
+        SK_CHECK( !atlas.GetTile( caster( next - 1 ) ).IsValid() );
+        SK_CHECK( atlas.GetStats().casters == 0 );
+        SK_CHECK( atlas.GetStats().used_area == 0 );
+    } // test_stability
+} // ::
+
+int main()
+{
+    sk::Testing::Run( "Pick size", &test_pick_size );
+    sk::Testing::Run( "Density",   &test_density );
+    sk::Testing::Run( "Overflow",  &test_overflow );
+    sk::Testing::Run( "Stability", &test_stability );
+
+    return sk::Testing::Finish();
+}
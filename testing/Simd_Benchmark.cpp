@@ -0,0 +1,105 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Test.h"
+
+#include <sk/Math/Matrix4x4.h>
+#include <sk/Math/Simd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr size_t kMatrices = 100'000;
+
+    // The plain float product, the same operations the SIMD path does.
+    void scalar_multiply( const sk::cMatrix4x4f& _a, const sk::cMatrix4x4f& _b, sk::cMatrix4x4f& _out )
+    {
+        for( size_t r = 0; r < 4; r++ )
+        {
+            const auto& a = _a[ r ];
+            for( size_t c = 0; c < 4; c++ )
+                ( &_out[ r ].x )[ c ] = a.x * ( &_b.x.x )[ c ] + a.y * ( &_b.y.x )[ c ] + a.z * ( &_b.z.x )[ c ] + a.w * ( &_b.w.x )[ c ];
+        }
+    } // scalar_multiply
+
+    auto checksum( const std::vector< sk::cMatrix4x4f >& _matrices )
+    {
+        double sum = 0.0;
+        for( const auto& matrix : _matrices )
+            sum += matrix.w.x + matrix.x.x;
+        return sum;
+    } // checksum
+} // ::
+
+// Multiplies and inverts 100k matrices with the compiled backend and plain scalar code.
+// Configure with SKAPE_SIMD_FORCE_SCALAR, or for another target, to time the other backends.
+int main()
+{
+    std::mt19937 random{ 1 };
+    std::uniform_real_distribution distribution( -1.0f, 1.0f );
+
+    std::vector< sk::cMatrix4x4f > a( kMatrices ), b( kMatrices ), out( kMatrices );
+    for( size_t i = 0; i < kMatrices; i++ )
+    {
+        // Diagonally dominant, so every one of them can be inverted.
+        const auto diagonal = [ & ]{ return 4.0f + distribution( random ); };
+        a[ i ] = { { diagonal(), distribution( random ), distribution( random ), 0.0f },
+                   { distribution( random ), diagonal(), distribution( random ), 0.0f },
+                   { distribution( random ), distribution( random ), diagonal(), 0.0f },
+                   { distribution( random ), distribution( random ), distribution( random ), 1.0f } };
+        b[ i ] = a[ ( i * 7 ) % ( i + 1 ) ];
+    }
+
+    const auto multiply_ms = sk::Testing::Measure( 20, [ & ]
+    {
+        for( size_t i = 0; i < kMatrices; i++ )
+            out[ i ] = a[ i ] * b[ i ];
+    } );
+    const auto multiply_sum = checksum( out );
+
+    const auto scalar_multiply_ms = sk::Testing::Measure( 20, [ & ]
+    {
+        for( size_t i = 0; i < kMatrices; i++ )
+            scalar_multiply( a[ i ], b[ i ], out[ i ] );
+    } );
+    const auto scalar_multiply_sum = checksum( out );
+
+    const auto inverse_ms = sk::Testing::Measure( 20, [ & ]
+    {
+        for( size_t i = 0; i < kMatrices; i++ )
+            a[ i ].inversed_affine( out[ i ] );
+    } );
+
+    const auto inverse_x4_ms = sk::Testing::Measure( 20, [ & ]
+    {
+        for( size_t i = 0; i < kMatrices; i += 4 )
+            sk::Math::Matrix4x4::inversed_affine_x4( &a[ i ], &out[ i ], std::min< size_t >( 4, kMatrices - i ) );
+    } );
+
+    const auto full_inverse_ms = sk::Testing::Measure( 5, [ & ]
+    {
+        for( size_t i = 0; i < kMatrices; i++ )
+            out[ i ] = a[ i ].inversed();
+    } );
+
+    std::println( "Simd, {} backend, {} matrices", sk::Math::Simd::kBackend, kMatrices );
+    std::println( "Multiply:         {:.3f} ms", multiply_ms );
+    std::println( "Multiply scalar:  {:.3f} ms", scalar_multiply_ms );
+    std::println( "Affine inverse:   {:.3f} ms", inverse_ms );
+    std::println( "Affine inverse x4 {:.3f} ms", inverse_x4_ms );
+    std::println( "Full inverse:     {:.3f} ms", full_inverse_ms );
+
+    // Also keeps the loops from being optimized out.
+    const bool valid = std::abs( multiply_sum - scalar_multiply_sum ) <= 1e-3 * std::abs( scalar_multiply_sum ) + 1e-3;
+    if( !valid )
+        std::println( stderr, "The SIMD and scalar products don't agree." );
+
+    return valid ? 0 : 1;
+}
@@ -0,0 +1,224 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Test.h"
+
+#include <sk/Math/Matrix4x4.h>
+#include <sk/Math/Quaternion.h>
+#include <sk/Math/Simd.h>
+
+#include <cmath>
+#include <random>
+
+using namespace sk::Math;
+
+namespace
+{
+    constexpr float kTolerance = 1e-5f;
+
+    std::mt19937 random{ 1 };
+
+    auto next( const float _min = -10.0f, const float _max = 10.0f ){ return std::uniform_real_distribution( _min, _max )( random ); }
+
+    bool near( const float _a, const float _b, const float _tolerance = kTolerance )
+    {
+        return std::abs( _a - _b ) <= _tolerance * std::max( 1.0f, std::max( std::abs( _a ), std::abs( _b ) ) );
+    } // near
+
+    bool near( const Simd::sFloat4 _value, const float ( &_expected )[ 4 ], const float _tolerance = kTolerance )
+    {
+        float values[ 4 ];
+        Simd::Store( values, _value );
+        for( int i = 0; i < 4; i++ )
+        {
+            if( !near( values[ i ], _expected[ i ], _tolerance ) )
+                return false;
+        }
+        return true;
+    } // near
+
+    bool near( const sk::cMatrix4x4f& _a, const sk::cMatrix4x4f& _b, const float _tolerance = kTolerance )
+    {
+        for( size_t r = 0; r < 4; r++ )
+        {
+            for( size_t c = 0; c < 4; c++ )
+            {
+                if( !near( ( &_a[ r ].x )[ c ], ( &_b[ r ].x )[ c ], _tolerance ) )
+                    return false;
+            }
+        }
+        return true;
+    } // near
+
+    // Row vector product in doubles, written out so it can't take any of the SIMD paths.
+    auto reference_multiply( const sk::cMatrix4x4f& _a, const sk::cMatrix4x4f& _b ) -> sk::cMatrix4x4f
+    {
+        sk::cMatrix4x4f result;
+        for( size_t r = 0; r < 4; r++ )
+        {
+            for( size_t c = 0; c < 4; c++ )
+            {
+                double sum = 0.0;
+                for( size_t k = 0; k < 4; k++ )
+                    sum += static_cast< double >( ( &_a[ r ].x )[ k ] ) * ( &_b[ k ].x )[ c ];
+                ( &result[ r ].x )[ c ] = static_cast< float >( sum );
+            }
+        }
+        return result;
+    } // reference_multiply
+
+    auto make_matrix() -> sk::cMatrix4x4f
+    {
+        return { { next(), next(), next(), next() }, { next(), next(), next(), next() }, { next(), next(), next(), next() }, { next(), next(), next(), next() } };
+    } // make_matrix
+
+    // Scale, rotation and translation, so the matrix is affine and well conditioned.
+    auto make_affine() -> sk::cMatrix4x4f
+    {
+        auto rotation = sk::cQuaternionf( next(), next(), next(), next() ).Normalized();
+        const auto scale = next( 0.5f, 2.0f );
+        const sk::cVector3f x = rotation.Rotate( sk::cVector3f( scale, 0.0f, 0.0f ) );
+        const sk::cVector3f y = rotation.Rotate( sk::cVector3f( 0.0f, scale, 0.0f ) );
+        const sk::cVector3f z = rotation.Rotate( sk::cVector3f( 0.0f, 0.0f, scale ) );
+        return { sk::cVector4f( x, 0.0f ), sk::cVector4f( y, 0.0f ), sk::cVector4f( z, 0.0f ), sk::cVector4f( next(), next(), next(), 1.0f ) };
+    } // make_affine
+
+    void test_operations()
+    {
+        for( size_t i = 0; i < 1000; i++ )
+        {
+            const float a[ 4 ] = { next(), next(), next(), next() };
+            const float b[ 4 ] = { next(), next(), next(), next() };
+            const float c[ 4 ] = { next(), next(), next(), next() };
+            const auto va = Simd::Load( a ), vb = Simd::Load( b ), vc = Simd::Load( c );
+
+            float expected[ 4 ];
+            const auto each = [ & ]( auto _fn ){ for( int l = 0; l < 4; l++ ) expected[ l ] = _fn( l ); };
+
+            each( [ & ]( const int _l ){ return a[ _l ] + b[ _l ]; } );
+            SK_CHECK( near( Simd::Add( va, vb ), expected ) );
+            each( [ & ]( const int _l ){ return a[ _l ] - b[ _l ]; } );
+            SK_CHECK( near( Simd::Sub( va, vb ), expected ) );
+            each( [ & ]( const int _l ){ return a[ _l ] * b[ _l ]; } );
+            SK_CHECK( near( Simd::Mul( va, vb ), expected ) );
+            each( [ & ]( const int _l ){ return a[ _l ] / b[ _l ]; } );
+            SK_CHECK( near( Simd::Div( va, vb ), expected ) );
+            each( [ & ]( const int _l ){ return std::min( a[ _l ], b[ _l ] ); } );
+            SK_CHECK( near( Simd::Min( va, vb ), expected, 0.0f ) );
+            each( [ & ]( const int _l ){ return std::max( a[ _l ], b[ _l ] ); } );
+            SK_CHECK( near( Simd::Max( va, vb ), expected, 0.0f ) );
+            // Fused or not, the result has to be within rounding of the separate operations.
+            each( [ & ]( const int _l ){ return a[ _l ] * b[ _l ] + c[ _l ]; } );
+            SK_CHECK( near( Simd::MulAdd( va, vb, vc ), expected, 1e-4f ) );
+            each( [ & ]( const int _l ){ return std::sqrt( std::abs( a[ _l ] ) ); } );
+            SK_CHECK( near( Simd::Sqrt( Simd::Max( va, Simd::Zero() - va ) ), expected ) );
+
+            uint32_t mask = 0;
+            for( int l = 0; l < 4; l++ )
+                mask |= ( a[ l ] < b[ l ] ? 1u : 0u ) << l;
+            SK_CHECK( Simd::LessMask( va, vb ) == mask );
+
+            each( [ & ]( const int _l ){ return a[ 3 - _l ]; } );
+            SK_CHECK( near( Simd::Shuffle< 3, 2, 1, 0 >( va ), expected, 0.0f ) );
+            each( [ & ]( int ){ return a[ 2 ]; } );
+            SK_CHECK( near( Simd::Broadcast< 2 >( va ), expected, 0.0f ) );
+            SK_CHECK( Simd::GetX( va ) == a[ 0 ] );
+
+            const auto dot3 = a[ 0 ] * b[ 0 ] + a[ 1 ] * b[ 1 ] + a[ 2 ] * b[ 2 ];
+            each( [ & ]( int ){ return dot3; } );
+            SK_CHECK( near( Simd::Dot3( va, vb ), expected, 1e-4f ) );
+            each( [ & ]( int ){ return dot3 + a[ 3 ] * b[ 3 ]; } );
+            SK_CHECK( near( Simd::Dot4( va, vb ), expected, 1e-4f ) );
+
+            const float cross[ 4 ] = { a[ 1 ] * b[ 2 ] - a[ 2 ] * b[ 1 ], a[ 2 ] * b[ 0 ] - a[ 0 ] * b[ 2 ], a[ 0 ] * b[ 1 ] - a[ 1 ] * b[ 0 ], 0.0f };
+            SK_CHECK( near( Simd::Cross3( va, vb ), cross, 1e-4f ) );
+        }
+    } // test_operations
+
+    void test_transpose()
+    {
+        const auto matrix = make_matrix();
+        SK_CHECK( near( matrix.transposed_fast(), matrix.transposed(), 0.0f ) );
+
+        auto r0 = Simd::Load( matrix.x ), r1 = Simd::Load( matrix.y ), r2 = Simd::Load( matrix.z ), r3 = Simd::Load( matrix.w );
+        Simd::Transpose( r0, r1, r2, r3 );
+        Simd::Transpose( r0, r1, r2, r3 );
+
+        sk::cMatrix4x4f twice;
+        Simd::Store( twice.x, r0 );
+        Simd::Store( twice.y, r1 );
+        Simd::Store( twice.z, r2 );
+        Simd::Store( twice.w, r3 );
+        SK_CHECK( near( twice, matrix, 0.0f ) );
+    } // test_transpose
+
+    void test_matrices()
+    {
+        for( size_t i = 0; i < 1000; i++ )
+        {
+            const auto a = make_matrix();
+            const auto b = make_matrix();
+            SK_CHECK( near( a * b, reference_multiply( a, b ), 1e-4f ) );
+
+            // The result is allowed to alias an input.
+            auto aliased = a;
+            aliased *= b;
+            SK_CHECK( near( aliased, a * b, 0.0f ) );
+        }
+
+        for( size_t i = 0; i < 1000; i++ )
+        {
+            const auto affine  = make_affine();
+            const auto inverse = affine.inversed_affine();
+            SK_CHECK( near( affine * inverse, sk::cMatrix4x4f{}, 1e-4f ) );
+            SK_CHECK( near( inverse, affine.inversed(), 1e-4f ) );
+        }
+
+        // Every lane count, the missing lanes can't touch the output.
+        for( size_t count = 1; count <= 4; count++ )
+        {
+            sk::cMatrix4x4f in[ 4 ], out[ 5 ];
+            for( auto& matrix : in )
+                matrix = make_affine();
+            const auto sentinel = make_matrix();
+            for( auto& matrix : out )
+                matrix = sentinel;
+
+            Matrix4x4::inversed_affine_x4( in, out, count );
+            for( size_t lane = 0; lane < 4; lane++ )
+                SK_CHECK( near( out[ lane ], lane < count ? in[ lane ].inversed_affine() : sentinel, 1e-5f ) );
+            SK_CHECK( near( out[ 4 ], sentinel, 0.0f ) );
+        }
+    } // test_matrices
+
+    void test_quaternions()
+    {
+        for( size_t i = 0; i < 1000; i++ )
+        {
+            const sk::cQuaternionf a( next(), next(), next(), next() );
+            const sk::cQuaternionf b( next(), next(), next(), next() );
+            const auto product = a * b;
+
+            SK_CHECK( near( product.x, a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y, 1e-4f ) );
+            SK_CHECK( near( product.y, a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x, 1e-4f ) );
+            SK_CHECK( near( product.z, a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w, 1e-4f ) );
+            SK_CHECK( near( product.w, a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z, 1e-4f ) );
+        }
+    } // test_quaternions
+} // ::
+
+// Compares the SIMD layer against plain scalar math. Configure with SKAPE_SIMD_FORCE_SCALAR, or for another target, to cover the other backends.
+int main()
+{
+    std::println( "Backend: {}", Simd::kBackend );
+
+    sk::Testing::Run( "Operations",  &test_operations );
+    sk::Testing::Run( "Transpose",   &test_transpose );
+    sk::Testing::Run( "Matrices",    &test_matrices );
+    sk::Testing::Run( "Quaternions", &test_quaternions );
+
+    return sk::Testing::Finish();
+}
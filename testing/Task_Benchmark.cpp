@@ -0,0 +1,165 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Test.h"
+
+#include <sk/Misc/Future.h>
+#include <sk/Misc/Task.h>
+
+#include <atomic>
+#include <span>
+#include <vector>
+
+namespace
+{
+    // Loads waiting on a few shared dependencies, like materials waiting for their shaders and textures.
+    constexpr size_t kLoads        = 100'000;
+    constexpr size_t kDependencies = 4;
+    constexpr size_t kShared       = 64;
+
+    // Steps done one after another, a coroutine frame or a future each.
+    constexpr size_t kSteps = 1'000'000;
+
+    auto load_task( const std::span< const sk::cFuture< int > > _dependencies ) -> sk::cTask< int >
+    {
+        int sum = 0;
+        for( const auto& dependency : _dependencies )
+            sum += co_await dependency;
+
+        co_return sum;
+    } // load_task
+
+    // What the same load looks like today, a continuation per dependency counting down to the last one.
+    auto load_callback( const std::span< const sk::cFuture< int > > _dependencies ) -> sk::cFuture< int >
+    {
+        struct sState
+        {
+            std::atomic_size_t remaining;
+            std::atomic_int    sum = 0;
+        };
+
+        sk::cPromise< int > promise;
+        auto future = promise.GetFuture();
+
+        auto state = sk::make_shared< sState >();
+        state->remaining = _dependencies.size();
+        for( const auto& dependency : _dependencies )
+        {
+            dependency.OnReady( [ state, promise, dependency ]() mutable
+            {
+                state->sum += dependency.Get();
+                if( --state->remaining == 0 )
+                    promise.SetValue( state->sum.load() );
+            } );
+        }
+
+        return future;
+    } // load_callback
+
+    auto expected( const size_t _load )
+    {
+        int sum = 0;
+        for( size_t i = 0; i < kDependencies; i++ )
+            sum += static_cast< int >( _load % ( kShared - kDependencies ) + i + 1 );
+        return sum;
+    } // expected
+
+    // Starts every load, with the dependencies either already done or done afterwards. Returns false if a load got the wrong value.
+    template< class Fn >
+    bool run( const bool _ready, Fn&& _load )
+    {
+        std::vector< sk::cPromise< int > > promises( kShared );
+        std::vector< sk::cFuture< int > >  dependencies;
+        dependencies.reserve( kShared );
+        for( const auto& promise : promises )
+            dependencies.emplace_back( promise.GetFuture() );
+
+        const auto complete = [ & ]
+        {
+            for( size_t i = 0; i < kShared; i++ )
+                promises[ i ].SetValue( static_cast< int >( i + 1 ) );
+        };
+
+        if( _ready )
+            complete();
+
+        std::vector< sk::cFuture< int > > loads;
+        loads.reserve( kLoads );
+        for( size_t i = 0; i < kLoads; i++ )
+            loads.emplace_back( _load( std::span( dependencies ).subspan( i % ( kShared - kDependencies ), kDependencies ) ) );
+
+        bool valid = true;
+        if( !_ready )
+        {
+            for( const auto& load : loads )
+                valid &= !load.IsReady();
+
+            complete();
+        }
+
+        for( size_t i = 0; i < kLoads; i++ )
+            valid &= loads[ i ].IsReady() && loads[ i ].Get() == expected( i );
+
+        return valid;
+    } // run
+
+    auto step_task( const int _value ) -> sk::cTask< int >
+    {
+        co_return _value + 1;
+    } // step_task
+
+    auto steps_task() -> sk::cTask< int >
+    {
+        int value = 0;
+        for( size_t i = 0; i < kSteps; i++ )
+            value = co_await step_task( value );
+
+        co_return value;
+    } // steps_task
+} // ::
+
+// Times the same loads written as coroutines and with continuations, and a long chain of single steps both ways.
+int main()
+{
+    bool valid = true;
+
+    const auto task     = []( const std::span< const sk::cFuture< int > > _dependencies ){ return load_task( _dependencies ).Start(); };
+    const auto callback = []( const std::span< const sk::cFuture< int > > _dependencies ){ return load_callback( _dependencies ); };
+
+    const auto ready_task_ms       = sk::Testing::Measure( 10, [ & ]{ valid &= run( true,  task ); } );
+    const auto ready_callback_ms   = sk::Testing::Measure( 10, [ & ]{ valid &= run( true,  callback ); } );
+    const auto pending_task_ms     = sk::Testing::Measure( 10, [ & ]{ valid &= run( false, task ); } );
+    const auto pending_callback_ms = sk::Testing::Measure( 10, [ & ]{ valid &= run( false, callback ); } );
+
+    int task_steps = 0;
+    const auto steps_task_ms = sk::Testing::Measure( 10, [ & ]{ task_steps = steps_task().Start().Get(); } );
+
+    // Chaining the same steps with continuations, the previous future is released as soon as the next one is ready.
+    int callback_steps = 0;
+    const auto steps_callback_ms = sk::Testing::Measure( 10, [ & ]
+    {
+        sk::cPromise< int > first;
+        first.SetValue( 0 );
+
+        auto future = first.GetFuture();
+        for( size_t i = 0; i < kSteps; i++ )
+            future = future.Then( []( const int _value ){ return _value + 1; } );
+
+        callback_steps = future.Get();
+    } );
+
+    std::println( "Tasks, {} loads with {} dependencies each", kLoads, kDependencies );
+    std::println( "Ready:    {:.3f} ms as tasks, {:.3f} ms with callbacks", ready_task_ms,   ready_callback_ms );
+    std::println( "Pending:  {:.3f} ms as tasks, {:.3f} ms with callbacks", pending_task_ms, pending_callback_ms );
+    std::println( "Chained:  {:.3f} ms as tasks, {:.3f} ms with callbacks, {} steps at {:.1f} and {:.1f} ns each", steps_task_ms, steps_callback_ms, kSteps,
+        steps_task_ms * 1e6 / static_cast< double >( kSteps ), steps_callback_ms * 1e6 / static_cast< double >( kSteps ) );
+
+    valid &= task_steps == static_cast< int >( kSteps ) && callback_steps == static_cast< int >( kSteps );
+    if( !valid )
+        std::println( stderr, "A load finished with the wrong value, or before all of its dependencies were done." );
+
+    return valid ? 0 : 1;
+}
@@ -0,0 +1,76 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <csignal>
+#include <cstddef>
+#include <print>
+#include <string_view>
+
+// Every test is a plain executable, which fails by returning non zero from main.
+namespace sk::Testing
+{
+    inline auto GetFailures() -> size_t&
+    {
+        static size_t failures = 0;
+        return failures;
+    } // GetFailures
+
+    inline void Check( const bool _passed, const char* _expression, const char* _file, const int _line )
+    {
+        if( _passed )
+            return;
+
+        std::println( stderr, "{}({}): Failed: {}", _file, _line, _expression );
+        GetFailures()++;
+    } // Check
+
+    template< class Fn >
+    void Run( const std::string_view _name, Fn&& _test )
+    {
+        const auto failures = GetFailures();
+        _test();
+
+        std::println( "{} {}", GetFailures() == failures ? "Passed:" : "Failed:", _name );
+    } // Run
+
+    inline auto Finish() -> int
+    {
+        if( GetFailures() != 0 )
+            std::println( stderr, "{} check(s) failed.", GetFailures() );
+
+        return GetFailures() == 0 ? 0 : 1;
+    } // Finish
+
+    // Tests which make the engine report errors on purpose have to call this, as SK_BREAK would stop the test otherwise.
+    inline void IgnoreBreaks()
+    {
+#if !defined( _MSC_VER )
+        std::signal( SIGINT, []( int ){} );
+#if defined( SIGTRAP )
+        std::signal( SIGTRAP, []( int ){} );
+#endif // SIGTRAP
+#endif // !_MSC_VER
+    } // IgnoreBreaks
+
+    // Runs _fn _iterations times after a single warmup, and returns the average time of a run in milliseconds.
+    template< class Fn >
+    auto Measure( const size_t _iterations, Fn&& _fn ) -> double
+    {
+        _fn();
+
+        const auto start = std::chrono::steady_clock::now();
+        for( size_t i = 0; i < _iterations; i++ )
+            _fn();
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+
+        return std::chrono::duration< double, std::milli >( elapsed ).count() / static_cast< double >( _iterations );
+    } // Measure
+} // sk::Testing::
+
+#define SK_CHECK( ... ) ::sk::Testing::Check( static_cast< bool >( __VA_ARGS__ ), #__VA_ARGS__, __FILE__, __LINE__ )
@@ -0,0 +1,138 @@
+/*
+ *
+ * COPYRIGHT William Ask S. Ness 2025
+ *
+ */
+
+#include "Test.h"
+
+#include <sk/Math/Simd.h>
+#include <sk/Math/Transform.h>
+
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr size_t kDepth      = 10;
+    constexpr size_t kPerLevel   = 10'000;
+    constexpr size_t kTransforms = kDepth * kPerLevel;
+    constexpr size_t kMoving     = 1'000;
+    constexpr size_t kRemoved    = 1'000;
+
+    // Measure runs everything twice, building and removing can only be done once.
+    template< class Fn >
+    auto once( Fn&& _fn )
+    {
+        const auto start = std::chrono::steady_clock::now();
+        _fn();
+        return std::chrono::duration< double, std::milli >( std::chrono::steady_clock::now() - start ).count();
+    } // once
+
+    // The same product the hierarchy does, one transform at a time up the parents.
+    auto reference_world( const std::vector< sk::cShared_ptr< sk::cTransform > >& _transforms, const std::vector< size_t >& _parents, size_t _index )
+    {
+        sk::cMatrix4x4f world;
+        for( ; _index != kTransforms; _index = _parents[ _index ] )
+        {
+            const auto& transform = *_transforms[ _index ];
+            world = world * sk::Math::Matrix4x4::scale_rotate_translate( transform.GetScale(), transform.GetRotation(), transform.GetPosition() );
+        }
+        return world;
+    } // reference_world
+} // ::
+
+// Updates 100k attached transforms, 10 levels deep with every transform parented to a random one on the level above.
+// Removing transforms with children is timed as well, as their children are found through the child lists.
+int main()
+{
+    sk::cTransform_Hierarchy::init();
+    auto& hierarchy = sk::cTransform_Hierarchy::get();
+
+    std::mt19937 random{ 1 };
+    std::uniform_real_distribution distribution( -10.0f, 10.0f );
+
+    std::vector< sk::cShared_ptr< sk::cTransform > > transforms;
+    std::vector< size_t > parents;
+    transforms.reserve( kTransforms );
+    parents   .reserve( kTransforms );
+
+    const auto attach_ms = once( [ & ]
+    {
+        for( size_t level = 0; level < kDepth; level++ )
+        {
+            for( size_t i = 0; i < kPerLevel; i++ )
+            {
+                auto& transform = transforms.emplace_back( sk::make_shared< sk::cTransform >(
+                    sk::cVector3f{ distribution( random ), distribution( random ), distribution( random ) },
+                    sk::cVector3f{ 0.0f, distribution( random ) * 18.0f, 0.0f } ) );
+
+                const auto parent = level == 0 ? kTransforms : ( level - 1 ) * kPerLevel + random() % kPerLevel;
+                parents.emplace_back( parent );
+                if( parent != kTransforms )
+                    transform->SetParent( transforms[ parent ] );
+                transform->Attach();
+            }
+        }
+    } );
+
+    // The first update sorts the transforms by depth.
+    const auto sort_ms = once( [ & ]{ hierarchy.Update(); } );
+
+    // Moving the roots dirties every transform below them.
+    const auto full_ms = sk::Testing::Measure( 20, [ & ]
+    {
+        for( size_t i = 0; i < kPerLevel; i++ )
+            transforms[ i ]->MarkDirty();
+        hierarchy.Update();
+    } );
+
+    std::vector< size_t > moving( kMoving );
+    for( auto& index : moving )
+        index = random() % kTransforms;
+
+    const auto partial_ms = sk::Testing::Measure( 20, [ & ]
+    {
+        for( const auto index : moving )
+            transforms[ index ]->MarkDirty();
+        hierarchy.Update();
+    } );
+
+    bool valid = hierarchy.GetSize() == kTransforms;
+    for( size_t i = 0; i < 100; i++ )
+    {
+        const auto index    = ( kDepth - 1 ) * kPerLevel + random() % kPerLevel;
+        const auto expected = reference_world( transforms, parents, index );
+        const auto& world   = transforms[ index ]->GetWorld();
+        for( size_t c = 0; c < 4; c++ )
+            valid &= std::abs( ( &world.w.x )[ c ] - ( &expected.w.x )[ c ] ) <= 1e-3f * std::max( 1.0f, std::abs( ( &expected.w.x )[ c ] ) );
+    }
+
+    // From the middle of the hierarchy, so every one of them has children to detach.
+    const auto remove_ms = once( [ & ]
+    {
+        for( size_t i = 0; i < kRemoved; i++ )
+            transforms[ ( kDepth / 2 ) * kPerLevel + i ] = nullptr;
+    } );
+    const auto resort_ms = once( [ & ]{ hierarchy.Update(); } );
+
+    valid &= hierarchy.GetSize() == kTransforms - kRemoved;
+
+    std::println( "Transform hierarchy, {} backend, {} transforms {} levels deep", sk::Math::Simd::kBackend, kTransforms, kDepth );
+    std::println( "Attach:         {:.3f} ms", attach_ms );
+    std::println( "Sort + update:  {:.3f} ms", sort_ms );
+    std::println( "Full update:    {:.3f} ms", full_ms );
+    std::println( "{} moving:    {:.3f} ms", kMoving, partial_ms );
+    std::println( "Remove {}:    {:.3f} ms", kRemoved, remove_ms );
+    std::println( "Resort:         {:.3f} ms", resort_ms );
+
+    if( !valid )
+        std::println( stderr, "The hierarchy doesn't match the reference." );
+
+    transforms.clear();
+    sk::cTransform_Hierarchy::shutdown();
+
+    return valid ? 0 : 1;
+}